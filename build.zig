@@ -40,6 +40,7 @@ pub fn build(b: *std.Build) !void {
     core_lib.linkSystemLibrary("libcurl");
     core_lib.linkSystemLibrary("jansson");
     core_lib.linkSystemLibrary("libpcre2-posix");
+    core_lib.linkSystemLibrary("zlib");
     core_lib.linkLibC();
 
     buildEmacsModule(b, core_lib, target, optimize, cflags.items);
@@ -52,7 +53,7 @@ pub fn build(b: *std.Build) !void {
         );
     }
 
-    inline for (.{ "core", "discussion" }) |name| {
+    inline for (.{ "core", "discussion", "trending", "export" }) |name| {
         buildTest(
             b,
             name,
@@ -13,9 +13,36 @@ fn checkErr(err: c.omg_error) !void {
     }
 }
 
+fn optionalCString(allocator: std.mem.Allocator, s: ?[]const u8) ![*c]const u8 {
+    return if (s) |v| (try allocator.dupeZ(u8, v)).ptr else null;
+}
+
 const SubCommand = enum {
     sync,
     trend,
+    @"trend-history",
+    vacuum,
+    @"export",
+    @"export-changes",
+    @"import-changes",
+    readme,
+    search,
+    releases,
+    stars,
+    repos,
+    gists,
+};
+
+const OutputFormat = enum {
+    table,
+    jsonl,
+    tsv,
+};
+
+const SortBy = enum {
+    created,
+    stars,
+    name,
 };
 
 pub fn main() !void {
@@ -26,11 +53,26 @@ pub fn main() !void {
     const opt = try simargs.parse(allocator, struct {
         mode: SubCommand,
         timeout: i32 = 10,
+        @"page-size": i32 = 0,
+        @"cache-size": i32 = 0,
+        @"mmap-size": i64 = 0,
+        @"temp-store": ?[]const u8 = null,
+        @"journal-mode": ?[]const u8 = null,
+        synchronous: ?[]const u8 = null,
+        @"optimize-interval": i32 = 0,
+        @"trending-ttl": i32 = 0,
+        format: OutputFormat = .table,
+        language: ?[]const u8 = null,
+        sort: SortBy = .created,
+        starred: bool = false,
         help: bool = false,
 
         pub const __shorts__ = .{
             .mode = .m,
             .timeout = .t,
+            .format = .f,
+            .language = .l,
+            .sort = .s,
             .help = .h,
         };
 
@@ -38,6 +80,18 @@ pub fn main() !void {
         pub const __messages__ = .{
             .mode = "Which task to execute",
             .timeout = "HTTP timeout(seconds)",
+            .@"page-size" = "SQLite page size, only for new database",
+            .@"cache-size" = "SQLite cache size, pages when positive, KiB when negative",
+            .@"mmap-size" = "SQLite mmap size(bytes)",
+            .@"temp-store" = "SQLite temp store(default/file/memory)",
+            .@"journal-mode" = "SQLite journal mode(delete/wal/...)",
+            .synchronous = "SQLite synchronous(off/normal/full/extra)",
+            .@"optimize-interval" = "Seconds between database optimization after sync, 0 means one day, negative disables it",
+            .@"trending-ttl" = "Seconds a cached trending page is fresh, 0 means one hour, negative disables the cache",
+            .format = "Output format of stars/repos/gists(table/jsonl/tsv)",
+            .language = "Language filter of stars/repos/gists",
+            .sort = "Sort of stars/repos/gists(created/stars/name), starred time for stars",
+            .starred = "List starred gists instead of created ones in gists",
             .help = "Prints help message",
         };
     }, "[args]", null);
@@ -53,13 +107,50 @@ pub fn main() !void {
 
     const c_token = try allocator.dupeZ(u8, token.?);
     const c_db_path = try allocator.dupeZ(u8, db_path.?);
+    const setup_opts = c.omg_setup_options{
+        .github_token = c_token,
+        .timeout = opt.args.timeout,
+        .page_size = opt.args.@"page-size",
+        .cache_size = opt.args.@"cache-size",
+        .mmap_size = opt.args.@"mmap-size",
+        .temp_store = try optionalCString(allocator, opt.args.@"temp-store"),
+        .journal_mode = try optionalCString(allocator, opt.args.@"journal-mode"),
+        .synchronous = try optionalCString(allocator, opt.args.synchronous),
+        .optimize_interval = opt.args.@"optimize-interval",
+        .trending_ttl = opt.args.@"trending-ttl",
+    };
     var ctx: c.omg_context = null;
-    try checkErr(c.omg_setup_context(c_db_path, c_token, opt.args.timeout, &ctx));
+    try checkErr(c.omg_setup_context_with_options(c_db_path, &setup_opts, &ctx));
     defer c.omg_free_context(&ctx);
 
     switch (opt.args.mode) {
         .sync => try processSync(allocator, ctx),
         .trend => try processTrend(allocator, ctx, opt.positional_args.items),
+        .@"trend-history" => try processTrendHistory(allocator, ctx, opt.positional_args.items),
+        .vacuum => try checkErr(c.omg_vacuum(ctx, 0)),
+        .@"export" => try processExport(ctx, opt.positional_args.items),
+        .@"export-changes" => try processExportChanges(ctx, opt.positional_args.items),
+        .@"import-changes" => try processImportChanges(ctx),
+        .readme => try processReadme(ctx),
+        .search => try processSearch(allocator, ctx, opt.positional_args.items),
+        .releases => try processReleases(allocator, ctx, opt.positional_args.items),
+        .stars, .repos, .gists => {
+            const query = Query{
+                .keyword = try optionalCString(allocator, if (opt.positional_args.items.len > 0)
+                    try std.mem.join(allocator, " ", opt.positional_args.items)
+                else
+                    null),
+                .language = try optionalCString(allocator, opt.args.language),
+                .sort = opt.args.sort,
+                .format = opt.args.format,
+            };
+            switch (opt.args.mode) {
+                .stars => try processRepos(ctx, true, query),
+                .repos => try processRepos(ctx, false, query),
+                .gists => try processGists(ctx, opt.args.starred, query),
+                else => unreachable,
+            }
+        },
     }
 }
 
@@ -70,12 +161,72 @@ fn numToString(
     return std.fmt.allocPrint(allocator, "{d}", .{n}) catch unreachable;
 }
 
+const SyncProgress = struct {
+    // whether current line has progress printed
+    printed: bool = false,
+    // otherwise one line is printed per page, without escape sequences
+    tty: bool,
+
+    // Rewrite one line of stderr per page, such as
+    // starred repositories: page 3/12, 300 rows(150/s), 1.2MiB(600KiB/s), ETA 18s
+    fn report(progress: [*c]const c.omg_sync_progress, userdata: ?*anyopaque) callconv(.C) void {
+        const self: *SyncProgress = @ptrCast(@alignCast(userdata));
+        const p = progress.*;
+        const seconds = @max(@as(f64, @floatFromInt(p.elapsed_ms)) / 1000.0, 0.001);
+        const rows: f64 = @floatFromInt(p.rows);
+        const bytes: f64 = @floatFromInt(p.bytes);
+
+        const w = std.io.getStdErr().writer();
+        if (self.tty) {
+            w.writeByte('\r') catch return;
+        }
+        w.print("{s}: page {d}", .{ std.mem.span(p.kind), p.page }) catch return;
+        if (p.remaining_pages >= 0) {
+            w.print("/{d}", .{p.page + p.remaining_pages}) catch return;
+        }
+        w.print(", {d} rows({d:.0}/s), {:.1}({:.1}/s)", .{
+            p.rows,
+            rows / seconds,
+            std.fmt.fmtIntSizeBin(@intCast(p.bytes)),
+            std.fmt.fmtIntSizeBin(@intFromFloat(bytes / seconds)),
+        }) catch return;
+        if (p.remaining_pages > 0) {
+            const eta = seconds / @as(f64, @floatFromInt(p.page)) * @as(f64, @floatFromInt(p.remaining_pages));
+            w.print(", ETA {d:.0}s", .{eta}) catch return;
+        }
+        if (!self.tty) {
+            w.writeByte('\n') catch return;
+            return;
+        }
+        // clear leftover of a longer previous line
+        w.writeAll("\x1b[K") catch return;
+        self.printed = true;
+    }
+
+    fn finish(self: *SyncProgress) void {
+        if (self.printed) {
+            std.io.getStdErr().writer().writeAll("\n") catch {};
+            self.printed = false;
+        }
+    }
+};
+
 fn processSync(allocator: std.mem.Allocator, ctx: c.omg_context) !void {
     _ = allocator;
+    var progress = SyncProgress{ .tty = std.io.getStdErr().isTty() };
+    c.omg_set_sync_progress(ctx, SyncProgress.report, &progress);
+    defer c.omg_set_sync_progress(ctx, null, null);
+
+    errdefer progress.finish();
+
     try checkErr(c.omg_sync_created_repos(ctx));
+    progress.finish();
     try checkErr(c.omg_sync_starred_repos(ctx));
+    progress.finish();
     try checkErr(c.omg_sync_created_gists(ctx));
+    progress.finish();
     try checkErr(c.omg_sync_starred_gists(ctx));
+    progress.finish();
 }
 
 fn processTrend(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]const u8) !void {
@@ -87,6 +238,9 @@ fn processTrend(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]cons
         args[1]
     else
         "daily";
+    if (std.mem.indexOfScalar(u8, language, ',') != null) {
+        return processTrendBatch(allocator, ctx, language, since);
+    }
 
     var lst: c.omg_repo_list = .{
         .length = 0,
@@ -96,14 +250,19 @@ fn processTrend(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]cons
     defer c.omg_free_repo_list(&lst);
 
     var i: usize = 0;
-    const headers = [_][]const u8{ "Name", "Stars", "Description" };
+    const headers = [_][]const u8{ "Name", "Language", "Stars", "Recent Stars", "Description" };
     var table_data = std.ArrayList([headers.len][]const u8).init(allocator);
     while (i < lst.length) {
-        const repo_name = std.mem.span(lst.repo_array[i].full_name);
-        const description = std.mem.span(lst.repo_array[i].description);
+        const repo = lst.repo_array[i];
+        const repo_name = std.mem.span(repo.full_name);
+        // language and description are absent on some repositories
+        const lang = if (repo.lang == null) "" else std.mem.span(repo.lang);
+        const description = if (repo.description == null) "" else std.mem.span(repo.description);
         try table_data.append([_][]const u8{
             repo_name[0..@min(30, repo_name.len)],
-            numToString(allocator, lst.repo_array[i].stargazers_count),
+            lang,
+            numToString(allocator, repo.stargazers_count),
+            numToString(allocator, repo.recent_stars),
             description[0..@min(100, description.len)],
         });
         i += 1;
@@ -116,3 +275,512 @@ fn processTrend(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]cons
     };
     try std.io.getStdOut().writer().print("{}\n", .{table});
 }
+
+// trend lang1,lang2,... [since], pages are fetched at once and merged
+fn processTrendBatch(allocator: std.mem.Allocator, ctx: c.omg_context, languages: []const u8, since: []const u8) !void {
+    var sources = std.ArrayList(c.omg_trending_source).init(allocator);
+    var it = std.mem.splitScalar(u8, languages, ',');
+    while (it.next()) |language| {
+        try sources.append(.{
+            .spoken_lang = null,
+            .lang = try allocator.dupeZ(u8, language),
+            .since = try allocator.dupeZ(u8, since),
+        });
+    }
+
+    var lst = std.mem.zeroes(c.omg_trending_list);
+    try checkErr(c.omg_query_trendings(ctx, sources.items.ptr, sources.items.len, &lst));
+    defer c.omg_free_trending_list(&lst);
+
+    const headers = [_][]const u8{ "Name", "Language", "Stars", "Recent Stars", "Ranks", "Description" };
+    var table_data = std.ArrayList([headers.len][]const u8).init(allocator);
+    for (lst.repo_array[0..lst.length]) |merged| {
+        const repo = merged.repo;
+        const repo_name = std.mem.span(repo.full_name);
+        const lang = if (repo.lang == null) "" else std.mem.span(repo.lang);
+        const description = if (repo.description == null) "" else std.mem.span(repo.description);
+        // rank on each page in order of languages, "-" when absent
+        var ranks = std.ArrayList(u8).init(allocator);
+        for (merged.ranks[0..sources.items.len], 0..) |rank, i| {
+            if (i > 0) {
+                try ranks.append(' ');
+            }
+            if (rank == 0) {
+                try ranks.append('-');
+            } else {
+                try ranks.writer().print("{d}", .{rank});
+            }
+        }
+        try table_data.append([_][]const u8{
+            repo_name[0..@min(30, repo_name.len)],
+            lang,
+            numToString(allocator, repo.stargazers_count),
+            numToString(allocator, repo.recent_stars),
+            ranks.items,
+            description[0..@min(100, description.len)],
+        });
+    }
+    const TrendingTable = Table(headers.len);
+    const table = TrendingTable{
+        .header = headers,
+        .rows = table_data.items,
+        .footer = null,
+    };
+    try std.io.getStdOut().writer().print("{}\n", .{table});
+}
+
+// trend-history [lang] [since] [days], repositories seen by `trend` in last days
+fn processTrendHistory(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]const u8) !void {
+    const language = if (args.len > 0)
+        args[0]
+    else
+        "any";
+    const since = if (args.len > 1)
+        args[1]
+    else
+        "daily";
+    const days = if (args.len > 2)
+        try std.fmt.parseInt(c_int, args[2], 10)
+    else
+        30;
+
+    var lst = std.mem.zeroes(c.omg_trending_streak_list);
+    try checkErr(c.omg_query_trending_streaks(ctx, null, try allocator.dupeZ(u8, language), try allocator.dupeZ(u8, since), days, 0, &lst));
+    defer c.omg_free_trending_streak_list(&lst);
+
+    const headers = [_][]const u8{ "Name", "Days", "Streak", "Longest", "Best Rank", "Stars Gained", "Last Seen" };
+    var table_data = std.ArrayList([headers.len][]const u8).init(allocator);
+    for (lst.streak_array[0..lst.length]) |streak| {
+        const repo_name = std.mem.span(streak.full_name);
+        try table_data.append([_][]const u8{
+            repo_name[0..@min(30, repo_name.len)],
+            numToString(allocator, streak.days),
+            numToString(allocator, streak.current_streak),
+            numToString(allocator, streak.longest_streak),
+            numToString(allocator, streak.best_rank),
+            numToString(allocator, streak.stars_gained),
+            std.mem.span(streak.last_seen),
+        });
+    }
+    const HistoryTable = Table(headers.len);
+    const table = HistoryTable{
+        .header = headers,
+        .rows = table_data.items,
+        .footer = null,
+    };
+    try std.io.getStdOut().writer().print("{}\n", .{table});
+}
+
+// export [repos|stars|gists|starred-gists] [jsonl|csv], write to stdout
+fn processExport(ctx: c.omg_context, args: [][]const u8) !void {
+    const ExportKind = enum { repos, stars, gists, @"starred-gists" };
+    const ExportFormat = enum { jsonl, csv };
+    const kind = if (args.len > 0)
+        std.meta.stringToEnum(ExportKind, args[0]) orelse return error.UnknownExportKind
+    else
+        ExportKind.stars;
+    const format = if (args.len > 1)
+        std.meta.stringToEnum(ExportFormat, args[1]) orelse return error.UnknownExportFormat
+    else
+        ExportFormat.jsonl;
+
+    const c_kind: c.omg_export_kind = switch (kind) {
+        .repos => c.OMG_EXPORT_CREATED_REPOS,
+        .stars => c.OMG_EXPORT_STARRED_REPOS,
+        .gists => c.OMG_EXPORT_CREATED_GISTS,
+        .@"starred-gists" => c.OMG_EXPORT_STARRED_GISTS,
+    };
+    const c_format: c.omg_export_format = switch (format) {
+        .jsonl => c.OMG_FORMAT_JSONL,
+        .csv => c.OMG_FORMAT_CSV,
+    };
+    try checkErr(c.omg_export(ctx, c_kind, c_format, std.io.getStdOut().handle));
+}
+
+// export-changes [since], write changeset to stdout, and the position for next
+// export to stderr
+fn processExportChanges(ctx: c.omg_context, args: [][]const u8) !void {
+    const since = if (args.len > 0)
+        try std.fmt.parseInt(i64, args[0], 10)
+    else
+        0;
+    var until: i64 = 0;
+    try checkErr(c.omg_export_changeset(ctx, since, std.io.getStdOut().handle, &until));
+    try std.io.getStdErr().writer().print("until: {d}\n", .{until});
+}
+
+// import-changes, read changeset from stdin
+fn processImportChanges(ctx: c.omg_context) !void {
+    var until: i64 = 0;
+    try checkErr(c.omg_import_changeset(ctx, std.io.getStdIn().handle, &until));
+    try std.io.getStdErr().writer().print("until: {d}\n", .{until});
+}
+
+fn processReadme(ctx: c.omg_context) !void {
+    var stats = std.mem.zeroes(c.omg_readme_sync_stats);
+    try checkErr(c.omg_sync_readmes(ctx, 0, &stats));
+    try std.io.getStdOut().writer().print(
+        "checked: {d}, updated: {d}, not modified: {d}, missing: {d}, failed: {d}\n",
+        .{ stats.checked, stats.updated, stats.not_modified, stats.missing, stats.failed },
+    );
+}
+
+const SearchCollector = struct {
+    allocator: std.mem.Allocator,
+    rows: std.ArrayList([3][]const u8),
+
+    fn visit(star: [*c]const c.omg_starred_repo, snippet: [*c]const u8, userdata: ?*anyopaque) callconv(.C) bool {
+        const self: *SearchCollector = @ptrCast(@alignCast(userdata));
+        const repo = star.*.repo;
+        // strings are borrowed, copy them before next row
+        const line = self.allocator.dupe(u8, std.mem.span(snippet)) catch return false;
+        std.mem.replaceScalar(u8, line, '\n', ' ');
+        self.rows.append([_][]const u8{
+            self.allocator.dupe(u8, std.mem.span(repo.full_name)) catch return false,
+            numToString(self.allocator, repo.stargazers_count),
+            line[0..@min(100, line.len)],
+        }) catch return false;
+        return true;
+    }
+};
+
+// search <query>, full-text search READMEs fetched by `readme`
+fn processSearch(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]const u8) !void {
+    if (args.len == 0) {
+        return error.QueryNotSet;
+    }
+    const query = try std.mem.join(allocator, " ", args);
+    var collector = SearchCollector{
+        .allocator = allocator,
+        .rows = std.ArrayList([3][]const u8).init(allocator),
+    };
+    const marks = c.omg_readme_marks{
+        .open = "*",
+        .close = "*",
+        .snippet_tokens = 0,
+        .limit = 20,
+    };
+    try checkErr(c.omg_search_readmes_each(ctx, try allocator.dupeZ(u8, query), &marks, SearchCollector.visit, &collector));
+
+    const headers = [_][]const u8{ "Name", "Stars", "README" };
+    const SearchTable = Table(headers.len);
+    const table = SearchTable{
+        .header = headers,
+        .rows = collector.rows.items,
+        .footer = null,
+    };
+    try std.io.getStdOut().writer().print("{}\n", .{table});
+}
+
+// releases [days], revalidate releases of starred repositories, then list
+// those published in last days(7 by default)
+fn processReleases(allocator: std.mem.Allocator, ctx: c.omg_context, args: [][]const u8) !void {
+    const days = if (args.len > 0)
+        try std.fmt.parseInt(i64, args[0], 10)
+    else
+        7;
+    try checkErr(c.omg_refresh_starred_releases(ctx, 10));
+
+    const epoch = std.time.epoch.EpochSeconds{ .secs = @intCast(std.time.timestamp() - days * std.time.s_per_day) };
+    const year_day = epoch.getEpochDay().calculateYearDay();
+    const month_day = year_day.calculateMonthDay();
+    const since = try std.fmt.allocPrintZ(allocator, "{d:0>4}-{d:0>2}-{d:0>2}T00:00:00Z", .{
+        year_day.year,
+        month_day.month.numeric(),
+        month_day.day_index + 1,
+    });
+
+    var lst = std.mem.zeroes(c.omg_release_list);
+    try checkErr(c.omg_query_releases_since(ctx, since, 0, &lst));
+    defer c.omg_free_release_list(&lst);
+
+    const headers = [_][]const u8{ "Name", "Tag", "PublishedAt", "Prerelease" };
+    var table_data = std.ArrayList([headers.len][]const u8).init(allocator);
+    var i: usize = 0;
+    while (i < lst.length) : (i += 1) {
+        const release = lst.release_array[i];
+        try table_data.append([_][]const u8{
+            std.mem.span(release.full_name),
+            std.mem.span(release.tag_name),
+            std.mem.span(release.published_at),
+            if (release.prerelease) "true" else "false",
+        });
+    }
+    const ReleaseTable = Table(headers.len);
+    const table = ReleaseTable{
+        .header = headers,
+        .rows = table_data.items,
+        .footer = null,
+    };
+    try std.io.getStdOut().writer().print("{}\n", .{table});
+}
+
+// Filters and output of stars/repos/gists, keyword is from positional args.
+const Query = struct {
+    keyword: [*c]const u8,
+    language: [*c]const u8,
+    sort: SortBy,
+    format: OutputFormat,
+};
+
+fn optionalSpan(s: [*c]const u8) ?[]const u8 {
+    return if (s == null) null else std.mem.span(s);
+}
+
+const Column = struct {
+    field: []const u8,
+    title: []const u8,
+    // in codepoints, text longer than it is truncated
+    width: usize,
+};
+
+// Rows are written as soon as they are visited, so output starts at first
+// row and memory stays constant however many rows match. Widths of table
+// columns are fixed for the same reason.
+fn RowWriter(comptime Row: type, comptime columns: []const Column) type {
+    return struct {
+        const Self = @This();
+
+        format: OutputFormat,
+        buffered: std.io.BufferedWriter(4096, std.fs.File.Writer),
+        // visitors can only return false, keep the error for finish
+        err: ?anyerror = null,
+
+        fn init(format: OutputFormat) !Self {
+            var self = Self{
+                .format = format,
+                .buffered = std.io.bufferedWriter(std.io.getStdOut().writer()),
+            };
+            if (format == .table) {
+                const w = self.buffered.writer();
+                inline for (columns, 0..) |column, i| {
+                    try writeCell(w, column.title, column.width, i + 1 < columns.len);
+                }
+                try w.writeByte('\n');
+            }
+            return self;
+        }
+
+        fn write(self: *Self, row: Row) bool {
+            self.writeRow(row) catch |e| {
+                self.err = e;
+                return false;
+            };
+            return true;
+        }
+
+        fn writeRow(self: *Self, row: Row) !void {
+            const w = self.buffered.writer();
+            var buf: [32]u8 = undefined;
+            switch (self.format) {
+                .jsonl => try std.json.stringify(row, .{}, w),
+                // no header, fields are in order of Row
+                .tsv => {
+                    inline for (std.meta.fields(Row), 0..) |field, i| {
+                        if (i > 0) {
+                            try w.writeByte('\t');
+                        }
+                        try writeTsvField(w, cellText(&buf, @field(row, field.name)));
+                    }
+                },
+                .table => {
+                    inline for (columns, 0..) |column, i| {
+                        try writeCell(w, cellText(&buf, @field(row, column.field)), column.width, i + 1 < columns.len);
+                    }
+                },
+            }
+            try w.writeByte('\n');
+        }
+
+        // Call it even when the query fails, to flush rows visited so far.
+        fn finish(self: *Self) !void {
+            // reader such as `head` is gone, nothing left to do
+            if (self.err) |e| {
+                if (e == error.BrokenPipe) {
+                    return;
+                }
+                return e;
+            }
+            self.buffered.flush() catch |e| {
+                if (e == error.BrokenPipe) {
+                    return;
+                }
+                return e;
+            };
+        }
+    };
+}
+
+fn cellText(buf: []u8, value: anytype) []const u8 {
+    return switch (@typeInfo(@TypeOf(value))) {
+        .Optional => if (value) |v| cellText(buf, v) else "",
+        .Int => std.fmt.bufPrint(buf, "{d}", .{value}) catch unreachable,
+        .Bool => if (value) "true" else "false",
+        else => value,
+    };
+}
+
+// Truncate text to width codepoints, and pad it with spaces when `pad`.
+// Control characters, such as newlines in description, are shown as space.
+fn writeCell(w: anytype, text: []const u8, width: usize, pad: bool) !void {
+    var count: usize = 0;
+    var i: usize = 0;
+    while (i < text.len and count < width) : (count += 1) {
+        const end = @min(text.len, i + (std.unicode.utf8ByteSequenceLength(text[i]) catch 1));
+        if (text[i] < ' ') {
+            try w.writeByte(' ');
+        } else {
+            try w.writeAll(text[i..end]);
+        }
+        i = end;
+    }
+    if (pad) {
+        try w.writeByteNTimes(' ', width - count + 2);
+    }
+}
+
+// Tab, newline and backslash are escaped, so one row is one line.
+fn writeTsvField(w: anytype, text: []const u8) !void {
+    for (text) |ch| {
+        switch (ch) {
+            '\t' => try w.writeAll("\\t"),
+            '\n' => try w.writeAll("\\n"),
+            '\r' => try w.writeAll("\\r"),
+            '\\' => try w.writeAll("\\\\"),
+            else => try w.writeByte(ch),
+        }
+    }
+}
+
+// Fields of JSONL, and columns of TSV in the same order.
+const RepoRow = struct {
+    id: c_int,
+    full_name: []const u8,
+    description: ?[]const u8,
+    language: ?[]const u8,
+    license: ?[]const u8,
+    stars: c_int,
+    forks: c_int,
+    private: bool,
+    created_at: ?[]const u8,
+    pushed_at: ?[]const u8,
+    // null for created repositories
+    starred_at: ?[]const u8,
+    homepage: ?[]const u8,
+
+    fn init(repo: c.omg_repo, starred_at: [*c]const u8) RepoRow {
+        return .{
+            .id = repo.id,
+            .full_name = std.mem.span(repo.full_name),
+            .description = optionalSpan(repo.description),
+            .language = optionalSpan(repo.lang),
+            .license = optionalSpan(repo.license),
+            .stars = repo.stargazers_count,
+            .forks = repo.forks_count,
+            .private = repo.private,
+            .created_at = optionalSpan(repo.created_at),
+            .pushed_at = optionalSpan(repo.pushed_at),
+            .starred_at = optionalSpan(starred_at),
+            .homepage = optionalSpan(repo.homepage),
+        };
+    }
+};
+
+const StarWriter = RowWriter(RepoRow, &[_]Column{
+    .{ .field = "full_name", .title = "Name", .width = 40 },
+    .{ .field = "language", .title = "Language", .width = 12 },
+    .{ .field = "stars", .title = "Stars", .width = 7 },
+    .{ .field = "starred_at", .title = "Starred At", .width = 19 },
+    .{ .field = "description", .title = "Description", .width = 80 },
+});
+
+const RepoWriter = RowWriter(RepoRow, &[_]Column{
+    .{ .field = "full_name", .title = "Name", .width = 40 },
+    .{ .field = "language", .title = "Language", .width = 12 },
+    .{ .field = "stars", .title = "Stars", .width = 7 },
+    .{ .field = "created_at", .title = "Created At", .width = 19 },
+    .{ .field = "description", .title = "Description", .width = 80 },
+});
+
+fn visitStar(star: [*c]const c.omg_starred_repo, userdata: ?*anyopaque) callconv(.C) bool {
+    const rows: *StarWriter = @ptrCast(@alignCast(userdata));
+    return rows.write(RepoRow.init(star.*.repo, star.*.starred_at));
+}
+
+fn visitRepo(repo: [*c]const c.omg_repo, userdata: ?*anyopaque) callconv(.C) bool {
+    const rows: *RepoWriter = @ptrCast(@alignCast(userdata));
+    return rows.write(RepoRow.init(repo.*, null));
+}
+
+// stars/repos [keyword], rows stream from a SQLite cursor
+fn processRepos(ctx: c.omg_context, is_star: bool, query: Query) !void {
+    var filter = std.mem.zeroes(c.omg_repo_filter);
+    filter.keyword = query.keyword;
+    filter.language = query.language;
+    filter.sort = switch (query.sort) {
+        .created => c.OMG_SORT_DEFAULT,
+        .stars => c.OMG_SORT_STARS,
+        .name => c.OMG_SORT_NAME,
+    };
+
+    if (is_star) {
+        var rows = try StarWriter.init(query.format);
+        const err = c.omg_query_starred_repos_each(ctx, &filter, visitStar, &rows);
+        try rows.finish();
+        try checkErr(err);
+    } else {
+        var rows = try RepoWriter.init(query.format);
+        const err = c.omg_query_created_repos_each(ctx, &filter, visitRepo, &rows);
+        try rows.finish();
+        try checkErr(err);
+    }
+}
+
+// One row per file of each gist.
+const GistRow = struct {
+    id: []const u8,
+    filename: ?[]const u8,
+    language: ?[]const u8,
+    size: usize,
+    description: ?[]const u8,
+    created_at: ?[]const u8,
+    raw_url: ?[]const u8,
+};
+
+const GistWriter = RowWriter(GistRow, &[_]Column{
+    .{ .field = "filename", .title = "File", .width = 30 },
+    .{ .field = "language", .title = "Language", .width = 12 },
+    .{ .field = "created_at", .title = "Created At", .width = 19 },
+    .{ .field = "description", .title = "Description", .width = 80 },
+});
+
+fn visitGist(gist: [*c]const c.omg_gist, userdata: ?*anyopaque) callconv(.C) bool {
+    const rows: *GistWriter = @ptrCast(@alignCast(userdata));
+    const file = gist.*.file;
+    return rows.write(.{
+        .id = std.mem.span(gist.*.id),
+        .filename = optionalSpan(file.filename),
+        .language = optionalSpan(file.language),
+        .size = file.size,
+        .description = optionalSpan(gist.*.description),
+        .created_at = optionalSpan(gist.*.created_at),
+        .raw_url = optionalSpan(file.raw_url),
+    });
+}
+
+// gists [keyword], keyword matches description or filename
+fn processGists(ctx: c.omg_context, is_star: bool, query: Query) !void {
+    var filter = std.mem.zeroes(c.omg_gist_filter);
+    filter.keyword = query.keyword;
+    filter.language = query.language;
+    filter.sort = switch (query.sort) {
+        .created => c.OMG_SORT_DEFAULT,
+        .name => c.OMG_SORT_NAME,
+        .stars => return error.SortNotSupported,
+    };
+
+    var rows = try GistWriter.init(query.format);
+    const err = c.omg_query_gists_each(ctx, is_star, &filter, visitGist, &rows);
+    try rows.finish();
+    try checkErr(err);
+}
@@ -163,6 +163,1684 @@ unsigned char core_create_table_sql[] = {
   0x4f, 0x4e, 0x20, 0x67, 0x69, 0x73, 0x74, 0x2e, 0x69, 0x64, 0x20, 0x3d,
   0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64,
   0x5f, 0x67, 0x69, 0x73, 0x74, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69,
-  0x64, 0x3b, 0x0a, 0x00
+  0x64, 0x3b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x53, 0x74, 0x61, 0x72, 0x20,
+  0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x6f, 0x6e, 0x65,
+  0x20, 0x72, 0x6f, 0x77, 0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x64, 0x61, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x69, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2e, 0x0a, 0x2d, 0x2d, 0x20,
+  0x64, 0x61, 0x79, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x61, 0x79,
+  0x73, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x78,
+  0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x28, 0x55, 0x54, 0x43, 0x29,
+  0x2e, 0x0a, 0x2d, 0x2d, 0x20, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72,
+  0x73, 0x20, 0x75, 0x70, 0x73, 0x65, 0x72, 0x74, 0x20, 0x72, 0x61, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x49, 0x4e, 0x53,
+  0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41,
+  0x43, 0x45, 0x2c, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x63, 0x6f,
+  0x6e, 0x66, 0x6c, 0x69, 0x63, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x0a, 0x2d, 0x2d, 0x20,
+  0x6f, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x50, 0x53, 0x45, 0x52, 0x54,
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x61, 0x76, 0x65, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x73, 0x20, 0x66, 0x69, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
+  0x65, 0x6d, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54,
+  0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x28, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20,
+  0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61,
+  0x79, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+  0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41,
+  0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x28, 0x72, 0x65, 0x70, 0x6f,
+  0x5f, 0x69, 0x64, 0x2c, 0x20, 0x64, 0x61, 0x79, 0x29, 0x0a, 0x29, 0x20,
+  0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49,
+  0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54,
+  0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f,
+  0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52,
+  0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49,
+  0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54,
+  0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x28, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x64, 0x61, 0x79, 0x2c, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x6e,
+  0x65, 0x77, 0x2e, 0x69, 0x64, 0x2c, 0x20, 0x43, 0x41, 0x53, 0x54, 0x28,
+  0x73, 0x74, 0x72, 0x66, 0x74, 0x69, 0x6d, 0x65, 0x28, 0x27, 0x25, 0x73,
+  0x27, 0x2c, 0x20, 0x27, 0x6e, 0x6f, 0x77, 0x27, 0x29, 0x20, 0x41, 0x53,
+  0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x29, 0x20, 0x2f, 0x20,
+  0x38, 0x36, 0x34, 0x30, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e,
+  0x65, 0x77, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x6e, 0x65, 0x77,
+  0x2e, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x4e,
+  0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49, 0x43, 0x54, 0x20, 0x28, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x64, 0x61, 0x79, 0x29,
+  0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x54, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64,
+  0x65, 0x64, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+  0x6b, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x65,
+  0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e, 0x66, 0x6f, 0x72, 0x6b,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f, 0x75,
+  0x70, 0x64, 0x61, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20,
+  0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x20, 0x4f, 0x46, 0x20, 0x73, 0x74,
+  0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72,
+  0x65, 0x70, 0x6f, 0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x6e, 0x65, 0x77,
+  0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x49, 0x53, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a,
+  0x65, 0x72, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x4f, 0x52, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x66, 0x6f, 0x72,
+  0x6b, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x49, 0x53, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x66, 0x6f, 0x72, 0x6b,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49,
+  0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54,
+  0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x28, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x64, 0x61, 0x79, 0x2c, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x6e,
+  0x65, 0x77, 0x2e, 0x69, 0x64, 0x2c, 0x20, 0x43, 0x41, 0x53, 0x54, 0x28,
+  0x73, 0x74, 0x72, 0x66, 0x74, 0x69, 0x6d, 0x65, 0x28, 0x27, 0x25, 0x73,
+  0x27, 0x2c, 0x20, 0x27, 0x6e, 0x6f, 0x77, 0x27, 0x29, 0x20, 0x41, 0x53,
+  0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x29, 0x20, 0x2f, 0x20,
+  0x38, 0x36, 0x34, 0x30, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e,
+  0x65, 0x77, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x6e, 0x65, 0x77,
+  0x2e, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x4e,
+  0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49, 0x43, 0x54, 0x20, 0x28, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x64, 0x61, 0x79, 0x29,
+  0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x54, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64,
+  0x65, 0x64, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+  0x6b, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x65,
+  0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e, 0x66, 0x6f, 0x72, 0x6b,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f, 0x64,
+  0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20,
+  0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20,
+  0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x57, 0x48, 0x45, 0x52,
+  0x45, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b,
+  0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41, 0x42,
+  0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58,
+  0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65,
+  0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55,
+  0x4c, 0x4c, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x41, 0x54, 0x45, 0x20, 0x4e,
+  0x4f, 0x43, 0x41, 0x53, 0x45, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60,
+  0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x60, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x41, 0x54, 0x45, 0x20, 0x4e,
+  0x4f, 0x43, 0x41, 0x53, 0x45, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x61, 0x77, 0x5f, 0x75, 0x72, 0x6c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x73, 0x69, 0x7a, 0x65, 0x60, 0x20,
+  0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b, 0x45, 0x59,
+  0x20, 0x28, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x66,
+  0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x0a, 0x29, 0x20, 0x57,
+  0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x69, 0x64, 0x78, 0x5f, 0x67, 0x69,
+  0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x6c, 0x61, 0x6e, 0x67,
+  0x75, 0x61, 0x67, 0x65, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x60,
+  0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x60, 0x29, 0x3b, 0x0a,
+  0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x49, 0x4e, 0x44, 0x45, 0x58,
+  0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53,
+  0x54, 0x53, 0x20, 0x69, 0x64, 0x78, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f,
+  0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x4f, 0x4e, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c,
+  0x65, 0x20, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x64, 0x65,
+  0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44,
+  0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x67, 0x69, 0x73, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x5f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20,
+  0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c,
+  0x64, 0x2e, 0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a,
+  0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45,
+  0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53,
+  0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x20,
+  0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x6b, 0x65, 0x79, 0x60, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59,
+  0x20, 0x4b, 0x45, 0x59, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x60, 0x0a, 0x29, 0x20, 0x57, 0x49, 0x54, 0x48,
+  0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49, 0x44, 0x3b, 0x0a, 0x0a,
+  0x2d, 0x2d, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x65,
+  0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x2f, 0x67,
+  0x69, 0x73, 0x74, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x20, 0x6f,
+  0x72, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2e, 0x0a, 0x43,
+  0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45,
+  0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49,
+  0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72,
+  0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58,
+  0x49, 0x53, 0x54, 0x53, 0x20, 0x28, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54,
+  0x20, 0x31, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x69, 0x64, 0x20, 0x3d, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x3b,
+  0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54,
+  0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46,
+  0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a,
+  0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45,
+  0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x57, 0x48, 0x45,
+  0x4e, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53,
+  0x20, 0x28, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x31, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72,
+  0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x20, 0x57, 0x48, 0x45,
+  0x52, 0x45, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d,
+  0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64,
+  0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x20, 0x57, 0x48, 0x45,
+  0x52, 0x45, 0x20, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45,
+  0x52, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x28, 0x53, 0x45,
+  0x4c, 0x45, 0x43, 0x54, 0x20, 0x31, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x67,
+  0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64,
+  0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x29, 0x0a, 0x42, 0x45,
+  0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45,
+  0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x69,
+  0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73, 0x74,
+  0x5f, 0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43,
+  0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45,
+  0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49,
+  0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58,
+  0x49, 0x53, 0x54, 0x53, 0x20, 0x28, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54,
+  0x20, 0x31, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x67, 0x69, 0x73, 0x74, 0x5f,
+  0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x69, 0x64, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x69, 0x64, 0x20, 0x3d, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x3b,
+  0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x65, 0x74, 0x73, 0x2c,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x70, 0x65, 0x72,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x72, 0x6f, 0x77,
+  0x2c, 0x20, 0x6b, 0x65, 0x79, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x0a, 0x2d,
+  0x2d, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x4a,
+  0x53, 0x4f, 0x4e, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x20, 0x73,
+  0x65, 0x71, 0x20, 0x67, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x6f, 0x6e, 0x20,
+  0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x2c, 0x20, 0x73, 0x6f, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x61, 0x0a, 0x2d, 0x2d, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x73,
+  0x65, 0x71, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x73, 0x65, 0x74, 0x2e, 0x20, 0x54, 0x72, 0x69,
+  0x67, 0x67, 0x65, 0x72, 0x73, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74,
+  0x2c, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x49, 0x4e, 0x53, 0x45,
+  0x52, 0x54, 0x20, 0x4f, 0x52, 0x0a, 0x2d, 0x2d, 0x20, 0x52, 0x45, 0x50,
+  0x4c, 0x41, 0x43, 0x45, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x74, 0x72,
+  0x69, 0x67, 0x67, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x76, 0x65,
+  0x72, 0x72, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x61,
+  0x6e, 0x20, 0x55, 0x50, 0x53, 0x45, 0x52, 0x54, 0x20, 0x66, 0x69, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41,
+  0x54, 0x45, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67,
+  0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x71, 0x20, 0x69,
+  0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41,
+  0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x41, 0x55, 0x54, 0x4f, 0x49,
+  0x4e, 0x43, 0x52, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54,
+  0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x55, 0x4e, 0x49, 0x51,
+  0x55, 0x45, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77,
+  0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x29, 0x3b, 0x0a, 0x0a, 0x43, 0x52,
+  0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52,
+  0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53,
+  0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e,
+  0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20,
+  0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27,
+  0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79,
+  0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e,
+  0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28,
+  0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x2c, 0x20,
+  0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e,
+  0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0a, 0x41, 0x46,
+  0x54, 0x45, 0x52, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x20, 0x4f,
+  0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x57,
+  0x48, 0x45, 0x4e, 0x20, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x66, 0x75, 0x6c,
+  0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
+  0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+  0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x64, 0x5f, 0x61, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c,
+  0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x5f,
+  0x61, 0x74, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x73, 0x74, 0x61, 0x72,
+  0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65,
+  0x72, 0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x66, 0x6f, 0x72, 0x6b,
+  0x73, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x6f, 0x6c, 0x64,
+  0x2e, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x68,
+  0x6f, 0x6d, 0x65, 0x70, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x6f, 0x6c, 0x64,
+  0x2e, 0x60, 0x73, 0x69, 0x7a, 0x65, 0x60, 0x29, 0x0a, 0x20, 0x20, 0x49,
+  0x53, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x66,
+  0x75, 0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x6e, 0x65,
+  0x77, 0x2e, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x70, 0x72, 0x69, 0x76, 0x61,
+  0x74, 0x65, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x63, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x6c, 0x69,
+  0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x70,
+  0x75, 0x73, 0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x2c, 0x20, 0x6e, 0x65,
+  0x77, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73,
+  0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e,
+  0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x72, 0x73, 0x5f, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x6c,
+  0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x68, 0x6f, 0x6d,
+  0x65, 0x70, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x60,
+  0x73, 0x69, 0x7a, 0x65, 0x60, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20,
+  0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c,
+  0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65,
+  0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72,
+  0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49,
+  0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20,
+  0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20,
+  0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x2c,
+  0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28,
+  0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e,
+  0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54,
+  0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41,
+  0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20,
+  0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a,
+  0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52,
+  0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f,
+  0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e,
+  0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53,
+  0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28,
+  0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79,
+  0x2c, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45,
+  0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x29, 0x2c, 0x20, 0x31,
+  0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45,
+  0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20,
+  0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54,
+  0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65,
+  0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x0a,
+  0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54,
+  0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72,
+  0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47,
+  0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54,
+  0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74,
+  0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74,
+  0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x20,
+  0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20,
+  0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79,
+  0x28, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52,
+  0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62,
+  0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55,
+  0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61,
+  0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x2c, 0x20,
+  0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e,
+  0x65, 0x77, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x29, 0x29,
+  0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41,
+  0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49,
+  0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0a, 0x41,
+  0x46, 0x54, 0x45, 0x52, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x20,
+  0x4f, 0x46, 0x20, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x61,
+  0x74, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61,
+  0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x57, 0x48,
+  0x45, 0x4e, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x72,
+  0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x49, 0x53, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x6e, 0x65, 0x77, 0x2e, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64,
+  0x5f, 0x61, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f,
+  0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20,
+  0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f,
+  0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54,
+  0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f,
+  0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27,
+  0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x64,
+  0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20,
+  0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57,
+  0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27,
+  0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f,
+  0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e,
+  0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77,
+  0x5f, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65,
+  0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56,
+  0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69,
+  0x64, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b,
+  0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49,
+  0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e,
+  0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f,
+  0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48,
+  0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72,
+  0x65, 0x70, 0x6f, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77,
+  0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f,
+  0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f,
+  0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d,
+  0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x65, 0x70, 0x6f,
+  0x5f, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47,
+  0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44,
+  0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45,
+  0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d,
+  0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f,
+  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67,
+  0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b,
+  0x65, 0x79, 0x2c, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c,
+  0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x27, 0x2c,
+  0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28,
+  0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x29,
+  0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a,
+  0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47,
+  0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58,
+  0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f,
+  0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52,
+  0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49,
+  0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45,
+  0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62,
+  0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b,
+  0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20,
+  0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c,
+  0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53,
+  0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x27,
+  0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79,
+  0x28, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45,
+  0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20,
+  0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0a,
+  0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45,
+  0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x2c, 0x20, 0x6f,
+  0x6c, 0x64, 0x2e, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x60, 0x70, 0x75, 0x62,
+  0x6c, 0x69, 0x63, 0x60, 0x29, 0x0a, 0x20, 0x20, 0x49, 0x53, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x63, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e,
+  0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
+  0x20, 0x6e, 0x65, 0x77, 0x2e, 0x60, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63,
+  0x60, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57,
+  0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27,
+  0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x27, 0x20, 0x41, 0x4e,
+  0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20,
+  0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e,
+  0x65, 0x77, 0x2e, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f,
+  0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f,
+  0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d,
+  0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f,
+  0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e,
+  0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a,
+  0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47,
+  0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58,
+  0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f,
+  0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52,
+  0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49,
+  0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45,
+  0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62,
+  0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b,
+  0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20,
+  0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c,
+  0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x64, 0x65,
+  0x6c, 0x65, 0x74, 0x65, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27,
+  0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x27, 0x2c, 0x20, 0x6a,
+  0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c,
+  0x64, 0x2e, 0x69, 0x64, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45,
+  0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20,
+  0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e,
+  0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x42,
+  0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c,
+  0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45,
+  0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x20, 0x41,
+  0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d,
+  0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28,
+  0x6e, 0x65, 0x77, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x2c,
+  0x20, 0x6e, 0x65, 0x77, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d,
+  0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45,
+  0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74,
+  0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c,
+  0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69,
+  0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x2c, 0x20, 0x6a, 0x73,
+  0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77,
+  0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x6e, 0x65,
+  0x77, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x29,
+  0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41,
+  0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49,
+  0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69,
+  0x6c, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67,
+  0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45,
+  0x52, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c,
+  0x65, 0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x28, 0x6f, 0x6c, 0x64, 0x2e,
+  0x60, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x60, 0x2c, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x61, 0x77, 0x5f, 0x75, 0x72, 0x6c, 0x2c,
+  0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x60, 0x73, 0x69, 0x7a, 0x65, 0x60, 0x29,
+  0x0a, 0x20, 0x20, 0x49, 0x53, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x28, 0x6e,
+  0x65, 0x77, 0x2e, 0x60, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65,
+  0x60, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x61, 0x77, 0x5f, 0x75,
+  0x72, 0x6c, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x60, 0x73, 0x69, 0x7a,
+  0x65, 0x60, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f,
+  0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20,
+  0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69,
+  0x6c, 0x65, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f,
+  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x66, 0x69,
+  0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77,
+  0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f,
+  0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+  0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69,
+  0x64, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e,
+  0x61, 0x6d, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47,
+  0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69,
+  0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65,
+  0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54,
+  0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20,
+  0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c,
+  0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x5f, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f,
+  0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e,
+  0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x6f, 0x6c, 0x64,
+  0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49,
+  0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20,
+  0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f,
+  0x6d, 0x67, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x65,
+  0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69,
+  0x64, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x6e,
+  0x61, 0x6d, 0x65, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45, 0x4e,
+  0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54,
+  0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f,
+  0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52,
+  0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67,
+  0x69, 0x73, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f,
+  0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20,
+  0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64,
+  0x5f, 0x67, 0x69, 0x73, 0x74, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f,
+  0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e,
+  0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54,
+  0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f,
+  0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27,
+  0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x67, 0x69,
+  0x73, 0x74, 0x5f, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x64,
+  0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20,
+  0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67, 0x69,
+  0x73, 0x74, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57,
+  0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27,
+  0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f,
+  0x67, 0x69, 0x73, 0x74, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f,
+  0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e,
+  0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x67,
+  0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c,
+  0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77,
+  0x5f, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65,
+  0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56,
+  0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69,
+  0x64, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b,
+  0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49,
+  0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e,
+  0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73,
+  0x74, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f,
+  0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48,
+  0x45, 0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67,
+  0x69, 0x73, 0x74, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77,
+  0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x67, 0x69,
+  0x73, 0x74, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f,
+  0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f,
+  0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d,
+  0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69,
+  0x73, 0x74, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x67, 0x69, 0x73, 0x74,
+  0x5f, 0x69, 0x64, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47,
+  0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74,
+  0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44,
+  0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45,
+  0x52, 0x45, 0x20, 0x74, 0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d,
+  0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69,
+  0x73, 0x74, 0x27, 0x20, 0x41, 0x4e, 0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f,
+  0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73,
+  0x74, 0x5f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67,
+  0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b,
+  0x65, 0x79, 0x2c, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x64, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c,
+  0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x67, 0x69, 0x73, 0x74, 0x27, 0x2c,
+  0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28,
+  0x6f, 0x6c, 0x64, 0x2e, 0x67, 0x69, 0x73, 0x74, 0x5f, 0x69, 0x64, 0x29,
+  0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a,
+  0x2d, 0x2d, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4d, 0x45, 0x20, 0x6f, 0x66,
+  0x20, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x7a, 0x6c,
+  0x69, 0x62, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65,
+  0x64, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41,
+  0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x61, 0x64, 0x6d, 0x65, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67,
+  0x65, 0x72, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b,
+  0x45, 0x59, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x70,
+  0x75, 0x73, 0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f,
+  0x72, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x66, 0x65, 0x74, 0x63,
+  0x68, 0x65, 0x64, 0x2c, 0x20, 0x72, 0x65, 0x66, 0x65, 0x74, 0x63, 0x68,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73,
+  0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x74, 0x61, 0x67, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x20, 0x4e,
+  0x55, 0x4c, 0x4c, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4d,
+  0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x20, 0x62, 0x6c, 0x6f, 0x62, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2d, 0x2d, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66,
+  0x6f, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73,
+  0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x73, 0x69, 0x7a,
+  0x65, 0x60, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5f,
+  0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x29, 0x3b, 0x0a, 0x0a,
+  0x2d, 0x2d, 0x20, 0x50, 0x6c, 0x61, 0x69, 0x6e, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4d, 0x45, 0x73,
+  0x2c, 0x20, 0x72, 0x6f, 0x77, 0x69, 0x64, 0x20, 0x69, 0x73, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2e, 0x20, 0x52, 0x6f, 0x77, 0x73,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6e,
+  0x63, 0x2c, 0x0a, 0x2d, 0x2d, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74,
+  0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x72, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x74, 0x72, 0x69,
+  0x67, 0x67, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x72,
+  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x73,
+  0x6f, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x2d, 0x2d, 0x20, 0x73, 0x63, 0x68,
+  0x65, 0x6d, 0x61, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x65,
+  0x74, 0x75, 0x70, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x2e,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x56, 0x49, 0x52, 0x54,
+  0x55, 0x41, 0x4c, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46,
+  0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x5f, 0x66,
+  0x74, 0x73, 0x20, 0x55, 0x53, 0x49, 0x4e, 0x47, 0x20, 0x66, 0x74, 0x73,
+  0x35, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x65, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x6b,
+  0x65, 0x6e, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x70, 0x6f, 0x72,
+  0x74, 0x65, 0x72, 0x20, 0x75, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x36,
+  0x31, 0x27, 0x0a, 0x29, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54,
+  0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46,
+  0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x5f, 0x75,
+  0x6e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74,
+  0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x55, 0x50, 0x44, 0x41,
+  0x54, 0x45, 0x20, 0x4f, 0x46, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61,
+  0x64, 0x6d, 0x65, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f,
+  0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65,
+  0x5f, 0x66, 0x74, 0x73, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72,
+  0x6f, 0x77, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b,
+  0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49,
+  0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72,
+  0x65, 0x61, 0x64, 0x6d, 0x65, 0x5f, 0x75, 0x6e, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54,
+  0x45, 0x52, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x0a,
+  0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x5f, 0x66, 0x74, 0x73,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x6f, 0x77, 0x69, 0x64,
+  0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52,
+  0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52,
+  0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53,
+  0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d,
+  0x65, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74,
+  0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45, 0x4c, 0x45,
+  0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x20,
+  0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69,
+  0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x3b, 0x0a,
+  0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45,
+  0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x20,
+  0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69,
+  0x64, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x74, 0x6f, 0x70, 0x69, 0x63, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x43, 0x4f, 0x4c, 0x4c,
+  0x41, 0x54, 0x45, 0x20, 0x4e, 0x4f, 0x43, 0x41, 0x53, 0x45, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20,
+  0x4b, 0x45, 0x59, 0x20, 0x28, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64,
+  0x2c, 0x20, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x29, 0x0a, 0x29, 0x20, 0x57,
+  0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x69, 0x64, 0x78, 0x5f, 0x74, 0x6f,
+  0x70, 0x69, 0x63, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x20, 0x28, 0x74,
+  0x6f, 0x70, 0x69, 0x63, 0x29, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41,
+  0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49,
+  0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x74, 0x6f,
+  0x70, 0x69, 0x63, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52,
+  0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x74, 0x6f, 0x70, 0x69, 0x63, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c,
+  0x64, 0x2e, 0x69, 0x64, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a,
+  0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47,
+  0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58,
+  0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74,
+  0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52,
+  0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x0a, 0x42, 0x45, 0x47, 0x49,
+  0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45,
+  0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74, 0x62,
+  0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x27, 0x20, 0x41, 0x4e, 0x44,
+  0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x6a,
+  0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65,
+  0x77, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x6e,
+  0x65, 0x77, 0x2e, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e,
+  0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28,
+  0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x74, 0x6f,
+  0x70, 0x69, 0x63, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x74, 0x6f,
+  0x70, 0x69, 0x63, 0x29, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47,
+  0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x5f, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74,
+  0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45, 0x4c, 0x45,
+  0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x0a, 0x42, 0x45, 0x47,
+  0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54,
+  0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6f, 0x67, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x74,
+  0x62, 0x6c, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x27, 0x20, 0x41, 0x4e,
+  0x44, 0x20, 0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20,
+  0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6f,
+  0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x74, 0x6f, 0x70, 0x69, 0x63, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49,
+  0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x6c, 0x6f, 0x67, 0x20, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20,
+  0x72, 0x6f, 0x77, 0x5f, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x64, 0x65, 0x6c,
+  0x65, 0x74, 0x65, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x27, 0x6f,
+  0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x74, 0x6f, 0x70, 0x69,
+  0x63, 0x27, 0x2c, 0x20, 0x6a, 0x73, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72,
+  0x61, 0x79, 0x28, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x69, 0x64, 0x2c, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x74, 0x6f, 0x70, 0x69,
+  0x63, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b,
+  0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x46, 0x61, 0x63, 0x65, 0x74, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x61,
+  0x72, 0x72, 0x65, 0x64, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61,
+  0x72, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x6d, 0x61, 0x69,
+  0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x0a, 0x2d, 0x2d, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x73, 0x20, 0x62,
+  0x65, 0x6c, 0x6f, 0x77, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f,
+  0x73, 0x74, 0x73, 0x20, 0x4f, 0x28, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x29, 0x2e, 0x20, 0x41, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x2d, 0x2d,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x6e, 0x63, 0x65,
+  0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x74, 0x61,
+  0x72, 0x2f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x72, 0x6f,
+  0x77, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x2c, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x0a, 0x2d, 0x2d,
+  0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x2f, 0x6c, 0x69,
+  0x63, 0x65, 0x6e, 0x73, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x27, 0x27,
+  0x2e, 0x20, 0x5a, 0x65, 0x72, 0x6f, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6b, 0x65, 0x70, 0x74, 0x2c, 0x20,
+  0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x73, 0x6b, 0x69, 0x70,
+  0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54,
+  0x45, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74,
+  0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x5f, 0x73, 0x74,
+  0x61, 0x72, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60,
+  0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x28,
+  0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63,
+  0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x29,
+  0x0a, 0x29, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x52,
+  0x4f, 0x57, 0x49, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54,
+  0x45, 0x20, 0x56, 0x49, 0x45, 0x57, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x41,
+  0x53, 0x0a, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x31, 0x20, 0x41,
+  0x53, 0x20, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x0a, 0x55, 0x4e, 0x49, 0x4f, 0x4e, 0x20, 0x41,
+  0x4c, 0x4c, 0x0a, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x30, 0x2c,
+  0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x46, 0x52, 0x4f,
+  0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45,
+  0x41, 0x54, 0x45, 0x20, 0x56, 0x49, 0x45, 0x57, 0x20, 0x49, 0x46, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65,
+  0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x41, 0x53, 0x0a, 0x53,
+  0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x69, 0x64, 0x20, 0x41, 0x53, 0x20,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x2c, 0x20, 0x27, 0x6c, 0x61,
+  0x6e, 0x67, 0x27, 0x20, 0x41, 0x53, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74,
+  0x2c, 0x20, 0x63, 0x6f, 0x61, 0x6c, 0x65, 0x73, 0x63, 0x65, 0x28, 0x6c,
+  0x61, 0x6e, 0x67, 0x2c, 0x20, 0x27, 0x27, 0x29, 0x20, 0x41, 0x53, 0x20,
+  0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x20, 0x46, 0x52, 0x4f, 0x4d,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x55, 0x4e,
+  0x49, 0x4f, 0x4e, 0x20, 0x41, 0x4c, 0x4c, 0x0a, 0x53, 0x45, 0x4c, 0x45,
+  0x43, 0x54, 0x20, 0x69, 0x64, 0x2c, 0x20, 0x27, 0x6c, 0x69, 0x63, 0x65,
+  0x6e, 0x73, 0x65, 0x27, 0x2c, 0x20, 0x63, 0x6f, 0x61, 0x6c, 0x65, 0x73,
+  0x63, 0x65, 0x28, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20,
+  0x27, 0x27, 0x29, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x55, 0x4e, 0x49, 0x4f, 0x4e, 0x20,
+  0x41, 0x4c, 0x4c, 0x0a, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x69,
+  0x64, 0x2c, 0x20, 0x27, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x27,
+  0x2c, 0x20, 0x43, 0x41, 0x53, 0x45, 0x20, 0x57, 0x48, 0x45, 0x4e, 0x20,
+  0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20, 0x54, 0x48, 0x45, 0x4e,
+  0x20, 0x27, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x27, 0x20, 0x45,
+  0x4c, 0x53, 0x45, 0x20, 0x27, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x27,
+  0x20, 0x45, 0x4e, 0x44, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x3b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20,
+  0x44, 0x65, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x72,
+  0x75, 0x6e, 0x20, 0x42, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x67, 0x6f, 0x65, 0x73, 0x20, 0x61,
+  0x77, 0x61, 0x79, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x79,
+  0x20, 0x73, 0x65, 0x65, 0x20, 0x69, 0x74, 0x20, 0x6e, 0x6f, 0x20, 0x6d,
+  0x61, 0x74, 0x74, 0x65, 0x72, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a,
+  0x2d, 0x2d, 0x20, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x74, 0x72, 0x69,
+  0x67, 0x67, 0x65, 0x72, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73,
+  0x69, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6a,
+  0x6f, 0x69, 0x6e, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20,
+  0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74,
+  0x5f, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x73,
+  0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49, 0x4e,
+  0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49,
+  0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65,
+  0x74, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20,
+  0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x60, 0x2c, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x4c,
+  0x45, 0x43, 0x54, 0x20, 0x31, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74,
+  0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x31,
+  0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49,
+  0x43, 0x54, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c,
+  0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41,
+  0x54, 0x45, 0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x60, 0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60,
+  0x20, 0x2b, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e,
+  0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x73,
+  0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74,
+  0x65, 0x0a, 0x42, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x20, 0x44, 0x45, 0x4c,
+  0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x73,
+  0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a,
+  0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e,
+  0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74,
+  0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66,
+  0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x60, 0x2c, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x4c, 0x45,
+  0x43, 0x54, 0x20, 0x31, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c,
+  0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x2d, 0x31,
+  0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49,
+  0x43, 0x54, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c,
+  0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41,
+  0x54, 0x45, 0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x60, 0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60,
+  0x20, 0x2b, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e,
+  0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x73, 0x65, 0x72,
+  0x74, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x49, 0x4e, 0x53, 0x45,
+  0x52, 0x54, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42,
+  0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53,
+  0x45, 0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20,
+  0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61,
+  0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60,
+  0x2c, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43,
+  0x54, 0x20, 0x30, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20,
+  0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x31, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x69, 0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49, 0x43, 0x54,
+  0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66,
+  0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45,
+  0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60,
+  0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x20, 0x2b,
+  0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e, 0x60, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47,
+  0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x63, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x64, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x0a,
+  0x42, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54,
+  0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45,
+  0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45,
+  0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20, 0x28,
+  0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63,
+  0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c,
+  0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54,
+  0x20, 0x30, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x2d, 0x31, 0x20, 0x46,
+  0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49, 0x43, 0x54,
+  0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66,
+  0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41, 0x54, 0x45,
+  0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60,
+  0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x20, 0x2b,
+  0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e, 0x60, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52, 0x49, 0x47,
+  0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x0a, 0x41, 0x46, 0x54,
+  0x45, 0x52, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x4e,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45,
+  0x47, 0x49, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45,
+  0x52, 0x54, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20, 0x28,
+  0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63,
+  0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c,
+  0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54,
+  0x20, 0x6c, 0x2e, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20,
+  0x76, 0x2e, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x76, 0x2e, 0x60,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x6b,
+  0x20, 0x6c, 0x2c, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f,
+  0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x76, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57,
+  0x48, 0x45, 0x52, 0x45, 0x20, 0x6c, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x69, 0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x20,
+  0x41, 0x4e, 0x44, 0x20, 0x76, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69,
+  0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f,
+  0x4e, 0x46, 0x4c, 0x49, 0x43, 0x54, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73,
+  0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20,
+  0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x29, 0x20, 0x44, 0x4f, 0x20,
+  0x55, 0x50, 0x44, 0x41, 0x54, 0x45, 0x20, 0x53, 0x45, 0x54, 0x20, 0x60,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x60, 0x20, 0x2b, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75,
+  0x64, 0x65, 0x64, 0x2e, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b,
+  0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54,
+  0x45, 0x20, 0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46,
+  0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63,
+  0x65, 0x74, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x64, 0x65, 0x6c, 0x65,
+  0x74, 0x65, 0x0a, 0x42, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x20, 0x44, 0x45,
+  0x4c, 0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x49, 0x4e,
+  0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f,
+  0x66, 0x61, 0x63, 0x65, 0x74, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74,
+  0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x60, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x60, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6c, 0x2e, 0x69, 0x73,
+  0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x76, 0x2e, 0x66, 0x61, 0x63,
+  0x65, 0x74, 0x2c, 0x20, 0x76, 0x2e, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x60, 0x2c, 0x20, 0x2d, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72,
+  0x65, 0x70, 0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x6c, 0x2c, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63,
+  0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x76, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45,
+  0x20, 0x6c, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d,
+  0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x20, 0x41, 0x4e, 0x44, 0x20,
+  0x76, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20,
+  0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c, 0x49,
+  0x43, 0x54, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c,
+  0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44, 0x41,
+  0x54, 0x45, 0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x60, 0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60,
+  0x20, 0x2b, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e,
+  0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45, 0x4e, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x5f, 0x62,
+  0x65, 0x66, 0x6f, 0x72, 0x65, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+  0x0a, 0x42, 0x45, 0x46, 0x4f, 0x52, 0x45, 0x20, 0x55, 0x50, 0x44, 0x41,
+  0x54, 0x45, 0x20, 0x4f, 0x46, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20,
+  0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x69,
+  0x76, 0x61, 0x74, 0x65, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x28, 0x6f,
+  0x6c, 0x64, 0x2e, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6f, 0x6c, 0x64,
+  0x2e, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6f, 0x6c,
+  0x64, 0x2e, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x29, 0x20, 0x49,
+  0x53, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x6c,
+  0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x6c, 0x69, 0x63,
+  0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x70, 0x72,
+  0x69, 0x76, 0x61, 0x74, 0x65, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20,
+  0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20, 0x28, 0x69, 0x73, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c,
+  0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x60, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6c, 0x2e,
+  0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x76, 0x2e, 0x66,
+  0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x76, 0x2e, 0x60, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x60, 0x2c, 0x20, 0x2d, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x6c,
+  0x2c, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66,
+  0x61, 0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x76,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45,
+  0x52, 0x45, 0x20, 0x6c, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64,
+  0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x20, 0x41, 0x4e,
+  0x44, 0x20, 0x76, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20,
+  0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46,
+  0x4c, 0x49, 0x43, 0x54, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61,
+  0x72, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50,
+  0x44, 0x41, 0x54, 0x45, 0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x60, 0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x60, 0x20, 0x2b, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65,
+  0x64, 0x2e, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45,
+  0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20,
+  0x54, 0x52, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74,
+  0x5f, 0x61, 0x66, 0x74, 0x65, 0x72, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74,
+  0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x55, 0x50, 0x44, 0x41,
+  0x54, 0x45, 0x20, 0x4f, 0x46, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20,
+  0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x69,
+  0x76, 0x61, 0x74, 0x65, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x0a, 0x57, 0x48, 0x45, 0x4e, 0x20, 0x28, 0x6f,
+  0x6c, 0x64, 0x2e, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6f, 0x6c, 0x64,
+  0x2e, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6f, 0x6c,
+  0x64, 0x2e, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x29, 0x20, 0x49,
+  0x53, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x28, 0x6e, 0x65, 0x77, 0x2e, 0x6c,
+  0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x6c, 0x69, 0x63,
+  0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x70, 0x72,
+  0x69, 0x76, 0x61, 0x74, 0x65, 0x29, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20,
+  0x49, 0x4e, 0x54, 0x4f, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70,
+  0x6f, 0x5f, 0x66, 0x61, 0x63, 0x65, 0x74, 0x20, 0x28, 0x69, 0x73, 0x5f,
+  0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c,
+  0x20, 0x60, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x60, 0x2c, 0x20, 0x60, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x60, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6c, 0x2e,
+  0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x2c, 0x20, 0x76, 0x2e, 0x66,
+  0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x76, 0x2e, 0x60, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x60, 0x2c, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x70, 0x6f, 0x5f, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x6c, 0x2c,
+  0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x66, 0x61,
+  0x63, 0x65, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x76, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x57, 0x48, 0x45, 0x52,
+  0x45, 0x20, 0x6c, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20,
+  0x3d, 0x20, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x20, 0x41, 0x4e, 0x44,
+  0x20, 0x76, 0x2e, 0x72, 0x65, 0x70, 0x6f, 0x5f, 0x69, 0x64, 0x20, 0x3d,
+  0x20, 0x6e, 0x65, 0x77, 0x2e, 0x69, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x4f, 0x4e, 0x20, 0x43, 0x4f, 0x4e, 0x46, 0x4c,
+  0x49, 0x43, 0x54, 0x20, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x74, 0x61, 0x72,
+  0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x74, 0x2c, 0x20, 0x60, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x60, 0x29, 0x20, 0x44, 0x4f, 0x20, 0x55, 0x50, 0x44,
+  0x41, 0x54, 0x45, 0x20, 0x53, 0x45, 0x54, 0x20, 0x60, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x60, 0x20, 0x3d, 0x20, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x60, 0x20, 0x2b, 0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64,
+  0x2e, 0x60, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x60, 0x3b, 0x0a, 0x45, 0x4e,
+  0x44, 0x3b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x69,
+  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x76, 0x69, 0x65, 0x77, 0x65, 0x64,
+  0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x69, 0x65,
+  0x73, 0x2c, 0x20, 0x6b, 0x65, 0x79, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x66, 0x75, 0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x73, 0x69,
+  0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x6d, 0x61, 0x79,
+  0x20, 0x62, 0x65, 0x0a, 0x2d, 0x2d, 0x20, 0x6e, 0x65, 0x69, 0x74, 0x68,
+  0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x72, 0x65, 0x64, 0x20, 0x6e,
+  0x6f, 0x72, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2e, 0x20,
+  0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74,
+  0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x69, 0x74, 0x74, 0x65, 0x72, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x47,
+  0x69, 0x74, 0x48, 0x75, 0x62, 0x0a, 0x2d, 0x2d, 0x20, 0x66, 0x69, 0x6c,
+  0x74, 0x65, 0x72, 0x73, 0x20, 0x60, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x60,
+  0x20, 0x6f, 0x6e, 0x2c, 0x20, 0x60, 0x64, 0x61, 0x74, 0x65, 0x60, 0x20,
+  0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6f,
+  0x72, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x6e,
+  0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x43,
+  0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20,
+  0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54,
+  0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74,
+  0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x5f,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x41,
+  0x54, 0x45, 0x20, 0x4e, 0x4f, 0x43, 0x41, 0x53, 0x45, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x68, 0x61, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x68,
+  0x6f, 0x72, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x64, 0x61, 0x74, 0x65, 0x60, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+  0x6d, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x74,
+  0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x52, 0x49,
+  0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x28, 0x66, 0x75,
+  0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x73, 0x68, 0x61,
+  0x29, 0x0a, 0x29, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20,
+  0x52, 0x4f, 0x57, 0x49, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41,
+  0x54, 0x45, 0x20, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x20, 0x49, 0x46, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x69,
+  0x64, 0x78, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x5f, 0x63, 0x6f,
+  0x6d, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x4f,
+  0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74,
+  0x20, 0x28, 0x66, 0x75, 0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2c,
+  0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x64, 0x5f, 0x61,
+  0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20,
+  0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x5f, 0x66, 0x65, 0x74, 0x63, 0x68,
+  0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x5f,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x50, 0x52,
+  0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x43, 0x4f,
+  0x4c, 0x4c, 0x41, 0x54, 0x45, 0x20, 0x4e, 0x4f, 0x43, 0x41, 0x53, 0x45,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x65,
+  0x64, 0x5f, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x0a, 0x29, 0x20, 0x57, 0x49, 0x54,
+  0x48, 0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49, 0x44, 0x3b, 0x0a,
+  0x0a, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x76, 0x69, 0x65, 0x77, 0x65, 0x64, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x2c,
+  0x20, 0x72, 0x65, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x45, 0x54,
+  0x61, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x66,
+  0x65, 0x74, 0x63, 0x68, 0x2e, 0x0a, 0x2d, 0x2d, 0x20, 0x70, 0x75, 0x62,
+  0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x72,
+  0x61, 0x66, 0x74, 0x73, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45,
+  0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x28, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+  0x72, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b, 0x45,
+  0x59, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x5f,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x41,
+  0x54, 0x45, 0x20, 0x4e, 0x4f, 0x43, 0x41, 0x53, 0x45, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x69, 0x6e, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61,
+  0x67, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 0x61, 0x66,
+  0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64,
+  0x5f, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x29, 0x3b, 0x0a,
+  0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x49, 0x4e, 0x44, 0x45,
+  0x58, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49,
+  0x53, 0x54, 0x53, 0x20, 0x69, 0x64, 0x78, 0x5f, 0x72, 0x65, 0x6c, 0x65,
+  0x61, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x20, 0x4f, 0x4e, 0x20,
+  0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20,
+  0x28, 0x66, 0x75, 0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20,
+  0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x5f, 0x61, 0x74,
+  0x29, 0x3b, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x69, 0x64, 0x78, 0x5f, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73,
+  0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x28, 0x70,
+  0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x29,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41,
+  0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20,
+  0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x74,
+  0x65, 0x67, 0x65, 0x72, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59,
+  0x20, 0x4b, 0x45, 0x59, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x74,
+  0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c,
+  0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+  0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67,
+  0x65, 0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e,
+  0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x75, 0x72, 0x6c, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x0a, 0x29, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45,
+  0x20, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x69, 0x64, 0x78,
+  0x5f, 0x61, 0x73, 0x73, 0x65, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61,
+  0x73, 0x65, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20,
+  0x28, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x69, 0x64, 0x29,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x52,
+  0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54,
+  0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f,
+  0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x64, 0x65, 0x6c, 0x65,
+  0x74, 0x65, 0x0a, 0x41, 0x46, 0x54, 0x45, 0x52, 0x20, 0x44, 0x45, 0x4c,
+  0x45, 0x54, 0x45, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72,
+  0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x0a, 0x42, 0x45, 0x47, 0x49, 0x4e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20,
+  0x46, 0x52, 0x4f, 0x4d, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x72, 0x65, 0x6c,
+  0x65, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x73, 0x73, 0x65, 0x74, 0x20, 0x57,
+  0x48, 0x45, 0x52, 0x45, 0x20, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x5f, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 0x64, 0x2e, 0x69, 0x64,
+  0x3b, 0x0a, 0x45, 0x4e, 0x44, 0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41,
+  0x54, 0x45, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20,
+  0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f,
+  0x6d, 0x67, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x66,
+  0x65, 0x74, 0x63, 0x68, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x75, 0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b, 0x45,
+  0x59, 0x20, 0x43, 0x4f, 0x4c, 0x4c, 0x41, 0x54, 0x45, 0x20, 0x4e, 0x4f,
+  0x43, 0x41, 0x53, 0x45, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x74,
+  0x61, 0x67, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c,
+  0x4c, 0x0a, 0x29, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20,
+  0x52, 0x4f, 0x57, 0x49, 0x44, 0x3b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x54,
+  0x72, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x61, 0x67, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e,
+  0x63, 0x6f, 0x6d, 0x2c, 0x20, 0x6b, 0x65, 0x79, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x73, 0x70, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x6c, 0x61, 0x6e,
+  0x67, 0x75, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75,
+  0x61, 0x67, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x2d, 0x2d, 0x20, 0x72,
+  0x61, 0x6e, 0x67, 0x65, 0x2c, 0x20, 0x27, 0x27, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x61, 0x6e, 0x79, 0x2e, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x73, 0x74,
+  0x61, 0x6d, 0x70, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x69,
+  0x78, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x73, 0x2c, 0x20, 0x6e,
+  0x6f, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x0a, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x74, 0x72, 0x79, 0x5f, 0x61, 0x74,
+  0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x47, 0x69, 0x74, 0x48, 0x75,
+  0x62, 0x20, 0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x65, 0x64, 0x20, 0x34,
+  0x32, 0x39, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54,
+  0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20,
+  0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x74,
+  0x72, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x66, 0x65, 0x74, 0x63,
+  0x68, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6f, 0x6b,
+  0x65, 0x6e, 0x5f, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x78, 0x74,
+  0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x78, 0x74,
+  0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x60, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x60, 0x20, 0x74,
+  0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x65,
+  0x64, 0x5f, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x72, 0x79, 0x5f,
+  0x61, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20,
+  0x4b, 0x45, 0x59, 0x20, 0x28, 0x73, 0x70, 0x6f, 0x6b, 0x65, 0x6e, 0x5f,
+  0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20,
+  0x60, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x60, 0x29, 0x0a, 0x29, 0x20, 0x57,
+  0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49, 0x44,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41,
+  0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x74, 0x72,
+  0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x20,
+  0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6f, 0x6b, 0x65, 0x6e,
+  0x5f, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x4e,
+  0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x60, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x60, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x20, 0x69, 0x6e, 0x74,
+  0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c,
+  0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x5f,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x74, 0x61, 0x72, 0x67, 0x61, 0x7a, 0x65, 0x72, 0x73, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+  0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41,
+  0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x28, 0x73, 0x70, 0x6f, 0x6b,
+  0x65, 0x6e, 0x5f, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6c, 0x61, 0x6e,
+  0x67, 0x2c, 0x20, 0x60, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x60, 0x2c, 0x20,
+  0x72, 0x61, 0x6e, 0x6b, 0x29, 0x0a, 0x29, 0x20, 0x57, 0x49, 0x54, 0x48,
+  0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f, 0x57, 0x49, 0x44, 0x3b, 0x0a, 0x0a,
+  0x2d, 0x2d, 0x20, 0x54, 0x72, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
+  0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x6f, 0x6e, 0x65,
+  0x20, 0x72, 0x6f, 0x77, 0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x61, 0x6e,
+  0x6b, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x66,
+  0x65, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x64, 0x61, 0x79, 0x2c, 0x20, 0x61, 0x20, 0x6c,
+  0x61, 0x74, 0x65, 0x72, 0x0a, 0x2d, 0x2d, 0x20, 0x66, 0x65, 0x74, 0x63,
+  0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d,
+  0x65, 0x20, 0x64, 0x61, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63,
+  0x65, 0x73, 0x20, 0x69, 0x74, 0x2e, 0x20, 0x52, 0x65, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x6f,
+  0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x0a, 0x2d, 0x2d, 0x20, 0x6f, 0x6d,
+  0x67, 0x5f, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x6e,
+  0x61, 0x6d, 0x65, 0x2e, 0x20, 0x64, 0x61, 0x79, 0x20, 0x69, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x64, 0x61, 0x79, 0x73, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65,
+  0x20, 0x75, 0x6e, 0x69, 0x78, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20,
+  0x28, 0x55, 0x54, 0x43, 0x29, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x2d,
+  0x2d, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x20, 0x6b, 0x65,
+  0x79, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x73, 0x20, 0x64, 0x61, 0x79, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x74,
+  0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x74, 0x69, 0x6d, 0x65, 0x2d, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x73,
+  0x63, 0x61, 0x6e, 0x73, 0x2e, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45,
+  0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67,
+  0x5f, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x6e, 0x61,
+  0x6d, 0x65, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x20,
+  0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x50, 0x52, 0x49, 0x4d,
+  0x41, 0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x75, 0x6c, 0x6c, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x74,
+  0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c,
+  0x20, 0x55, 0x4e, 0x49, 0x51, 0x55, 0x45, 0x20, 0x43, 0x4f, 0x4c, 0x4c,
+  0x41, 0x54, 0x45, 0x20, 0x4e, 0x4f, 0x43, 0x41, 0x53, 0x45, 0x0a, 0x29,
+  0x3b, 0x0a, 0x0a, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41,
+  0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45,
+  0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x74, 0x72,
+  0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f,
+  0x72, 0x79, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6f,
+  0x6b, 0x65, 0x6e, 0x5f, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x60, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x60, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c,
+  0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x79, 0x20, 0x69,
+  0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e,
+  0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e,
+  0x6b, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f,
+  0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x5f, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x65,
+  0x67, 0x65, 0x72, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x4e, 0x55, 0x4c, 0x4c,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63, 0x65, 0x6e, 0x74,
+  0x5f, 0x73, 0x74, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67,
+  0x65, 0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x52, 0x49, 0x4d,
+  0x41, 0x52, 0x59, 0x20, 0x4b, 0x45, 0x59, 0x20, 0x28, 0x73, 0x70, 0x6f,
+  0x6b, 0x65, 0x6e, 0x5f, 0x6c, 0x61, 0x6e, 0x67, 0x2c, 0x20, 0x6c, 0x61,
+  0x6e, 0x67, 0x2c, 0x20, 0x60, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x60, 0x2c,
+  0x20, 0x64, 0x61, 0x79, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x29, 0x0a,
+  0x29, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x52, 0x4f,
+  0x57, 0x49, 0x44, 0x3b, 0x0a, 0x0a, 0x2d, 0x2d, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x65, 0x72,
+  0x20, 0x69, 0x6e, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20,
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x73, 0x79, 0x6e, 0x63, 0x0a, 0x43,
+  0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x20,
+  0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54,
+  0x53, 0x20, 0x69, 0x64, 0x78, 0x5f, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x69,
+  0x6e, 0x67, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x6e,
+  0x61, 0x6d, 0x65, 0x20, 0x4f, 0x4e, 0x20, 0x6f, 0x6d, 0x67, 0x5f, 0x74,
+  0x72, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x68, 0x69, 0x73, 0x74,
+  0x6f, 0x72, 0x79, 0x20, 0x28, 0x6e, 0x61, 0x6d, 0x65, 0x5f, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x00
 };
-unsigned int core_create_table_sql_len = 1971;
+unsigned int core_create_table_sql_len = 22107;
@@ -82,3 +82,560 @@ SELECT
 FROM
     omg_gist gist,
     omg_starred_gist ON gist.id = omg_starred_gist.gist_id;
+
+-- Star history, one row per repository per day on which its counts changed.
+-- day is the number of days since unix epoch (UTC).
+-- Triggers upsert rather than INSERT OR REPLACE, whose conflict resolution is
+-- overridden by the UPSERT of save_repos firing them.
+CREATE TABLE IF NOT EXISTS omg_repo_stats (
+    repo_id integer NOT NULL,
+    day integer NOT NULL,
+    stargazers_count integer,
+    forks_count integer,
+    PRIMARY KEY (repo_id, day)
+) WITHOUT ROWID;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_stats_insert
+AFTER INSERT ON omg_repo
+BEGIN
+    INSERT INTO omg_repo_stats (repo_id, day, stargazers_count, forks_count)
+        VALUES (new.id, CAST(strftime('%s', 'now') AS integer) / 86400,
+                new.stargazers_count, new.forks_count)
+        ON CONFLICT (repo_id, day) DO UPDATE
+        SET stargazers_count = excluded.stargazers_count,
+            forks_count = excluded.forks_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_stats_update
+AFTER UPDATE OF stargazers_count, forks_count ON omg_repo
+WHEN new.stargazers_count IS NOT old.stargazers_count
+    OR new.forks_count IS NOT old.forks_count
+BEGIN
+    INSERT INTO omg_repo_stats (repo_id, day, stargazers_count, forks_count)
+        VALUES (new.id, CAST(strftime('%s', 'now') AS integer) / 86400,
+                new.stargazers_count, new.forks_count)
+        ON CONFLICT (repo_id, day) DO UPDATE
+        SET stargazers_count = excluded.stargazers_count,
+            forks_count = excluded.forks_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_stats_delete
+AFTER DELETE ON omg_repo
+BEGIN
+    DELETE FROM omg_repo_stats WHERE repo_id = old.id;
+END;
+
+CREATE TABLE IF NOT EXISTS omg_gist_file (
+    gist_id text NOT NULL,
+    filename text NOT NULL COLLATE NOCASE,
+    `language` text COLLATE NOCASE,
+    raw_url text,
+    `size` integer,
+    PRIMARY KEY (gist_id, filename)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS idx_gist_file_language ON omg_gist_file (`language`);
+CREATE INDEX IF NOT EXISTS idx_gist_filename ON omg_gist_file (filename);
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_file_delete
+AFTER DELETE ON omg_gist
+BEGIN
+    DELETE FROM omg_gist_file WHERE gist_id = old.id;
+END;
+
+CREATE TABLE IF NOT EXISTS omg_meta (
+    `key` text PRIMARY KEY,
+    `value`
+) WITHOUT ROWID;
+
+-- Remove repositories/gists no longer starred or created.
+CREATE TRIGGER IF NOT EXISTS omg_starred_repo_delete
+AFTER DELETE ON omg_starred_repo
+WHEN NOT EXISTS (SELECT 1 FROM omg_created_repo WHERE repo_id = old.repo_id)
+BEGIN
+    DELETE FROM omg_repo WHERE id = old.repo_id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_created_repo_delete
+AFTER DELETE ON omg_created_repo
+WHEN NOT EXISTS (SELECT 1 FROM omg_starred_repo WHERE repo_id = old.repo_id)
+BEGIN
+    DELETE FROM omg_repo WHERE id = old.repo_id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_starred_gist_delete
+AFTER DELETE ON omg_starred_gist
+WHEN NOT EXISTS (SELECT 1 FROM omg_created_gist WHERE gist_id = old.gist_id)
+BEGIN
+    DELETE FROM omg_gist WHERE id = old.gist_id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_created_gist_delete
+AFTER DELETE ON omg_created_gist
+WHEN NOT EXISTS (SELECT 1 FROM omg_starred_gist WHERE gist_id = old.gist_id)
+BEGIN
+    DELETE FROM omg_gist WHERE id = old.gist_id;
+END;
+
+-- Change log for changesets, one row per changed row, keyed by its primary
+-- key as a JSON array. seq grows on every change, so rows changed after a
+-- given seq form a changeset. Triggers delete then insert, since INSERT OR
+-- REPLACE in a trigger is overridden by an UPSERT firing it.
+CREATE TABLE IF NOT EXISTS omg_changelog (
+    seq integer PRIMARY KEY AUTOINCREMENT,
+    tbl text NOT NULL,
+    row_key text NOT NULL,
+    deleted integer NOT NULL DEFAULT 0,
+    UNIQUE (tbl, row_key)
+);
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_changelog_insert
+AFTER INSERT ON omg_repo
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_repo' AND row_key = json_array(new.id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_repo', json_array(new.id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_changelog_update
+AFTER UPDATE ON omg_repo
+WHEN (old.full_name, old.description, old.private, old.created_at,
+      old.license, old.pushed_at, old.stargazers_count, old.watchers_count,
+      old.forks_count, old.lang, old.homepage, old.`size`)
+  IS NOT (new.full_name, new.description, new.private, new.created_at,
+          new.license, new.pushed_at, new.stargazers_count, new.watchers_count,
+          new.forks_count, new.lang, new.homepage, new.`size`)
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_repo' AND row_key = json_array(new.id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_repo', json_array(new.id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_changelog_delete
+AFTER DELETE ON omg_repo
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_repo' AND row_key = json_array(old.id);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_repo', json_array(old.id), 1);
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_starred_repo_changelog_insert
+AFTER INSERT ON omg_starred_repo
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_starred_repo' AND row_key = json_array(new.repo_id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_starred_repo', json_array(new.repo_id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_starred_repo_changelog_update
+AFTER UPDATE OF starred_at ON omg_starred_repo
+WHEN old.starred_at IS NOT new.starred_at
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_starred_repo' AND row_key = json_array(new.repo_id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_starred_repo', json_array(new.repo_id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_starred_repo_changelog_delete
+AFTER DELETE ON omg_starred_repo
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_starred_repo' AND row_key = json_array(old.repo_id);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_starred_repo', json_array(old.repo_id), 1);
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_created_repo_changelog_insert
+AFTER INSERT ON omg_created_repo
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_created_repo' AND row_key = json_array(new.repo_id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_created_repo', json_array(new.repo_id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_created_repo_changelog_delete
+AFTER DELETE ON omg_created_repo
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_created_repo' AND row_key = json_array(old.repo_id);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_created_repo', json_array(old.repo_id), 1);
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_changelog_insert
+AFTER INSERT ON omg_gist
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_gist' AND row_key = json_array(new.id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_gist', json_array(new.id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_changelog_update
+AFTER UPDATE ON omg_gist
+WHEN (old.created_at, old.description, old.`public`)
+  IS NOT (new.created_at, new.description, new.`public`)
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_gist' AND row_key = json_array(new.id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_gist', json_array(new.id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_changelog_delete
+AFTER DELETE ON omg_gist
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_gist' AND row_key = json_array(old.id);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_gist', json_array(old.id), 1);
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_file_changelog_insert
+AFTER INSERT ON omg_gist_file
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_gist_file' AND row_key = json_array(new.gist_id, new.filename);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_gist_file', json_array(new.gist_id, new.filename));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_file_changelog_update
+AFTER UPDATE ON omg_gist_file
+WHEN (old.`language`, old.raw_url, old.`size`)
+  IS NOT (new.`language`, new.raw_url, new.`size`)
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_gist_file' AND row_key = json_array(new.gist_id, new.filename);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_gist_file', json_array(new.gist_id, new.filename));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_gist_file_changelog_delete
+AFTER DELETE ON omg_gist_file
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_gist_file' AND row_key = json_array(old.gist_id, old.filename);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_gist_file', json_array(old.gist_id, old.filename), 1);
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_starred_gist_changelog_insert
+AFTER INSERT ON omg_starred_gist
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_starred_gist' AND row_key = json_array(new.gist_id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_starred_gist', json_array(new.gist_id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_starred_gist_changelog_delete
+AFTER DELETE ON omg_starred_gist
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_starred_gist' AND row_key = json_array(old.gist_id);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_starred_gist', json_array(old.gist_id), 1);
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_created_gist_changelog_insert
+AFTER INSERT ON omg_created_gist
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_created_gist' AND row_key = json_array(new.gist_id);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_created_gist', json_array(new.gist_id));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_created_gist_changelog_delete
+AFTER DELETE ON omg_created_gist
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_created_gist' AND row_key = json_array(old.gist_id);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_created_gist', json_array(old.gist_id), 1);
+END;
+
+-- README of starred repositories, content is zlib compressed.
+CREATE TABLE IF NOT EXISTS omg_readme (
+    repo_id integer PRIMARY KEY,
+    -- pushed_at of the repository when fetched, refetch when it changes
+    pushed_at text,
+    etag text,
+    -- NULL when the repository has no README
+    content blob,
+    -- bytes before compression
+    `size` integer,
+    fetched_at text
+);
+
+-- Plain text of READMEs, rowid is repo_id. Rows are inserted by the sync,
+-- which has the text before compression, triggers only remove them so the
+-- schema works without functions registered by omg_setup_context.
+CREATE VIRTUAL TABLE IF NOT EXISTS omg_readme_fts USING fts5 (
+    content,
+    tokenize = 'porter unicode61'
+);
+
+CREATE TRIGGER IF NOT EXISTS omg_readme_unindex_update
+AFTER UPDATE OF content ON omg_readme
+BEGIN
+    DELETE FROM omg_readme_fts WHERE rowid = old.repo_id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_readme_unindex_delete
+AFTER DELETE ON omg_readme
+BEGIN
+    DELETE FROM omg_readme_fts WHERE rowid = old.repo_id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_readme_repo_delete
+AFTER DELETE ON omg_repo
+BEGIN
+    DELETE FROM omg_readme WHERE repo_id = old.id;
+END;
+
+CREATE TABLE IF NOT EXISTS omg_repo_topic (
+    repo_id integer NOT NULL,
+    topic text NOT NULL COLLATE NOCASE,
+    PRIMARY KEY (repo_id, topic)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS idx_topic ON omg_repo_topic (topic);
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_topic_repo_delete
+AFTER DELETE ON omg_repo
+BEGIN
+    DELETE FROM omg_repo_topic WHERE repo_id = old.id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_topic_changelog_insert
+AFTER INSERT ON omg_repo_topic
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_repo_topic' AND row_key = json_array(new.repo_id, new.topic);
+    INSERT INTO omg_changelog (tbl, row_key)
+        VALUES ('omg_repo_topic', json_array(new.repo_id, new.topic));
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_topic_changelog_delete
+AFTER DELETE ON omg_repo_topic
+BEGIN
+    DELETE FROM omg_changelog
+        WHERE tbl = 'omg_repo_topic' AND row_key = json_array(old.repo_id, old.topic);
+    INSERT INTO omg_changelog (tbl, row_key, deleted)
+        VALUES ('omg_repo_topic', json_array(old.repo_id, old.topic), 1);
+END;
+
+-- Facet counts of starred (is_star = 1) and created repositories, maintained
+-- by triggers below so that counting costs O(facet values). A repository
+-- counts once both itself and its star/created row exist, values of no
+-- language/license are ''. Zero counts are kept, readers skip them.
+CREATE TABLE IF NOT EXISTS omg_repo_facet (
+    is_star integer NOT NULL,
+    facet text NOT NULL,
+    `value` text NOT NULL,
+    `count` integer NOT NULL,
+    PRIMARY KEY (is_star, facet, `value`)
+) WITHOUT ROWID;
+
+CREATE VIEW IF NOT EXISTS omg_repo_link AS
+SELECT 1 AS is_star, repo_id FROM omg_starred_repo
+UNION ALL
+SELECT 0, repo_id FROM omg_created_repo;
+
+CREATE VIEW IF NOT EXISTS omg_repo_facet_value AS
+SELECT id AS repo_id, 'lang' AS facet, coalesce(lang, '') AS `value` FROM omg_repo
+UNION ALL
+SELECT id, 'license', coalesce(license, '') FROM omg_repo
+UNION ALL
+SELECT id, 'private', CASE WHEN private THEN 'private' ELSE 'public' END FROM omg_repo;
+
+-- Decrements run BEFORE the row goes away, so they see it no matter which
+-- AFTER trigger removes the other side of the join.
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_starred_insert
+AFTER INSERT ON omg_starred_repo
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT 1, facet, `value`, 1 FROM omg_repo_facet_value WHERE repo_id = new.repo_id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_starred_delete
+BEFORE DELETE ON omg_starred_repo
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT 1, facet, `value`, -1 FROM omg_repo_facet_value WHERE repo_id = old.repo_id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_created_insert
+AFTER INSERT ON omg_created_repo
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT 0, facet, `value`, 1 FROM omg_repo_facet_value WHERE repo_id = new.repo_id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_created_delete
+BEFORE DELETE ON omg_created_repo
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT 0, facet, `value`, -1 FROM omg_repo_facet_value WHERE repo_id = old.repo_id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_repo_insert
+AFTER INSERT ON omg_repo
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT l.is_star, v.facet, v.`value`, 1
+        FROM omg_repo_link l, omg_repo_facet_value v
+        WHERE l.repo_id = new.id AND v.repo_id = new.id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_repo_delete
+BEFORE DELETE ON omg_repo
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT l.is_star, v.facet, v.`value`, -1
+        FROM omg_repo_link l, omg_repo_facet_value v
+        WHERE l.repo_id = old.id AND v.repo_id = old.id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_before_update
+BEFORE UPDATE OF lang, license, private ON omg_repo
+WHEN (old.lang, old.license, old.private) IS NOT (new.lang, new.license, new.private)
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT l.is_star, v.facet, v.`value`, -1
+        FROM omg_repo_link l, omg_repo_facet_value v
+        WHERE l.repo_id = old.id AND v.repo_id = old.id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+CREATE TRIGGER IF NOT EXISTS omg_repo_facet_after_update
+AFTER UPDATE OF lang, license, private ON omg_repo
+WHEN (old.lang, old.license, old.private) IS NOT (new.lang, new.license, new.private)
+BEGIN
+    INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`)
+        SELECT l.is_star, v.facet, v.`value`, 1
+        FROM omg_repo_link l, omg_repo_facet_value v
+        WHERE l.repo_id = new.id AND v.repo_id = new.id
+        ON CONFLICT (is_star, facet, `value`) DO UPDATE SET `count` = `count` + excluded.`count`;
+END;
+
+-- Commits of viewed repositories, keyed by full_name since they may be
+-- neither starred nor created. committed_at is the committer date GitHub
+-- filters `since` on, `date` is the author date shown to users.
+CREATE TABLE IF NOT EXISTS omg_commit (
+    full_name text NOT NULL COLLATE NOCASE,
+    sha text NOT NULL,
+    message text,
+    author text,
+    email text,
+    `date` text,
+    committed_at text,
+    PRIMARY KEY (full_name, sha)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS idx_commit_committed_at ON omg_commit (full_name, committed_at);
+
+CREATE TABLE IF NOT EXISTS omg_commit_fetch (
+    full_name text PRIMARY KEY COLLATE NOCASE,
+    fetched_at text NOT NULL
+) WITHOUT ROWID;
+
+-- Releases of viewed repositories, revalidated with the ETag of last fetch.
+-- published_at is NULL for drafts.
+CREATE TABLE IF NOT EXISTS omg_release (
+    id integer PRIMARY KEY,
+    full_name text NOT NULL COLLATE NOCASE,
+    name text,
+    login text,
+    tag_name text,
+    body text,
+    draft integer,
+    prerelease integer,
+    published_at text
+);
+
+CREATE INDEX IF NOT EXISTS idx_release_repo ON omg_release (full_name, published_at);
+CREATE INDEX IF NOT EXISTS idx_release_published_at ON omg_release (published_at);
+
+CREATE TABLE IF NOT EXISTS omg_release_asset (
+    id integer PRIMARY KEY,
+    release_id integer NOT NULL,
+    name text,
+    size integer,
+    download_count integer,
+    download_url text
+);
+
+CREATE INDEX IF NOT EXISTS idx_asset_release ON omg_release_asset (release_id);
+
+CREATE TRIGGER IF NOT EXISTS omg_release_delete
+AFTER DELETE ON omg_release
+BEGIN
+    DELETE FROM omg_release_asset WHERE release_id = old.id;
+END;
+
+CREATE TABLE IF NOT EXISTS omg_release_fetch (
+    full_name text PRIMARY KEY COLLATE NOCASE,
+    etag text,
+    fetched_at text NOT NULL
+) WITHOUT ROWID;
+
+-- Trending pages of github.com, keyed by spoken language, language and
+-- range, '' for any. Timestamps are unix seconds, no request is sent before
+-- retry_at after GitHub answered 429.
+CREATE TABLE IF NOT EXISTS omg_trending_fetch (
+    spoken_lang text NOT NULL,
+    lang text NOT NULL,
+    `range` text NOT NULL,
+    fetched_at integer,
+    retry_at integer,
+    PRIMARY KEY (spoken_lang, lang, `range`)
+) WITHOUT ROWID;
+
+CREATE TABLE IF NOT EXISTS omg_trending_repo (
+    spoken_lang text NOT NULL,
+    lang text NOT NULL,
+    `range` text NOT NULL,
+    rank integer NOT NULL,
+    full_name text,
+    description text,
+    stargazers_count integer,
+    PRIMARY KEY (spoken_lang, lang, `range`, rank)
+) WITHOUT ROWID;
+
+-- Trending history, one row per rank of every fetched page per day, a later
+-- fetch of the same day replaces it. Repository names are stored once in
+-- omg_trending_name. day is the number of days since unix epoch (UTC), the
+-- primary key keeps days of a page together for time-range scans.
+CREATE TABLE IF NOT EXISTS omg_trending_name (
+    id integer PRIMARY KEY,
+    full_name text NOT NULL UNIQUE COLLATE NOCASE
+);
+
+CREATE TABLE IF NOT EXISTS omg_trending_history (
+    spoken_lang text NOT NULL,
+    lang text NOT NULL,
+    `range` text NOT NULL,
+    day integer NOT NULL,
+    rank integer NOT NULL,
+    name_id integer NOT NULL,
+    recent_stars integer,
+    PRIMARY KEY (spoken_lang, lang, `range`, day, rank)
+) WITHOUT ROWID;
+
+-- names no longer in history are removed after sync
+CREATE INDEX IF NOT EXISTS idx_trending_history_name ON omg_trending_history (name_id);
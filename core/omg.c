@@ -1,6 +1,12 @@
+// memmem
+#define _GNU_SOURCE
 #include "omg.h"
 #include "create_table.h"
+#include <ctype.h>
 #include <curl/curl.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <jansson.h>
 #include <pcre2posix.h>
 #include <sqlite3.h>
@@ -8,6 +14,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <zlib.h>
 
 const char *HEADER_ACCEPT = "Accept: application/vnd.github.v3.star+json";
 const char *HEADER_UA = "User-Agent: omg-client/1.0.0";
@@ -28,13 +40,17 @@ const size_t PER_PAGE = 100;
 const size_t SQL_DEFAULT_LEN = 512;
 
 // matched groups:
-// 1. desc
+// 1. desc, unset when the repository has none
 // 2. full_name
 // 3. current stats
 //
+// Matched from the start of the text, one repository at a time. Description
+// is only looked for before the first stargazers link, so a repository
+// without one doesn't take description of the next.
 // There is no language in some repositories, so don't parse it now
 static const char *const RE =
-    "<p class=\"col-9 color-fg-muted my-1 pr-4\">\\s+(.+?)\\s+</p>"
+    "^(?:(?:[^/]|/(?!stargazers\"))*?"
+    "<p class=\"col-9 color-fg-muted my-1 pr-4\">\\s+(.+?)\\s+</p>)?"
     /* ".+?(<span itemprop=\"programmingLanguage\">(\\S+)</span>)?" */
     ".+?<a href=\"/(\\S+/\\S+)/stargazers.*?(\\d+(?:,\\d+)*) stars "
     "(today|this)";
@@ -114,6 +130,99 @@ static char *strdup_when_not_null(const unsigned char *input) {
   return NULL;
 }
 
+/*********/
+/* Arena */
+/*********/
+// Result lists(repos/stars/gists) are backed by a bump arena, the element
+// array lives in the head block, strings of all elements live in a chain of
+// large blocks linked from head, so a list is released with a few free.
+typedef struct arena_block {
+  struct arena_block *next;
+  size_t capacity;
+  size_t used;
+  char data[] __attribute__((aligned(16)));
+} arena_block;
+
+typedef arena_block *arena;
+
+static const size_t ARENA_BLOCK_SIZE = 64 * 1024;
+
+// Create an arena whose head can hold `size` bytes of element array.
+static arena arena_new(size_t size) {
+  arena a = malloc(sizeof(arena_block) + size);
+  *a = (arena_block){.next = NULL, .capacity = size, .used = 0};
+  return a;
+}
+
+// Ensure the element array can hold `size` bytes, this may move the head.
+static arena arena_reserve(arena a, size_t size) {
+  if (size <= a->capacity) {
+    return a;
+  }
+  size_t capacity = a->capacity * 2;
+  if (capacity < size) {
+    capacity = size;
+  }
+  a = realloc(a, sizeof(arena_block) + capacity);
+  a->capacity = capacity;
+  return a;
+}
+
+static char *arena_alloc(arena a, size_t size) {
+  arena_block *block = a->next;
+  if (!block || block->capacity - block->used < size) {
+    size_t capacity = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+    block = malloc(sizeof(arena_block) + capacity);
+    *block = (arena_block){.next = a->next, .capacity = capacity, .used = 0};
+    a->next = block;
+  }
+  char *ptr = block->data + block->used;
+  block->used += size;
+  return ptr;
+}
+
+// Like arena_alloc, but aligned for arrays of pointers or integers.
+static void *arena_alloc_array(arena a, size_t size) {
+  arena_block *block = a->next;
+  if (block) {
+    block->used = (block->used + 7) & ~(size_t)7;
+    if (block->used > block->capacity) {
+      block->used = block->capacity;
+    }
+  }
+  return arena_alloc(a, size);
+}
+
+// Copy at most n bytes of s, when a is NULL, copy into heap.
+static char *arena_strndup(arena a, const char *s, size_t n) {
+  if (!s) {
+    return NULL;
+  }
+  if (!a) {
+    return strndup(s, n);
+  }
+  char *ptr = arena_alloc(a, n + 1);
+  memcpy(ptr, s, n);
+  ptr[n] = '\0';
+  return ptr;
+}
+
+static char *arena_strdup(arena a, const char *s) {
+  return s ? arena_strndup(a, s, strlen(s)) : NULL;
+}
+
+// Free the arena which `array` belongs to.
+static void arena_free_array(void *array) {
+  if (array) {
+    arena a = (arena)((char *)array - offsetof(arena_block, data));
+    while (a) {
+      arena_block *next = a->next;
+      free(a);
+      a = next;
+    }
+  }
+}
+
 static void free_stmt(sqlite3_stmt **stmt) {
   if (*stmt) {
 #ifdef VERBOSE
@@ -125,6 +234,57 @@ static void free_stmt(sqlite3_stmt **stmt) {
 
 #define auto_sqlite3_stmt sqlite3_stmt *__attribute__((cleanup(free_stmt)))
 
+typedef struct {
+  bool built;
+  size_t length;
+  int32_t *ids;
+  int32_t *stars;
+  int32_t *forks;
+  int32_t *sizes;
+  int64_t *times;
+  // index into langs, 0 means no language
+  uint16_t *lang_ids;
+  // position of full_name in case-insensitive order, used when sort by name
+  uint32_t *name_ranks;
+  // Row i is stored as "full_name\0description\0" at text + text_offsets[i],
+  // text_offsets has length + 1 entries.
+  char *text;
+  // Same layout with text, but in lowercase, used for keyword matching.
+  char *search;
+  uint32_t *text_offsets;
+  // Interned, langs[0] is reserved for no language
+  const char **langs;
+  size_t lang_len;
+  // Sorted case-insensitively, topic i is stored as "topic\0" at
+  // topic_text + topic_offsets[i], topic_offsets has topic_len + 1 entries.
+  size_t topic_len;
+  char *topic_text;
+  uint32_t *topic_offsets;
+  // Rows tagged with topic i. Topics of many rows are bitmaps over rows at
+  // topic_words + topic_starts[i], others are ascending rows at
+  // topic_rows + topic_starts[i], see topic_is_dense.
+  uint32_t *topic_counts;
+  uint32_t *topic_starts;
+  uint32_t *topic_rows;
+  size_t topic_rows_len;
+  uint64_t *topic_words;
+  size_t topic_words_len;
+  // When loaded from snapshot file, all columns above except langs point
+  // into this read-only mapping.
+  void *mapping;
+  size_t mapping_size;
+  // Database version the snapshot was built at, see snapshot_db_version.
+  int64_t db_version;
+} repo_snapshot;
+
+// Open addressing hash set of immutable strings, used for low-cardinality
+// fields such as language and license.
+typedef struct {
+  char **slots;
+  size_t capacity; // power of 2
+  size_t length;
+} intern_table;
+
 struct omg_context {
   sqlite3 *db;
   // Used for api.github.com
@@ -134,7 +294,25 @@ struct omg_context {
   CURL *trending_curl;
   struct curl_slist *trending_headers;
   regex_t trending_re;
-  /* int timeout; */
+  int32_t timeout;
+  // "Authorization: token xxx", for handles created on demand
+  char *auth_header;
+  repo_snapshot starred_snapshot;
+  repo_snapshot created_snapshot;
+  intern_table interned;
+  int32_t optimize_interval;
+  int32_t trending_ttl;
+  // "<db path>-starred.snap" and "<db path>-created.snap", NULL when disabled
+  char *starred_snapshot_path;
+  char *created_snapshot_path;
+  // generation of current(or last) full sync, saved rows are stamped with it
+  int64_t sync_gen;
+  // body size of last omg_request
+  int64_t resp_bytes;
+  // `rel="last"` page in Link header of last omg_request, 0 when absent
+  int32_t last_page;
+  omg_sync_progress_fn sync_progress;
+  void *sync_progress_data;
 };
 
 void print_error(omg_error err) {
@@ -168,6 +346,69 @@ static bool empty_string(const char *s) {
   return true;
 }
 
+static void free_repo_snapshot(repo_snapshot *snap);
+static void invalidate_repo_snapshots(omg_context ctx);
+static omg_error save_repo_snapshots(omg_context ctx);
+static omg_error compact_repo_stats(omg_context ctx);
+static omg_error compact_trending_history(omg_context ctx);
+
+static void free_intern_table(intern_table *table) {
+  for (size_t i = 0; i < table->capacity; i++) {
+    free(table->slots[i]);
+  }
+  free(table->slots);
+  *table = (intern_table){};
+}
+
+// FNV-1a
+static uint64_t hash_string(const char *s) {
+  uint64_t h = 14695981039346656037ULL;
+  for (; *s; s++) {
+    h = (h ^ (unsigned char)*s) * 1099511628211ULL;
+  }
+  return h;
+}
+
+static void intern_table_grow(intern_table *table) {
+  size_t capacity = table->capacity ? table->capacity * 2 : 64;
+  char **slots = calloc(capacity, sizeof(char *));
+  for (size_t i = 0; i < table->capacity; i++) {
+    char *s = table->slots[i];
+    if (s) {
+      size_t pos = hash_string(s) & (capacity - 1);
+      while (slots[pos]) {
+        pos = (pos + 1) & (capacity - 1);
+      }
+      slots[pos] = s;
+    }
+  }
+  free(table->slots);
+  table->slots = slots;
+  table->capacity = capacity;
+}
+
+const char *omg_intern(omg_context ctx, const char *s) {
+  if (s == NULL) {
+    return NULL;
+  }
+
+  intern_table *table = &ctx->interned;
+  // keep load factor under 0.5
+  if ((table->length + 1) * 2 > table->capacity) {
+    intern_table_grow(table);
+  }
+  size_t pos = hash_string(s) & (table->capacity - 1);
+  while (table->slots[pos]) {
+    if (0 == strcmp(table->slots[pos], s)) {
+      return table->slots[pos];
+    }
+    pos = (pos + 1) & (table->capacity - 1);
+  }
+  table->slots[pos] = strdup(s);
+  table->length++;
+  return table->slots[pos];
+}
+
 void omg_free_context(omg_context *ctx) {
   if (*ctx) {
 #ifdef VERBOSE
@@ -180,6 +421,12 @@ void omg_free_context(omg_context *ctx) {
     curl_global_cleanup();
     sqlite3_close((*ctx)->db);
     pcre2_regfree(&(*ctx)->trending_re);
+    free_repo_snapshot(&(*ctx)->starred_snapshot);
+    free_repo_snapshot(&(*ctx)->created_snapshot);
+    free((*ctx)->starred_snapshot_path);
+    free((*ctx)->created_snapshot_path);
+    free((*ctx)->auth_header);
+    free_intern_table(&(*ctx)->interned);
     free(*ctx);
   }
 }
@@ -189,7 +436,211 @@ typedef struct {
   omg_error err;
 } db_t;
 
-static db_t init_db(const char *root) {
+// Data migrations for existing databases, schema changes live in
+// create_table.sql. The i-th migration upgrades `PRAGMA user_version` from i
+// to i+1, append new ones at the end.
+static const char *MIGRATIONS[] = {
+    // 1: baseline of star history
+    "INSERT OR IGNORE INTO omg_repo_stats (repo_id, day, stargazers_count, "
+    "forks_count) "
+    "SELECT id, CAST(strftime('%s', 'now') AS integer) / 86400, "
+    "stargazers_count, forks_count FROM omg_repo",
+    // 2: split files of gists into omg_gist_file
+    "INSERT OR REPLACE INTO omg_gist_file (gist_id, filename, language, "
+    "raw_url, size) "
+    "SELECT g.id, json_extract(value, '$.filename'), "
+    "json_extract(value, '$.language'), json_extract(value, '$.raw_url'), "
+    "json_extract(value, '$.size') "
+    "FROM omg_gist g, json_each(g.files) WHERE g.files IS NOT NULL; "
+    "UPDATE omg_gist SET files = NULL",
+    // 3: generation of the last full sync seeing the row
+    "ALTER TABLE omg_starred_repo ADD COLUMN sync_gen integer NOT NULL "
+    "DEFAULT 0; "
+    "ALTER TABLE omg_created_repo ADD COLUMN sync_gen integer NOT NULL "
+    "DEFAULT 0; "
+    "ALTER TABLE omg_starred_gist ADD COLUMN sync_gen integer NOT NULL "
+    "DEFAULT 0; "
+    "ALTER TABLE omg_created_gist ADD COLUMN sync_gen integer NOT NULL "
+    "DEFAULT 0; "
+    "CREATE INDEX idx_starred_repo_gen ON omg_starred_repo (sync_gen); "
+    "CREATE INDEX idx_created_repo_gen ON omg_created_repo (sync_gen); "
+    "CREATE INDEX idx_starred_gist_gen ON omg_starred_gist (sync_gen); "
+    "CREATE INDEX idx_created_gist_gen ON omg_created_gist (sync_gen)",
+    // 4: existing rows form the first changeset
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_repo', json_array(id) FROM omg_repo; "
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_starred_repo', json_array(repo_id) FROM omg_starred_repo; "
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_created_repo', json_array(repo_id) FROM omg_created_repo; "
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_gist', json_array(id) FROM omg_gist; "
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_gist_file', json_array(gist_id, filename) "
+    "FROM omg_gist_file; "
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_starred_gist', json_array(gist_id) FROM omg_starred_gist; "
+    "INSERT OR REPLACE INTO omg_changelog (tbl, row_key) "
+    "SELECT 'omg_created_gist', json_array(gist_id) FROM omg_created_gist",
+    // 5: facet counts of existing repositories
+    "DELETE FROM omg_repo_facet; "
+    "INSERT INTO omg_repo_facet (is_star, facet, `value`, `count`) "
+    "SELECT l.is_star, v.facet, v.`value`, count(*) "
+    "FROM omg_repo_link l JOIN omg_repo_facet_value v "
+    "ON v.repo_id = l.repo_id GROUP BY 1, 2, 3",
+    // 6: all fields of trending repositories, pages cached before stored
+    // recent stars as stargazers_count
+    "ALTER TABLE omg_trending_repo ADD COLUMN repo_lang text; "
+    "ALTER TABLE omg_trending_repo ADD COLUMN forks_count integer; "
+    "ALTER TABLE omg_trending_repo ADD COLUMN recent_stars integer; "
+    "DELETE FROM omg_trending_repo; "
+    "DELETE FROM omg_trending_fetch",
+};
+
+static omg_error migrate_db(sqlite3 *db) {
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(db, "PRAGMA user_version", -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+  }
+  size_t version = sqlite3_column_int(stmt, 0);
+  sqlite3_reset(stmt);
+  size_t total = sizeof(MIGRATIONS) / sizeof(MIGRATIONS[0]);
+  for (; version < total; version++) {
+    char sql[64];
+    sprintf(sql, "PRAGMA user_version = %zu", version + 1);
+    if (sqlite3_exec(db, "begin", NULL, NULL, NULL) ||
+        sqlite3_exec(db, MIGRATIONS[version], NULL, NULL, NULL) ||
+        sqlite3_exec(db, sql, NULL, NULL, NULL) ||
+        sqlite3_exec(db, "commit", NULL, NULL, NULL)) {
+      omg_error err = new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+      sqlite3_exec(db, "rollback", NULL, NULL, NULL);
+      return err;
+    }
+  }
+
+  return NO_ERROR;
+}
+
+// omg_inflate(content, size), inflate README compressed by zlib, size is the
+// length before compression.
+static void sqlite_inflate(sqlite3_context *context, int argc,
+                           sqlite3_value **argv) {
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
+    sqlite3_result_null(context);
+    return;
+  }
+  const Bytef *content = sqlite3_value_blob(argv[0]);
+  uLong content_len = sqlite3_value_bytes(argv[0]);
+  uLongf len = sqlite3_value_int64(argv[1]);
+  char *text = sqlite3_malloc64(len + 1);
+  if (!text) {
+    sqlite3_result_error_nomem(context);
+    return;
+  }
+  if (uncompress((Bytef *)text, &len, content, content_len) != Z_OK) {
+    sqlite3_free(text);
+    sqlite3_result_error(context, "omg_inflate: corrupted content", -1);
+    return;
+  }
+  sqlite3_result_text(context, text, len, sqlite3_free);
+}
+
+// PRAGMA values are spliced into SQL, so only plain words are accepted.
+static bool is_pragma_word(const char *s) {
+  for (; *s; s++) {
+    if (!isalnum((unsigned char)*s) && *s != '_') {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Must run before tables are created, page_size and auto_vacuum only take
+// effect on a new database(or after VACUUM).
+static omg_error apply_db_options(sqlite3 *db, const omg_setup_options *opts) {
+  char sql[128];
+  // page_size is ignored once auto_vacuum is set, so it goes first
+  if (opts->page_size > 0) {
+    sprintf(sql, "PRAGMA page_size = %d", opts->page_size);
+    if (sqlite3_exec(db, sql, NULL, NULL, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+    }
+  }
+  // so that omg_vacuum can reclaim free pages incrementally
+  if (sqlite3_exec(db, "PRAGMA auto_vacuum = INCREMENTAL", NULL, NULL, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+  }
+  if (opts->cache_size != 0) {
+    sprintf(sql, "PRAGMA cache_size = %d", opts->cache_size);
+    if (sqlite3_exec(db, sql, NULL, NULL, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+    }
+  }
+  if (opts->mmap_size > 0) {
+    sprintf(sql, "PRAGMA mmap_size = %" PRId64, opts->mmap_size);
+    if (sqlite3_exec(db, sql, NULL, NULL, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+    }
+  }
+
+  const struct {
+    const char *name;
+    const char *value;
+  } words[] = {
+      {"temp_store", opts->temp_store},
+      {"journal_mode", opts->journal_mode},
+      {"synchronous", opts->synchronous},
+  };
+  for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+    if (empty_string(words[i].value)) {
+      continue;
+    }
+    if (!is_pragma_word(words[i].value) || strlen(words[i].value) > 32) {
+      sprintf(sql, "invalid %s: %.32s", words[i].name, words[i].value);
+      return new_error(OMG_CODE_INTERNAL, sql);
+    }
+    sprintf(sql, "PRAGMA %s = %s", words[i].name, words[i].value);
+    if (sqlite3_exec(db, sql, NULL, NULL, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+    }
+  }
+
+  return NO_ERROR;
+}
+
+// create_table.sql is only executed when it differs from the one recorded
+// in omg_meta, which saves parsing the whole DDL on every start.
+static int64_t schema_hash() {
+  return (int64_t)hash_string((const char *)core_create_table_sql);
+}
+
+static bool schema_up_to_date(sqlite3 *db) {
+  const char *sql = "select value from omg_meta where key = 'schema_hash'";
+  auto_sqlite3_stmt stmt = NULL;
+  // omg_meta doesn't exist in a new database
+  if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return false;
+  }
+  return sqlite3_column_int64(stmt, 0) == schema_hash();
+}
+
+static omg_error save_schema_hash(sqlite3 *db) {
+  const char *sql = "insert or replace into omg_meta(key, value) "
+                    "values ('schema_hash', ?1)";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+  }
+  sqlite3_bind_int64(stmt, 1, schema_hash());
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+  }
+  return NO_ERROR;
+}
+
+static db_t init_db(const char *root, const omg_setup_options *opts) {
   sqlite3 *db = NULL;
   int ret = sqlite3_open(root, &db);
   if (ret) {
@@ -198,13 +649,46 @@ static db_t init_db(const char *root) {
     return (db_t){.err = new_error(OMG_CODE_DB, msg)};
   }
 
-  char *err_msg = NULL;
-  ret = sqlite3_exec(db, (const char *)core_create_table_sql, NULL, NULL,
-                     &err_msg);
-  if (ret) {
-    fprintf(stderr, "exec create table sql failed:%s\n", err_msg);
-    sqlite3_free(err_msg);
-    return (db_t){.err = {.code = OMG_CODE_DB, .message = "exec sql failed"}};
+  omg_error err = apply_db_options(db, opts);
+  if (!is_ok(err)) {
+    sqlite3_close(db);
+    return (db_t){.err = err};
+  }
+
+  // used by queries of omg_readme, never by the schema
+  if (sqlite3_create_function(db, "omg_inflate", 2,
+                              SQLITE_UTF8 | SQLITE_DETERMINISTIC, NULL,
+                              sqlite_inflate, NULL, NULL)) {
+    err = new_error(OMG_CODE_DB, sqlite3_errmsg(db));
+    sqlite3_close(db);
+    return (db_t){.err = err};
+  }
+
+  bool schema_changed = !schema_up_to_date(db);
+  if (schema_changed) {
+    char *err_msg = NULL;
+    ret = sqlite3_exec(db, (const char *)core_create_table_sql, NULL, NULL,
+                       &err_msg);
+    if (ret) {
+      fprintf(stderr, "exec create table sql failed:%s\n", err_msg);
+      sqlite3_free(err_msg);
+      return (db_t){.err = {.code = OMG_CODE_DB,
+                            .message = "exec sql failed"}};
+    }
+  }
+
+  err = migrate_db(db);
+  if (!is_ok(err)) {
+    sqlite3_close(db);
+    return (db_t){.err = err};
+  }
+
+  if (schema_changed) {
+    err = save_schema_hash(db);
+    if (!is_ok(err)) {
+      sqlite3_close(db);
+      return (db_t){.err = err};
+    }
   }
 
   return (db_t){.db = db};
@@ -212,6 +696,15 @@ static db_t init_db(const char *root) {
 
 omg_error omg_setup_context(const char *path, const char *github_token,
                             int32_t timeout, omg_context *out) {
+  omg_setup_options opts = {.github_token = github_token, .timeout = timeout};
+  return omg_setup_context_with_options(path, &opts, out);
+}
+
+omg_error omg_setup_context_with_options(const char *path,
+                                         const omg_setup_options *opts,
+                                         omg_context *out) {
+  const char *github_token = opts->github_token;
+  int32_t timeout = opts->timeout;
   curl_global_init(CURL_GLOBAL_ALL);
   CURL *api_curl = curl_easy_init();
   if (!api_curl) {
@@ -241,8 +734,10 @@ omg_error omg_setup_context(const char *path, const char *github_token,
   }
   curl_easy_setopt(api_curl, CURLOPT_HTTPHEADER, api_headers);
   curl_easy_setopt(api_curl, CURLOPT_TIMEOUT, timeout);
-  db_t db = init_db(path);
+  db_t db = init_db(path, opts);
   if (!is_ok(db.err)) {
+    curl_slist_free_all(api_headers);
+    curl_easy_cleanup(api_curl);
     return db.err;
   }
 
@@ -266,13 +761,25 @@ omg_error omg_setup_context(const char *path, const char *github_token,
     return (omg_error){.code = OMG_CODE_INTERNAL,
                        .message = "init trending regexp"};
   }
-  omg_context ctx = malloc(sizeof(struct omg_context));
+  omg_context ctx = calloc(1, sizeof(struct omg_context));
   ctx->db = db.db;
   ctx->api_curl = api_curl;
   ctx->api_headers = api_headers;
   ctx->trending_curl = trending_curl;
   ctx->trending_headers = trending_headers;
   ctx->trending_re = trending_re;
+  ctx->timeout = timeout;
+  ctx->auth_header = strdup(header_auth);
+  ctx->optimize_interval =
+      opts->optimize_interval ? opts->optimize_interval : 24 * 3600;
+  ctx->trending_ttl = opts->trending_ttl ? opts->trending_ttl : 3600;
+  // in-memory databases have no place for snapshot files
+  if (!empty_string(path) && strcmp(path, ":memory:") != 0) {
+    ctx->starred_snapshot_path = malloc(strlen(path) + 16);
+    sprintf(ctx->starred_snapshot_path, "%s-starred.snap", path);
+    ctx->created_snapshot_path = malloc(strlen(path) + 16);
+    sprintf(ctx->created_snapshot_path, "%s-created.snap", path);
+  }
   *out = ctx;
 
   return NO_ERROR;
@@ -280,9 +787,216 @@ omg_error omg_setup_context(const char *path, const char *github_token,
 
 CURL *omg__curl_handler(omg_context ctx) { return ctx->api_curl; }
 
+void omg_set_sync_progress(omg_context ctx, omg_sync_progress_fn fn,
+                           void *userdata) {
+  ctx->sync_progress = fn;
+  ctx->sync_progress_data = userdata;
+}
+
+/***************/
+/* Maintenance */
+/***************/
+
+// Run ANALYZE the first time, then PRAGMA optimize at most once every
+// optimize_interval seconds.
+static omg_error optimize_db_on_schedule(omg_context ctx) {
+  if (ctx->optimize_interval < 0) {
+    return NO_ERROR;
+  }
+
+  const char *sql = "select value from omg_meta where key = 'optimized_at'";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  int64_t now = time(NULL);
+  int rc = sqlite3_step(stmt);
+  if (rc == SQLITE_ROW &&
+      now - sqlite3_column_int64(stmt, 0) < ctx->optimize_interval) {
+    return NO_ERROR;
+  }
+  if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_reset(stmt);
+
+  sql = rc == SQLITE_ROW ? "PRAGMA optimize" : "ANALYZE";
+  if (sqlite3_exec(ctx->db, sql, NULL, NULL, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  sql = "insert or replace into omg_meta(key, value) "
+        "values ('optimized_at', ?1)";
+  auto_sqlite3_stmt update_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &update_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_int64(update_stmt, 1, now);
+  if (sqlite3_step(update_stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  return NO_ERROR;
+}
+
+// Mark and sweep
+// Each full sync takes a new generation and stamps every row it saves with
+// it, rows of older generations are gone from GitHub and swept at the end.
+
+static omg_error start_sync(omg_context ctx) {
+  const char *sql = "insert into omg_meta(key, value) values ('sync_gen', 1) "
+                    "on conflict(key) do update set value = value + 1";
+  if (sqlite3_exec(ctx->db, sql, NULL, NULL, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  sql = "select value from omg_meta where key = 'sync_gen'";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  ctx->sync_gen = sqlite3_column_int64(stmt, 0);
+  return NO_ERROR;
+}
+
+// Only a complete sync may sweep, otherwise rows in pages not fetched yet
+// would be lost. Pages whose rows fail to save end the sync with an error
+// before reaching here.
+static omg_error finish_sync(omg_context ctx, const char *table,
+                             bool complete) {
+  if (complete) {
+    char sql[128];
+    // idx_*_gen makes this proportional to rows swept
+    sprintf(sql, "delete from %s where sync_gen < ?1", table);
+    auto_sqlite3_stmt stmt = NULL;
+    if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_bind_int64(stmt, 1, ctx->sync_gen);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+#ifdef VERBOSE
+    printf("sweep %s, removed:%d\n", table, sqlite3_changes(ctx->db));
+#endif
+    invalidate_repo_snapshots(ctx);
+  }
+
+  omg_error err = compact_repo_stats(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+  err = compact_trending_history(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  return optimize_db_on_schedule(ctx);
+}
+
+typedef struct {
+  omg_sync_progress progress;
+  struct timespec start;
+} sync_tracker;
+
+static sync_tracker start_sync_tracker(const char *kind) {
+  sync_tracker t = {.progress = {.kind = kind, .remaining_pages = -1}};
+  clock_gettime(CLOCK_MONOTONIC, &t.start);
+  return t;
+}
+
+// Called after each page is saved, only counters and one clock read, so it's
+// cheap compared with the request of the page.
+static void report_sync_page(omg_context ctx, sync_tracker *t, size_t rows,
+                             bool last) {
+  omg_sync_progress *p = &t->progress;
+  p->page++;
+  p->rows += rows;
+  p->bytes += ctx->resp_bytes;
+  if (last) {
+    p->remaining_pages = 0;
+  } else if (ctx->last_page > 0) {
+    p->remaining_pages = ctx->last_page > p->page ? ctx->last_page - p->page
+                                                  : 0;
+  }
+  if (!ctx->sync_progress) {
+    return;
+  }
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  p->elapsed_ms = (now.tv_sec - t->start.tv_sec) * 1000 +
+                  (now.tv_nsec - t->start.tv_nsec) / 1000000;
+  ctx->sync_progress(p, ctx->sync_progress_data);
+}
+
+omg_error omg_vacuum(omg_context ctx, int32_t max_pages) {
+  const char *sql = "PRAGMA auto_vacuum";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  // 2 is INCREMENTAL
+  bool incremental = sqlite3_column_int(stmt, 0) == 2;
+  sqlite3_reset(stmt);
+
+  char vacuum_sql[64];
+  if (incremental) {
+    sprintf(vacuum_sql, "PRAGMA incremental_vacuum(%d)",
+            max_pages > 0 ? max_pages : 0);
+  } else {
+    // databases created before auto_vacuum was set need a full VACUUM once
+    sprintf(vacuum_sql, "PRAGMA auto_vacuum = INCREMENTAL; VACUUM");
+  }
+  if (sqlite3_exec(ctx->db, vacuum_sql, NULL, NULL, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  return NO_ERROR;
+}
+
+// Page number of `rel="last"` in a `Link:` header line, 0 when absent.
+// <https://api.github.com/user/starred?per_page=100&page=12>; rel="last"
+static int32_t parse_last_page(const char *buffer, size_t len) {
+  if (len <= 5 || strncasecmp(buffer, "link:", 5) != 0) {
+    return 0;
+  }
+  const char *rel = memmem(buffer, len, "rel=\"last\"", 10);
+  if (!rel) {
+    return 0;
+  }
+  const char *url = rel;
+  while (url > buffer && *url != '<') {
+    url--;
+  }
+  const char *page = url;
+  while ((page = memmem(page, rel - page, "page=", 5))) {
+    // skip per_page=
+    if (page[-1] == '?' || page[-1] == '&') {
+      return atoi(page + 5);
+    }
+    page += 5;
+  }
+  return 0;
+}
+
+static size_t api_header_cb(char *buffer, size_t size, size_t nitems,
+                            void *userdata) {
+  omg_context ctx = userdata;
+  int32_t last_page = parse_last_page(buffer, size * nitems);
+  if (last_page > 0) {
+    ctx->last_page = last_page;
+  }
+  return size * nitems;
+}
+
 static omg_error omg_request(omg_context ctx, const char *method,
                              const char *url, json_t *payload, json_t **out) {
   CURL *curl = ctx->api_curl;
+  ctx->resp_bytes = 0;
+  ctx->last_page = 0;
 
   curl_easy_setopt(curl, CURLOPT_URL, url);
   auto_string request = NULL;
@@ -295,11 +1009,14 @@ static omg_error omg_request(omg_context ctx, const char *method,
   auto_response chunk = {.memory = malloc(1), .size = 0};
   curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, mem_cb);
   curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *)&chunk);
+  curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, api_header_cb);
+  curl_easy_setopt(curl, CURLOPT_HEADERDATA, (void *)ctx);
 
   CURLcode res = curl_easy_perform(curl);
   if (res != CURLE_OK) {
     return new_error(OMG_CODE_CURL, curl_easy_strerror(res));
   }
+  ctx->resp_bytes = chunk.size;
 
   long response_code;
   curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
@@ -385,10 +1102,10 @@ void omg_free_repo(omg_repo *repo) {
     FREE_OBJ_FIELD(repo, full_name);
     FREE_OBJ_FIELD(repo, description);
     FREE_OBJ_FIELD(repo, created_at);
-    FREE_OBJ_FIELD(repo, license);
     FREE_OBJ_FIELD(repo, pushed_at);
-    FREE_OBJ_FIELD(repo, lang);
     FREE_OBJ_FIELD(repo, homepage);
+    // license, lang and topics are interned, owned by omg_context
+    free(repo->topics);
   }
 }
 
@@ -398,10 +1115,7 @@ void omg_free_repo_list(omg_repo_list *repo_lst) {
     printf("free omg_repo_list, length is %zu\n", repo_lst->length);
 #endif
 
-    for (size_t i = 0; i < repo_lst->length; i++) {
-      omg_free_repo(&(repo_lst->repo_array[i]));
-    }
-    free(repo_lst->repo_array);
+    arena_free_array(repo_lst->repo_array);
   }
 }
 
@@ -414,31 +1128,104 @@ static char *dup_json_string(json_t *root, const char *key) {
   }
 }
 
-static omg_repo repo_from_json(json_t *root) {
+static char *arena_json_string(arena a, json_t *root, const char *key) {
+  return arena_strdup(a, json_string_value(json_object_get(root, key)));
+}
+
+static const char *intern_json_string(omg_context ctx, json_t *root,
+                                      const char *key) {
+  return omg_intern(ctx, json_string_value(json_object_get(root, key)));
+}
+
+// When a is NULL, strings are allocated in heap.
+// Topics are few and shared by many repositories, so they are interned.
+static const char **intern_json_topics(omg_context ctx, arena a, json_t *root,
+                                       size_t *length) {
+  json_t *topics = json_object_get(root, "topics");
+  *length = json_array_size(topics);
+  if (*length == 0) {
+    return NULL;
+  }
+  size_t size = sizeof(const char *) * *length;
+  const char **out = a ? arena_alloc_array(a, size) : malloc(size);
+  for (size_t i = 0; i < *length; i++) {
+    out[i] = omg_intern(ctx, json_string_value(json_array_get(topics, i)));
+  }
+  return out;
+}
+
+static omg_repo repo_from_json(omg_context ctx, arena a, json_t *root) {
+  size_t topic_length = 0;
+  const char **topics = intern_json_topics(ctx, a, root, &topic_length);
   json_t *license = json_object_get(root, "license");
-  char *license_key = NULL;
+  const char *license_key = NULL;
   if (!json_is_null(license)) {
-    license_key = dup_json_string(license, "key");
+    license_key = intern_json_string(ctx, license, "key");
   }
   return (omg_repo){
       .id = json_integer_value(json_object_get(root, "id")),
-      .full_name = dup_json_string(root, "full_name"),
-      .description = dup_json_string(root, "description"),
+      .full_name = arena_json_string(a, root, "full_name"),
+      .description = arena_json_string(a, root, "description"),
       .private = json_boolean_value(json_object_get(root, "private")),
-      .created_at = dup_json_string(root, "created_at"),
+      .created_at = arena_json_string(a, root, "created_at"),
       .license = license_key,
-      .pushed_at = dup_json_string(root, "pushed_at"),
+      .pushed_at = arena_json_string(a, root, "pushed_at"),
       .stargazers_count =
           json_integer_value(json_object_get(root, "stargazers_count")),
       .watchers_count =
           json_integer_value(json_object_get(root, "watchers_count")),
       .forks_count = json_integer_value(json_object_get(root, "forks_count")),
-      .lang = dup_json_string(root, "language"),
-      .homepage = dup_json_string(root, "homepage"),
+      .lang = intern_json_string(ctx, root, "language"),
+      .homepage = arena_json_string(a, root, "homepage"),
       .size = json_integer_value(json_object_get(root, "size")),
+      .topics = topics,
+      .topic_length = topic_length,
   };
 }
 
+// Like gist files, only topics no longer present are deleted.
+static omg_error save_repo_topics(omg_context ctx, omg_repo_list repo_lst) {
+  const char *sql = "insert or ignore into omg_repo_topic(repo_id, topic) "
+                    "values(?1, ?2)";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sql = "delete from omg_repo_topic where repo_id = ?1 "
+        "and topic not in (select value from json_each(?2))";
+  auto_sqlite3_stmt delete_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &delete_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  for (size_t i = 0; i < repo_lst.length; i++) {
+    omg_repo repo = repo_lst.repo_array[i];
+    json_auto_t *topics = json_array();
+    for (size_t j = 0; j < repo.topic_length; j++) {
+      if (!repo.topics[j]) {
+        continue;
+      }
+      sqlite3_bind_int(stmt, 1, repo.id);
+      sqlite3_bind_text(stmt, 2, repo.topics[j], -1, SQLITE_STATIC);
+      if (sqlite3_step(stmt) != SQLITE_DONE) {
+        fprintf(stderr, "insert topic(%s) failed. msg:%s\n", repo.topics[j],
+                sqlite3_errmsg(ctx->db));
+      }
+      sqlite3_reset(stmt);
+      json_array_append_new(topics, json_string(repo.topics[j]));
+    }
+
+    omg_auto_char topics_json = json_dumps(topics, JSON_COMPACT);
+    sqlite3_bind_int(delete_stmt, 1, repo.id);
+    sqlite3_bind_text(delete_stmt, 2, topics_json, -1, SQLITE_STATIC);
+    if (sqlite3_step(delete_stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(delete_stmt);
+  }
+  return NO_ERROR;
+}
+
 static omg_error save_repos(omg_context ctx, omg_repo_list repo_lst) {
   const char *sql =
       "INSERT INTO omg_repo (id, full_name, description, private, "
@@ -481,8 +1268,13 @@ static omg_error save_repos(omg_context ctx, omg_repo_list repo_lst) {
     sqlite3_reset(stmt);
     sqlite3_clear_bindings(stmt);
   }
+  invalidate_repo_snapshots(ctx);
 
-  return NO_ERROR;
+  return save_repo_topics(ctx, repo_lst);
+}
+
+omg_error omg__save_repos(omg_context ctx, omg_repo_list repo_lst) {
+  return save_repos(ctx, repo_lst);
 }
 
 static omg_error fetch_repos_by_page(omg_context ctx, size_t page_num,
@@ -497,9 +1289,10 @@ static omg_error fetch_repos_by_page(omg_context ctx, size_t page_num,
   }
 
   size_t resp_len = json_array_size(resp);
-  omg_repo *repos = malloc(sizeof(omg_repo) * resp_len);
+  arena a = arena_new(sizeof(omg_repo) * resp_len);
+  omg_repo *repos = (omg_repo *)a->data;
   for (size_t i = 0; i < resp_len; i++) {
-    repos[i] = repo_from_json(json_array_get(resp, i));
+    repos[i] = repo_from_json(ctx, a, json_array_get(resp, i));
   }
   *out = (omg_repo_list){.repo_array = repos, .length = resp_len};
   return NO_ERROR;
@@ -512,8 +1305,9 @@ static omg_error save_created_repos(omg_context ctx, omg_repo_list repo_lst) {
   }
 
   auto_sqlite3_stmt stmt = NULL;
-  const char *sql =
-      "insert or ignore into omg_created_repo(repo_id) values (?1)";
+  const char *sql = "insert into omg_created_repo(repo_id, sync_gen) "
+                    "values (?1, ?2) "
+                    "on conflict(repo_id) do update set sync_gen = ?2";
   int rc = sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL);
   if (rc) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
@@ -522,10 +1316,10 @@ static omg_error save_created_repos(omg_context ctx, omg_repo_list repo_lst) {
   for (size_t i = 0; i < repo_lst.length; i++) {
     omg_repo repo = repo_lst.repo_array[i];
     sqlite3_bind_int(stmt, 1, repo.id);
-    rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      fprintf(stderr, "insert %s failed. code:%d, msg:%s\n", repo.full_name, rc,
-              sqlite3_errmsg(ctx->db));
+    sqlite3_bind_int64(stmt, 2, ctx->sync_gen);
+    // a row left unstamped would be swept, so the sync must not finish
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
     }
     sqlite3_reset(stmt);
     sqlite3_clear_bindings(stmt);
@@ -535,7 +1329,14 @@ static omg_error save_created_repos(omg_context ctx, omg_repo_list repo_lst) {
 }
 
 omg_error omg_sync_created_repos(omg_context ctx) {
+  omg_error err = start_sync(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  sync_tracker tracker = start_sync_tracker("created repositories");
   size_t page_num = 1;
+  bool complete = false;
   while (true) {
 #ifdef OMG_TEST
     if (page_num > 2) {
@@ -543,31 +1344,96 @@ omg_error omg_sync_created_repos(omg_context ctx) {
     }
 #endif
     omg_auto_repo_list repo_lst = {};
-    omg_error err = fetch_repos_by_page(ctx, page_num++, &repo_lst);
+    err = fetch_repos_by_page(ctx, page_num++, &repo_lst);
     if (!is_ok(err)) {
       return err;
     }
     err = save_created_repos(ctx, repo_lst);
+    invalidate_repo_snapshots(ctx);
     if (!is_ok(err)) {
       return err;
     }
 
-    if (repo_lst.length < PER_PAGE) {
+    complete = repo_lst.length < PER_PAGE;
+    report_sync_page(ctx, &tracker, repo_lst.length, complete);
+    if (complete) {
       break;
     }
   };
 
-  return NO_ERROR;
+  err = finish_sync(ctx, "omg_created_repo", complete);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  return save_repo_snapshots(ctx);
 }
 
-static omg_error prepare_query_repos_sql(omg_context ctx, bool is_star,
-                                         const char *keyword,
-                                         const char *language,
-                                         sqlite3_stmt **out) {
-  omg_auto_char sql = malloc(SQL_DEFAULT_LEN);
-  const char *first_column =
-      is_star ? "datetime(starred_at, 'localtime') as starred_at"
-              : "1"; // placehold
+// JSON array of topics, NULL when there is none.
+static char *topics_to_json(const char *const *topics) {
+  if (!topics || !topics[0]) {
+    return NULL;
+  }
+  json_auto_t *arr = json_array();
+  for (size_t i = 0; topics[i]; i++) {
+    json_array_append_new(arr, json_string(topics[i]));
+  }
+  return json_dumps(arr, JSON_COMPACT);
+}
+
+// Append conditions of filter to sql ending with a where clause over view
+// aliased as r. keyword and language are bound as ?1 and ?2, topics and
+// excluded topics as JSON arrays ?3 and ?4, see bind_repo_filter.
+static void append_repo_filter_sql(char *sql, const omg_repo_filter *filter) {
+  if (!empty_string(filter->keyword)) {
+    strcat(sql, " and (full_name like '%' || ?1 || '%' COLLATE NOCASE"
+                " or description like '%' || ?1 || '%' COLLATE NOCASE) ");
+  }
+
+  if (!empty_string(filter->language)) {
+    strcat(sql, " and lang = ?2 COLLATE NOCASE ");
+  }
+
+  // r.id is qualified since json_each has an id column too
+  if (filter->topics && filter->topics[0]) {
+    strcat(sql, " and not exists (select 1 from json_each(?3) j"
+                " where not exists (select 1 from omg_repo_topic t"
+                " where t.repo_id = r.id and t.topic = j.value)) ");
+  }
+  if (filter->excluded_topics && filter->excluded_topics[0]) {
+    strcat(sql, " and not exists (select 1 from omg_repo_topic t"
+                " where t.repo_id = r.id"
+                " and t.topic in (select value from json_each(?4))) ");
+  }
+}
+
+static void bind_repo_filter(sqlite3_stmt *stmt,
+                             const omg_repo_filter *filter) {
+  if (!empty_string(filter->keyword)) {
+    sqlite3_bind_text(stmt, 1, filter->keyword, -1, SQLITE_STATIC);
+  }
+  if (!empty_string(filter->language)) {
+    sqlite3_bind_text(stmt, 2, filter->language, -1, SQLITE_STATIC);
+  }
+  omg_auto_char topics = topics_to_json(filter->topics);
+  if (topics) {
+    sqlite3_bind_text(stmt, 3, topics, -1, SQLITE_TRANSIENT);
+  }
+  omg_auto_char excluded_topics = topics_to_json(filter->excluded_topics);
+  if (excluded_topics) {
+    sqlite3_bind_text(stmt, 4, excluded_topics, -1, SQLITE_TRANSIENT);
+  }
+}
+
+static omg_error prepare_query_repos_sql(omg_context ctx, bool is_star,
+                                         const omg_repo_filter *filter,
+                                         sqlite3_stmt **out) {
+  // topic filters need more room than others
+  const size_t sql_len = SQL_DEFAULT_LEN * 2;
+  omg_auto_char sql = malloc(sql_len);
+  const char *first_column =
+      is_star ? "datetime(starred_at, 'localtime') as starred_at"
+              : "1"; // placehold
   const char *table_name =
       is_star ? "omg_starred_repo_view" : "omg_created_repo_view";
   sprintf(sql,
@@ -577,28 +1443,24 @@ static omg_error prepare_query_repos_sql(omg_context ctx, bool is_star,
           "license,"
           "datetime(pushed_at, 'localtime'),"
           "stargazers_count,watchers_count,forks_count,lang,homepage,`size` "
-          "from %s where 1",
+          "from %s r where 1",
           first_column, table_name);
-
-  if (!empty_string(keyword)) {
-    strcat(sql, " and (full_name like '%");
-    strcat(sql, keyword);
-    strcat(sql, "%' COLLATE NOCASE or description like '%");
-    strcat(sql, keyword);
-    strcat(sql, "%' COLLATE NOCASE) ");
-  }
-
-  if (!empty_string(language)) {
-    strcat(sql, " and lang='");
-    strcat(sql, language);
-    strcat(sql, "' COLLATE NOCASE ");
-  }
+  append_repo_filter_sql(sql, filter);
 
   strcat(sql, " order by ");
-  strcat(sql, is_star ? "starred_at" : "created_at");
-  strcat(sql, " desc");
+  switch (filter->sort) {
+  case OMG_SORT_STARS:
+    strcat(sql, "stargazers_count desc");
+    break;
+  case OMG_SORT_NAME:
+    strcat(sql, "full_name COLLATE NOCASE asc");
+    break;
+  default:
+    strcat(sql, is_star ? "starred_at" : "created_at");
+    strcat(sql, " desc");
+  }
   size_t current_len = strlen(sql);
-  if (current_len >= SQL_DEFAULT_LEN) {
+  if (current_len >= sql_len) {
     fprintf(stderr, "SQL too long. max:%ld, sql:%s\n", current_len, sql);
     return (omg_error){.code = OMG_CODE_INTERNAL,
                        .message = "buffer not enough when append order_by"};
@@ -611,25 +1473,34 @@ static omg_error prepare_query_repos_sql(omg_context ctx, bool is_star,
   if (rc) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
+  bind_repo_filter(*out, filter);
 
   return NO_ERROR;
 }
 
-static omg_repo repo_from_db(sqlite3_stmt *stmt) {
+static char *arena_column_text(arena a, sqlite3_stmt *stmt, int column) {
+  // sqlite3_column_bytes must be called after sqlite3_column_text
+  const char *text = (const char *)sqlite3_column_text(stmt, column);
+  return arena_strndup(a, text, sqlite3_column_bytes(stmt, column));
+}
+
+static omg_repo repo_from_db(omg_context ctx, arena a, sqlite3_stmt *stmt) {
   omg_repo repo = {};
   int column = 1;
   repo.id = sqlite3_column_int(stmt, column++);
-  repo.full_name = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-  repo.description = strdup_when_not_null(sqlite3_column_text(stmt, column++));
+  repo.full_name = arena_column_text(a, stmt, column++);
+  repo.description = arena_column_text(a, stmt, column++);
   repo.private = sqlite3_column_int(stmt, column++);
-  repo.created_at = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-  repo.license = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-  repo.pushed_at = strdup_when_not_null(sqlite3_column_text(stmt, column++));
+  repo.created_at = arena_column_text(a, stmt, column++);
+  repo.license =
+      omg_intern(ctx, (const char *)sqlite3_column_text(stmt, column++));
+  repo.pushed_at = arena_column_text(a, stmt, column++);
   repo.stargazers_count = sqlite3_column_int(stmt, column++);
   repo.watchers_count = sqlite3_column_int(stmt, column++);
   repo.forks_count = sqlite3_column_int(stmt, column++);
-  repo.lang = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-  repo.homepage = strdup_when_not_null(sqlite3_column_text(stmt, column++));
+  repo.lang =
+      omg_intern(ctx, (const char *)sqlite3_column_text(stmt, column++));
+  repo.homepage = arena_column_text(a, stmt, column++);
   repo.size = sqlite3_column_int(stmt, column++);
   return repo;
 }
@@ -637,28 +1508,71 @@ static omg_repo repo_from_db(sqlite3_stmt *stmt) {
 omg_error omg_query_created_repos(omg_context ctx, const char *keyword,
                                   const char *language, omg_repo_list *out) {
   auto_sqlite3_stmt stmt = NULL;
-  omg_error err = prepare_query_repos_sql(ctx, false, keyword, language, &stmt);
+  omg_repo_filter filter = {.keyword = keyword, .language = language};
+  omg_error err = prepare_query_repos_sql(ctx, false, &filter, &stmt);
   if (!is_ok(err)) {
     return err;
   }
 
-  size_t rows_count = 0;
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    rows_count++;
+  arena a = arena_new(sizeof(omg_repo) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_repo) * (row + 1));
+    ((omg_repo *)a->data)[row++] = repo_from_db(ctx, a, stmt);
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_repo_list){.repo_array = (omg_repo *)a->data, .length = row};
+  return NO_ERROR;
+}
+
+// Strings are borrowed from stmt, valid until next step.
+static omg_repo repo_view_from_db(sqlite3_stmt *stmt) {
+  omg_repo repo = {};
+  int column = 1;
+  repo.id = sqlite3_column_int(stmt, column++);
+  repo.full_name = (const char *)sqlite3_column_text(stmt, column++);
+  repo.description = (const char *)sqlite3_column_text(stmt, column++);
+  repo.private = sqlite3_column_int(stmt, column++);
+  repo.created_at = (const char *)sqlite3_column_text(stmt, column++);
+  repo.license = (const char *)sqlite3_column_text(stmt, column++);
+  repo.pushed_at = (const char *)sqlite3_column_text(stmt, column++);
+  repo.stargazers_count = sqlite3_column_int(stmt, column++);
+  repo.watchers_count = sqlite3_column_int(stmt, column++);
+  repo.forks_count = sqlite3_column_int(stmt, column++);
+  repo.lang = (const char *)sqlite3_column_text(stmt, column++);
+  repo.homepage = (const char *)sqlite3_column_text(stmt, column++);
+  repo.size = sqlite3_column_int(stmt, column++);
+  return repo;
+}
+
+omg_error omg_query_created_repos_each(omg_context ctx,
+                                       const omg_repo_filter *filter,
+                                       omg_repo_visitor visitor,
+                                       void *userdata) {
+  const omg_repo_filter no_filter = {};
+  auto_sqlite3_stmt stmt = NULL;
+  omg_error err =
+      prepare_query_repos_sql(ctx, false, filter ? filter : &no_filter, &stmt);
+  if (!is_ok(err)) {
+    return err;
   }
 
-  omg_repo *repo_arr = malloc(sizeof(omg_repo) * rows_count);
-  sqlite3_reset(stmt);
-  size_t row = 0;
   int rc = 0;
   while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-    repo_arr[row++] = repo_from_db(stmt);
+    omg_repo repo = repo_view_from_db(stmt);
+    if (!visitor(&repo, userdata)) {
+      return NO_ERROR;
+    }
   }
   if (rc != SQLITE_DONE) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
 
-  *out = (omg_repo_list){.repo_array = repo_arr, .length = rows_count};
   return NO_ERROR;
 }
 
@@ -682,10 +1596,7 @@ void omg_free_starred_repo_list(omg_starred_repo_list *star_list) {
     printf("free omg_star_list, length is %zu\n", star_list->length);
 #endif
 
-    for (size_t i = 0; i < star_list->length; i++) {
-      omg_free_starred_repo(&(star_list->star_array[i]));
-    }
-    free(star_list->star_array);
+    arena_free_array(star_list->star_array);
   }
 }
 
@@ -701,12 +1612,13 @@ static omg_error fetch_starred_repos_by_page(omg_context ctx, size_t page_num,
   }
 
   size_t resp_len = json_array_size(resp);
-  omg_starred_repo *stars = malloc(sizeof(omg_starred_repo) * resp_len);
+  arena a = arena_new(sizeof(omg_starred_repo) * resp_len);
+  omg_starred_repo *stars = (omg_starred_repo *)a->data;
   for (size_t i = 0; i < resp_len; i++) {
     json_t *one_star = json_array_get(resp, i);
     stars[i] = (omg_starred_repo){
-        .repo = repo_from_json(json_object_get(one_star, "repo")),
-        .starred_at = dup_json_string(one_star, "starred_at")};
+        .repo = repo_from_json(ctx, a, json_object_get(one_star, "repo")),
+        .starred_at = arena_json_string(a, one_star, "starred_at")};
   }
   *out = (omg_starred_repo_list){.star_array = stars, .length = resp_len};
 
@@ -717,55 +1629,59 @@ omg_error omg_query_starred_repos(omg_context ctx, const char *keyword,
                                   const char *language,
                                   omg_starred_repo_list *out_lst) {
   auto_sqlite3_stmt stmt = NULL;
-  omg_error err = prepare_query_repos_sql(ctx, true, keyword, language, &stmt);
+  omg_repo_filter filter = {.keyword = keyword, .language = language};
+  omg_error err = prepare_query_repos_sql(ctx, true, &filter, &stmt);
   if (!is_ok(err)) {
     return err;
   }
 
-  size_t rows_count = 0;
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    rows_count++;
-  }
-
-  omg_starred_repo *star_arr = malloc(sizeof(omg_starred_repo) * rows_count);
-  sqlite3_reset(stmt);
+  arena a = arena_new(sizeof(omg_starred_repo) * 64);
   size_t row = 0;
   int rc = 0;
   while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-    omg_repo repo = {};
-    {
-      int column = 1;
-      repo.id = sqlite3_column_int(stmt, column++);
-      repo.full_name =
-          strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.description =
-          strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.private = sqlite3_column_int(stmt, column++);
-      repo.created_at =
-          strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.license = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.pushed_at =
-          strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.stargazers_count = sqlite3_column_int(stmt, column++);
-      repo.watchers_count = sqlite3_column_int(stmt, column++);
-      repo.forks_count = sqlite3_column_int(stmt, column++);
-      repo.lang = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.homepage = strdup_when_not_null(sqlite3_column_text(stmt, column++));
-      repo.size = sqlite3_column_int(stmt, column++);
+    a = arena_reserve(a, sizeof(omg_starred_repo) * (row + 1));
+    ((omg_starred_repo *)a->data)[row++] = (omg_starred_repo){
+        .starred_at = arena_column_text(a, stmt, 0),
+        .repo = repo_from_db(ctx, a, stmt),
     };
+  }
 
-    star_arr[row++] = (omg_starred_repo){
-        .starred_at = strdup_when_not_null(sqlite3_column_text(stmt, 0)),
-        .repo = repo,
-    };
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out_lst = (omg_starred_repo_list){
+      .star_array = (omg_starred_repo *)a->data, .length = row};
+  return NO_ERROR;
+}
+
+omg_error omg_query_starred_repos_each(omg_context ctx,
+                                       const omg_repo_filter *filter,
+                                       omg_starred_repo_visitor visitor,
+                                       void *userdata) {
+  const omg_repo_filter no_filter = {};
+  auto_sqlite3_stmt stmt = NULL;
+  omg_error err =
+      prepare_query_repos_sql(ctx, true, filter ? filter : &no_filter, &stmt);
+  if (!is_ok(err)) {
+    return err;
   }
 
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    omg_starred_repo star = {
+        .starred_at = (char *)sqlite3_column_text(stmt, 0),
+        .repo = repo_view_from_db(stmt),
+    };
+    if (!visitor(&star, userdata)) {
+      return NO_ERROR;
+    }
+  }
   if (rc != SQLITE_DONE) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
 
-  *out_lst =
-      (omg_starred_repo_list){.star_array = star_arr, .length = rows_count};
   return NO_ERROR;
 }
 
@@ -784,9 +1700,10 @@ static omg_error save_starred_repos(omg_context ctx,
 
   auto_sqlite3_stmt stmt = NULL;
   const char *sql =
-      "insert into omg_starred_repo(starred_at, repo_id) values (?1, ?2)"
+      "insert into omg_starred_repo(starred_at, repo_id, sync_gen) "
+      "values (?1, ?2, ?3)"
       "on conflict(repo_id)"
-      "do update set starred_at = ?1";
+      "do update set starred_at = ?1, sync_gen = ?3";
   int rc = sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL);
   if (rc) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
@@ -796,10 +1713,10 @@ static omg_error save_starred_repos(omg_context ctx,
     omg_starred_repo star = star_lst.star_array[i];
     sqlite3_bind_text(stmt, 1, star.starred_at, -1, SQLITE_STATIC);
     sqlite3_bind_int(stmt, 2, star.repo.id);
-    rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      fprintf(stderr, "insert %s failed. code:%d, msg:%s\n",
-              star.repo.full_name, rc, sqlite3_errmsg(ctx->db));
+    sqlite3_bind_int64(stmt, 3, ctx->sync_gen);
+    // a row left unstamped would be swept, so the sync must not finish
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
     }
     sqlite3_reset(stmt);
     sqlite3_clear_bindings(stmt);
@@ -809,7 +1726,14 @@ static omg_error save_starred_repos(omg_context ctx,
 }
 
 omg_error omg_sync_starred_repos(omg_context ctx) {
+  omg_error err = start_sync(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  sync_tracker tracker = start_sync_tracker("starred repositories");
   size_t page_num = 1;
+  bool complete = false;
   while (true) {
 #ifdef OMG_TEST
     if (page_num > 2) {
@@ -817,21 +1741,44 @@ omg_error omg_sync_starred_repos(omg_context ctx) {
     }
 #endif
     omg_auto_starred_repo_list star_lst = {};
-    omg_error err = fetch_starred_repos_by_page(ctx, page_num++, &star_lst);
+    err = fetch_starred_repos_by_page(ctx, page_num++, &star_lst);
     if (!is_ok(err)) {
       return err;
     }
     err = save_starred_repos(ctx, star_lst);
+    invalidate_repo_snapshots(ctx);
     if (!is_ok(err)) {
       return err;
     }
 
-    if (star_lst.length < PER_PAGE) {
+    complete = star_lst.length < PER_PAGE;
+    report_sync_page(ctx, &tracker, star_lst.length, complete);
+    if (complete) {
       break;
     }
   };
 
-  return NO_ERROR;
+  err = finish_sync(ctx, "omg_starred_repo", complete);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  return save_repo_snapshots(ctx);
+}
+
+omg_error omg__sync_starred_page(omg_context ctx,
+                                 omg_starred_repo_list star_lst,
+                                 bool complete) {
+  omg_error err = start_sync(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+  err = save_starred_repos(ctx, star_lst);
+  invalidate_repo_snapshots(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+  return finish_sync(ctx, "omg_starred_repo", complete);
 }
 
 omg_error omg_unstar_repo(omg_context ctx, size_t repo_id) {
@@ -860,6 +1807,7 @@ omg_error omg_unstar_repo(omg_context ctx, size_t repo_id) {
   if (sqlite3_step(stmt) != SQLITE_DONE) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
+  invalidate_repo_snapshots(ctx);
 
   char url[128];
   sprintf(url, "%s/user/starred/%s", API_ROOT, full_name);
@@ -894,575 +1842,4557 @@ omg_error omg_star_repo(omg_context ctx, const char *repo_full_name) {
     return err;
   }
 
-  omg_auto_repo repo = repo_from_json(repo_resp);
+  omg_auto_repo repo = repo_from_json(ctx, NULL, repo_resp);
   omg_auto_char now = (char *)iso8601_now();
   omg_starred_repo starred_repo = {.starred_at = now, .repo = repo};
   omg_starred_repo_list star_lst = {.star_array = &starred_repo, .length = 1};
-  return save_starred_repos(ctx, star_lst);
+  err = save_starred_repos(ctx, star_lst);
+  invalidate_repo_snapshots(ctx);
+  return err;
 }
 
-void omg_free_user(omg_user *user) {
-  if (user) {
+/***********************/
+/* Repository snapshot */
+/***********************/
+
+static void free_repo_snapshot(repo_snapshot *snap) {
+  if (snap->mapping) {
 #ifdef VERBOSE
-    printf("free omg_user\n");
+    printf("unmap repo snapshot, length is %zu\n", snap->length);
 #endif
-    FREE_OBJ_FIELD(user, login);
-    FREE_OBJ_FIELD(user, name);
-    FREE_OBJ_FIELD(user, company);
-    FREE_OBJ_FIELD(user, blog);
-    FREE_OBJ_FIELD(user, location);
-    FREE_OBJ_FIELD(user, email);
-    FREE_OBJ_FIELD(user, bio);
-    FREE_OBJ_FIELD(user, twitter_username);
-    FREE_OBJ_FIELD(user, created_at);
+    munmap(snap->mapping, snap->mapping_size);
+    free(snap->langs);
+  } else if (snap->built) {
+#ifdef VERBOSE
+    printf("free repo snapshot, length is %zu\n", snap->length);
+#endif
+    free(snap->ids);
+    free(snap->stars);
+    free(snap->forks);
+    free(snap->sizes);
+    free(snap->times);
+    free(snap->lang_ids);
+    free(snap->name_ranks);
+    free(snap->text);
+    free(snap->search);
+    free(snap->text_offsets);
+    free(snap->langs);
+    free(snap->topic_text);
+    free(snap->topic_offsets);
+    free(snap->topic_counts);
+    free(snap->topic_starts);
+    free(snap->topic_rows);
+    free(snap->topic_words);
   }
+  *snap = (repo_snapshot){};
 }
 
-static int integer_or_default(json_t *obj, const char *key) {
-  json_t *tmp = json_object_get(obj, key);
-  if (tmp) {
-    return json_integer_value(tmp);
+static void invalidate_repo_snapshots(omg_context ctx) {
+  free_repo_snapshot(&ctx->starred_snapshot);
+  free_repo_snapshot(&ctx->created_snapshot);
+  if (ctx->starred_snapshot_path) {
+    unlink(ctx->starred_snapshot_path);
+    unlink(ctx->created_snapshot_path);
   }
-  return -1;
 }
 
-omg_error omg_whoami(omg_context ctx, const char *username, omg_user *out) {
-  char url[128];
-  if (empty_string(username)) {
-    sprintf(url, "%s/user", API_ROOT);
-  } else {
-    sprintf(url, "%s/users/%s", API_ROOT, username);
+void omg_free_snapshot_hits(omg_snapshot_hits *hits) {
+  if (hits) {
+    free(hits->row_array);
   }
+}
 
-  json_auto_t *resp = NULL;
-  omg_error err = omg_request(ctx, GET_METHOD, url, NULL, &resp);
-  if (!is_ok(err)) {
-    return err;
+static uint16_t snapshot_lang_id(omg_context ctx, repo_snapshot *snap,
+                                 const char *lang) {
+  lang = omg_intern(ctx, lang);
+  if (lang == NULL) {
+    return 0;
   }
-
-  json_t *msg = json_object_get(resp, "message");
-  if (msg) {
-    fprintf(stderr, "get whoami(%s) failed. %s", username, json_dumps(resp, 0));
-    if (0 == strcmp(json_string_value(msg), "Not Found")) {
-      return (omg_error){.code = OMG_CODE_GITHUB, .message = "User Not Found"};
+  // There are only dozens of languages, linear search is fast enough.
+  for (size_t i = 1; i < snap->lang_len; i++) {
+    if (snap->langs[i] == lang) {
+      return i;
     }
-
-    return (omg_error){.code = OMG_CODE_GITHUB,
-                       .message = "GitHub PAT authentication failed"};
   }
-
-  int private_repos = integer_or_default(resp, "total_private_repos");
-  int private_gists = integer_or_default(resp, "private_gists");
-  int disk_usage = integer_or_default(resp, "disk_usage");
-  *out = (omg_user){
-      .login = dup_json_string(resp, "login"),
-      .id = json_integer_value(json_object_get(resp, "id")),
-      .name = dup_json_string(resp, "name"),
-      .company = dup_json_string(resp, "company"),
-      .blog = dup_json_string(resp, "blog"),
-      .location = dup_json_string(resp, "location"),
-      .email = dup_json_string(resp, "email"),
-      .hireable = json_boolean_value(json_object_get(resp, "hireable")),
-      .bio = dup_json_string(resp, "bio"),
-      .twitter_username = dup_json_string(resp, "twitter_username"),
-      .public_repos = json_integer_value(json_object_get(resp, "public_repos")),
-      .public_gists = json_integer_value(json_object_get(resp, "public_gists")),
-      .private_repos = private_repos,
-      .private_gists = private_gists,
-      .followers = json_integer_value(json_object_get(resp, "followers")),
-      .following = json_integer_value(json_object_get(resp, "following")),
-      .created_at = dup_json_string(resp, "created_at"),
-      .disk_usage = disk_usage,
-  };
-
-  return NO_ERROR;
-}
-
-void omg_free_commit(omg_commit *commit) {
-  if (commit) {
-    FREE_OBJ_FIELD(commit, sha);
-    FREE_OBJ_FIELD(commit, message);
+  if (snap->lang_len > UINT16_MAX) {
+    return 0;
   }
+  snap->langs =
+      realloc(snap->langs, sizeof(const char *) * (snap->lang_len + 1));
+  snap->langs[snap->lang_len] = lang;
+  return snap->lang_len++;
 }
 
-void omg_free_commit_list(omg_commit_list *commit_lst) {
-  if (commit_lst) {
-    for (size_t i = 0; i < commit_lst->length; i++) {
-      omg_free_commit(&commit_lst->commit_array[i]);
-    }
+typedef struct {
+  const char *name;
+  uint32_t row;
+} snapshot_name;
 
-    free(commit_lst->commit_array);
-  }
+static int compare_snapshot_name(const void *a, const void *b) {
+  return strcasecmp(((const snapshot_name *)a)->name,
+                    ((const snapshot_name *)b)->name);
 }
 
-omg_error omg_query_commits(omg_context ctx, const char *full_name, int limit,
-                            omg_commit_list *out) {
-  char url[128];
-  sprintf(url, "%s/repos/%s/commits?per_page=%d", API_ROOT, full_name, limit);
-  json_auto_t *resp = NULL;
-  omg_error err = omg_request(ctx, GET_METHOD, url, NULL, &resp);
-  if (!is_ok(err)) {
-    return err;
-  }
-
-  size_t resp_len = json_array_size(resp);
-  omg_commit *commit_array = malloc(sizeof(omg_commit) * resp_len);
-  for (size_t i = 0; i < resp_len; i++) {
-    json_t *one_commit = json_array_get(resp, i);
-    json_t *commit_info = json_object_get(one_commit, "commit");
-    json_t *author_info = json_object_get(commit_info, "author");
-    commit_array[i] = (omg_commit){
-        .sha = dup_json_string(one_commit, "sha"),
-        .message = dup_json_string(commit_info, "message"),
-        .author = dup_json_string(author_info, "name"),
-        .email = dup_json_string(author_info, "email"),
-        .date = dup_json_string(author_info, "date"),
-    };
-  }
+// Words of a bitmap over all rows of snapshot.
+static size_t snapshot_words(size_t length) { return (length + 63) / 64; }
 
-  *out = (omg_commit_list){.commit_array = commit_array, .length = resp_len};
+// A bitmap is smaller than a row list once a topic covers more than one row
+// in 32.
+static bool topic_is_dense(size_t count, size_t length) {
+  return count > 2 * snapshot_words(length);
+}
 
-  return NO_ERROR;
+static void *grow_array(void *array, size_t *cap, size_t need,
+                        size_t elem_size) {
+  if (need <= *cap) {
+    return array;
+  }
+  *cap = need > *cap * 2 ? need : *cap * 2;
+  return realloc(array, elem_size * *cap);
 }
 
-// releases
+typedef struct {
+  int32_t id;
+  uint32_t row;
+} snapshot_id_row;
+
+static int compare_snapshot_id_row(const void *a, const void *b) {
+  int32_t x = ((const snapshot_id_row *)a)->id;
+  int32_t y = ((const snapshot_id_row *)b)->id;
+  return x < y ? -1 : (x > y);
+}
 
-void omg_free_release_asset(omg_release_asset *release_asset) {
-  if (release_asset) {
-    FREE_OBJ_FIELD(release_asset, name);
-    FREE_OBJ_FIELD(release_asset, download_url);
-  }
+static int compare_row(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+  return x < y ? -1 : (x > y);
 }
 
-void omg_free_release(omg_release *release) {
-  if (release) {
-    FREE_OBJ_FIELD(release, name);
-    FREE_OBJ_FIELD(release, login);
-    FREE_OBJ_FIELD(release, tag_name);
-    FREE_OBJ_FIELD(release, body);
-    FREE_OBJ_FIELD(release, published_at);
-    if (release->asset_array) {
-      for (int i = 0; i < release->asset_length; i++) {
-        omg_free_release_asset(&release->asset_array[i]);
-      }
-      free(release->asset_array);
-    }
-  }
+typedef struct {
+  repo_snapshot *snap;
+  size_t topic_cap;
+  size_t offsets_cap;
+  size_t text_cap;
+  size_t rows_cap;
+  size_t words_cap;
+  // Rows of the current topic, whose name is at the end of topic_text
+  uint32_t *group;
+  size_t group_len;
+  size_t group_cap;
+} topic_index_builder;
+
+static void start_topic(topic_index_builder *b, const char *topic) {
+  repo_snapshot *snap = b->snap;
+  size_t text_start = snap->topic_offsets[snap->topic_len];
+  size_t topic_size = strlen(topic) + 1;
+  snap->topic_text = grow_array(snap->topic_text, &b->text_cap,
+                                text_start + topic_size, sizeof(char));
+  memcpy(snap->topic_text + text_start, topic, topic_size);
+  b->group_len = 0;
 }
 
-void omg_free_release_list(omg_release_list *release_lst) {
-  if (release_lst) {
-    for (size_t i = 0; i < release_lst->length; i++) {
-      omg_free_release(&release_lst->release_array[i]);
+// Store the current topic, topics of no row in this snapshot are dropped.
+static void finish_topic(topic_index_builder *b) {
+  repo_snapshot *snap = b->snap;
+  size_t count = b->group_len;
+  if (count == 0) {
+    return;
+  }
+  uint32_t *rows = b->group;
+  qsort(rows, count, sizeof(uint32_t), compare_row);
+  size_t i = snap->topic_len++;
+  // counts and starts share topic_cap
+  size_t cap = b->topic_cap;
+  snap->topic_counts =
+      grow_array(snap->topic_counts, &cap, i + 1, sizeof(uint32_t));
+  snap->topic_starts =
+      grow_array(snap->topic_starts, &b->topic_cap, i + 1, sizeof(uint32_t));
+  snap->topic_offsets = grow_array(snap->topic_offsets, &b->offsets_cap,
+                                   i + 2, sizeof(uint32_t));
+  snap->topic_counts[i] = count;
+  const char *topic = snap->topic_text + snap->topic_offsets[i];
+  snap->topic_offsets[i + 1] = snap->topic_offsets[i] + strlen(topic) + 1;
+  if (topic_is_dense(count, snap->length)) {
+    size_t words = snapshot_words(snap->length);
+    snap->topic_starts[i] = snap->topic_words_len;
+    snap->topic_words =
+        grow_array(snap->topic_words, &b->words_cap,
+                   snap->topic_words_len + words, sizeof(uint64_t));
+    uint64_t *bits = snap->topic_words + snap->topic_words_len;
+    memset(bits, 0, sizeof(uint64_t) * words);
+    for (size_t j = 0; j < count; j++) {
+      bits[rows[j] / 64] |= 1ULL << (rows[j] % 64);
     }
-
-    free(release_lst->release_array);
+    snap->topic_words_len += words;
+  } else {
+    snap->topic_starts[i] = snap->topic_rows_len;
+    snap->topic_rows =
+        grow_array(snap->topic_rows, &b->rows_cap,
+                   snap->topic_rows_len + count, sizeof(uint32_t));
+    memcpy(snap->topic_rows + snap->topic_rows_len, rows,
+           sizeof(uint32_t) * count);
+    snap->topic_rows_len += count;
   }
 }
 
-omg_error omg_query_releases(omg_context ctx, const char *full_name, int limit,
-                             omg_release_list *out) {
-  char url[128];
-  sprintf(url, "%s/repos/%s/releases?per_page=%d", API_ROOT, full_name, limit);
-  json_auto_t *resp = NULL;
-  omg_error err = omg_request(ctx, GET_METHOD, url, NULL, &resp);
-  if (!is_ok(err)) {
-    return err;
+static omg_error build_topic_index(omg_context ctx, repo_snapshot *snap) {
+  // idx_topic returns topics in order, topics of repositories outside this
+  // snapshot are skipped
+  const char *sql = "select topic, repo_id from omg_repo_topic "
+                    "order by topic COLLATE NOCASE";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
 
-  size_t resp_len = json_array_size(resp);
-  omg_release *release_array = malloc(sizeof(omg_release) * resp_len);
-  for (size_t i = 0; i < resp_len; i++) {
-    json_t *one_release = json_array_get(resp, i);
-    json_t *asset_info = json_object_get(one_release, "assets");
-    json_t *author_info = json_object_get(one_release, "author");
+  snapshot_id_row *id_rows =
+      malloc(sizeof(snapshot_id_row) * (snap->length + 1));
+  for (size_t i = 0; i < snap->length; i++) {
+    id_rows[i] = (snapshot_id_row){.id = snap->ids[i], .row = i};
+  }
+  qsort(id_rows, snap->length, sizeof(snapshot_id_row),
+        compare_snapshot_id_row);
 
-    size_t asset_length = json_array_size(asset_info);
-    omg_release_asset *asset_array =
-        malloc(sizeof(omg_release_asset) * asset_length);
-    for (size_t j = 0; j < asset_length; j++) {
-      json_t *one_asset = json_array_get(asset_info, j);
-      asset_array[j] = (omg_release_asset){
-          .id = json_integer_value(json_object_get(one_asset, "id")),
-          .name = dup_json_string(one_asset, "name"),
-          .size = json_integer_value(json_object_get(one_asset, "size")),
-          .download_count =
-              json_integer_value(json_object_get(one_asset, "download_count")),
-          .download_url = dup_json_string(one_asset, "browser_download_url"),
-      };
+  topic_index_builder b = {.snap = snap, .offsets_cap = 1, .group_cap = 64};
+  b.group = malloc(sizeof(uint32_t) * b.group_cap);
+  snap->topic_offsets = calloc(1, sizeof(uint32_t));
+  bool in_topic = false;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const char *topic = (const char *)sqlite3_column_text(stmt, 0);
+    if (!topic) {
+      continue;
+    }
+    if (!in_topic ||
+        strcasecmp(snap->topic_text + snap->topic_offsets[snap->topic_len],
+                   topic) != 0) {
+      if (in_topic) {
+        finish_topic(&b);
+      }
+      start_topic(&b, topic);
+      in_topic = true;
     }
 
-    release_array[i] = (omg_release){
-        .id = json_integer_value(json_object_get(one_release, "id")),
-        .login = dup_json_string(author_info, "login"),
-        .name = dup_json_string(one_release, "name"),
-        .tag_name = dup_json_string(one_release, "tag_name"),
-        .body = dup_json_string(one_release, "body"),
-        .draft = json_boolean_value(json_object_get(one_release, "draft")),
-        .prerelease =
-            json_boolean_value(json_object_get(one_release, "prerelease")),
-        .published_at = dup_json_string(one_release, "published_at"),
-        .asset_array = asset_array,
-        .asset_length = asset_length,
-    };
+    snapshot_id_row key = {.id = sqlite3_column_int(stmt, 1)};
+    snapshot_id_row *found =
+        bsearch(&key, id_rows, snap->length, sizeof(snapshot_id_row),
+                compare_snapshot_id_row);
+    if (found) {
+      b.group = grow_array(b.group, &b.group_cap, b.group_len + 1,
+                           sizeof(uint32_t));
+      b.group[b.group_len++] = found->row;
+    }
+  }
+  if (in_topic) {
+    finish_topic(&b);
+  }
+  free(b.group);
+  free(id_rows);
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
-
-  *out = (omg_release_list){.release_array = release_array, .length = resp_len};
-
   return NO_ERROR;
 }
 
-// trending
+static omg_error build_repo_snapshot(omg_context ctx, bool is_star,
+                                     repo_snapshot *out) {
+  const char *table_name =
+      is_star ? "omg_starred_repo_view" : "omg_created_repo_view";
+  const char *time_column = is_star ? "starred_at" : "created_at";
+  char sql[SQL_DEFAULT_LEN];
+  sprintf(sql, "select count(*) from %s", table_name);
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  if (sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  size_t rows_count = sqlite3_column_int64(stmt, 0);
+
+  sprintf(sql,
+          "select id, full_name, description, lang, stargazers_count, "
+          "forks_count, `size`, strftime('%%s', %s) "
+          "from %s order by %s desc",
+          time_column, table_name, time_column);
+  sqlite3_finalize(stmt);
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  repo_snapshot snap = {
+      .built = true,
+      .ids = malloc(sizeof(int32_t) * rows_count),
+      .stars = malloc(sizeof(int32_t) * rows_count),
+      .forks = malloc(sizeof(int32_t) * rows_count),
+      .sizes = malloc(sizeof(int32_t) * rows_count),
+      .times = malloc(sizeof(int64_t) * rows_count),
+      .lang_ids = malloc(sizeof(uint16_t) * rows_count),
+      .name_ranks = malloc(sizeof(uint32_t) * rows_count),
+      .text_offsets = malloc(sizeof(uint32_t) * (rows_count + 1)),
+      .langs = calloc(1, sizeof(const char *)),
+      .lang_len = 1,
+  };
+  size_t text_cap = 64 * rows_count + 1;
+  size_t text_len = 0;
+  snap.text = malloc(text_cap);
+  snapshot_name *names = malloc(sizeof(snapshot_name) * rows_count);
+
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && row < rows_count) {
+    const char *full_name = (const char *)sqlite3_column_text(stmt, 1);
+    const char *desc = (const char *)sqlite3_column_text(stmt, 2);
+    size_t name_len = full_name ? strlen(full_name) : 0;
+    size_t desc_len = desc ? strlen(desc) : 0;
+    if (text_len + name_len + desc_len + 2 > text_cap) {
+      text_cap = (text_cap + name_len + desc_len + 2) * 2;
+      snap.text = realloc(snap.text, text_cap);
+    }
+    snap.text_offsets[row] = text_len;
+    memcpy(snap.text + text_len, full_name ? full_name : "", name_len + 1);
+    text_len += name_len + 1;
+    memcpy(snap.text + text_len, desc ? desc : "", desc_len + 1);
+    text_len += desc_len + 1;
+
+    snap.ids[row] = sqlite3_column_int(stmt, 0);
+    snap.lang_ids[row] = snapshot_lang_id(
+        ctx, &snap, (const char *)sqlite3_column_text(stmt, 3));
+    snap.stars[row] = sqlite3_column_int(stmt, 4);
+    snap.forks[row] = sqlite3_column_int(stmt, 5);
+    snap.sizes[row] = sqlite3_column_int(stmt, 6);
+    snap.times[row] = sqlite3_column_int64(stmt, 7);
+    row++;
+  }
+  snap.length = row;
+  snap.text_offsets[row] = text_len;
+  if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
+    free(names);
+    free_repo_snapshot(&snap);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  snap.search = malloc(text_len + 1);
+  for (size_t i = 0; i < text_len; i++) {
+    char c = snap.text[i];
+    snap.search[i] = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+  }
+
+  for (size_t i = 0; i < snap.length; i++) {
+    names[i] = (snapshot_name){.name = snap.text + snap.text_offsets[i],
+                               .row = i};
+  }
+  qsort(names, snap.length, sizeof(snapshot_name), compare_snapshot_name);
+  for (size_t i = 0; i < snap.length; i++) {
+    snap.name_ranks[names[i].row] = i;
+  }
+  free(names);
+
+  omg_error err = build_topic_index(ctx, &snap);
+  if (!is_ok(err)) {
+    free_repo_snapshot(&snap);
+    return err;
+  }
+
+  *out = snap;
+  return NO_ERROR;
+}
+
+// Snapshot file
+// A snapshot is persisted with the same column layout as repo_snapshot, so
+// loading it is a mmap plus bounds checks, no parsing. The file is removed
+// whenever the snapshot is invalidated, and written again once it's rebuilt.
+// It records the database version it was built at, a file left behind by
+// another process or an older build is rejected once the database moved on.
+//
+// Layout: header, then sections in this order, each aligned to 8 bytes:
+//   ids, stars, forks, sizes: int32[length]
+//   times: int64[length]
+//   lang_ids: uint16[length]
+//   name_ranks: uint32[length]
+//   text_offsets: uint32[length + 1]
+//   text, search: char[text_len]
+//   lang_offsets: uint32[lang_len + 1], offsets of "lang\0" in lang_text
+//   lang_text: char[lang_text_len]
+//   topic_offsets: uint32[topic_len + 1], offsets of "topic\0" in topic_text
+//   topic_text: char[topic_text_len]
+//   topic_counts, topic_starts: uint32[topic_len]
+//   topic_rows: uint32[topic_rows_len]
+//   topic_words: uint64[topic_words_len]
+// All integers are in native byte order, the file is a local cache only.
+
+#define SNAPSHOT_MAGIC "OMGSNAP"
+#define SNAPSHOT_VERSION 3
+
+enum {
+  SECTION_IDS,
+  SECTION_STARS,
+  SECTION_FORKS,
+  SECTION_SIZES,
+  SECTION_TIMES,
+  SECTION_LANG_IDS,
+  SECTION_NAME_RANKS,
+  SECTION_TEXT_OFFSETS,
+  SECTION_TEXT,
+  SECTION_SEARCH,
+  SECTION_LANG_OFFSETS,
+  SECTION_LANG_TEXT,
+  SECTION_TOPIC_OFFSETS,
+  SECTION_TOPIC_TEXT,
+  SECTION_TOPIC_COUNTS,
+  SECTION_TOPIC_STARTS,
+  SECTION_TOPIC_ROWS,
+  SECTION_TOPIC_WORDS,
+  SECTION_COUNT,
+};
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t length;
+  uint32_t lang_len;
+  uint32_t topic_len;
+  uint64_t text_len;
+  uint64_t lang_text_len;
+  uint64_t topic_text_len;
+  uint64_t topic_rows_len;
+  uint64_t topic_words_len;
+  int64_t db_version;
+  // byte offset of each section from beginning of file
+  uint64_t sections[SECTION_COUNT];
+} snapshot_header;
+
+static size_t align8(size_t n) { return (n + 7) & ~(size_t)7; }
+
+static void snapshot_section_sizes(const snapshot_header *header,
+                                   size_t sizes[SECTION_COUNT]) {
+  size_t len = header->length;
+  sizes[SECTION_IDS] = sizeof(int32_t) * len;
+  sizes[SECTION_STARS] = sizeof(int32_t) * len;
+  sizes[SECTION_FORKS] = sizeof(int32_t) * len;
+  sizes[SECTION_SIZES] = sizeof(int32_t) * len;
+  sizes[SECTION_TIMES] = sizeof(int64_t) * len;
+  sizes[SECTION_LANG_IDS] = sizeof(uint16_t) * len;
+  sizes[SECTION_NAME_RANKS] = sizeof(uint32_t) * len;
+  sizes[SECTION_TEXT_OFFSETS] = sizeof(uint32_t) * (len + 1);
+  sizes[SECTION_TEXT] = header->text_len;
+  sizes[SECTION_SEARCH] = header->text_len;
+  sizes[SECTION_LANG_OFFSETS] = sizeof(uint32_t) * (header->lang_len + 1);
+  sizes[SECTION_LANG_TEXT] = header->lang_text_len;
+  sizes[SECTION_TOPIC_OFFSETS] = sizeof(uint32_t) * (header->topic_len + 1);
+  sizes[SECTION_TOPIC_TEXT] = header->topic_text_len;
+  sizes[SECTION_TOPIC_COUNTS] = sizeof(uint32_t) * header->topic_len;
+  sizes[SECTION_TOPIC_STARTS] = sizeof(uint32_t) * header->topic_len;
+  sizes[SECTION_TOPIC_ROWS] = sizeof(uint32_t) * header->topic_rows_len;
+  sizes[SECTION_TOPIC_WORDS] = sizeof(uint64_t) * header->topic_words_len;
+}
+
+// Write to a temporary file first, then rename, so readers never see a
+// partial file.
+static omg_error write_repo_snapshot(const repo_snapshot *snap,
+                                     const char *path) {
+  size_t lang_text_len = 0;
+  uint32_t *lang_offsets = malloc(sizeof(uint32_t) * (snap->lang_len + 1));
+  for (size_t i = 0; i < snap->lang_len; i++) {
+    lang_offsets[i] = lang_text_len;
+    lang_text_len += (snap->langs[i] ? strlen(snap->langs[i]) : 0) + 1;
+  }
+  lang_offsets[snap->lang_len] = lang_text_len;
+  char *lang_text = malloc(lang_text_len + 1);
+  for (size_t i = 0; i < snap->lang_len; i++) {
+    const char *lang = snap->langs[i] ? snap->langs[i] : "";
+    memcpy(lang_text + lang_offsets[i], lang, strlen(lang) + 1);
+  }
+
+  snapshot_header header = {
+      .magic = SNAPSHOT_MAGIC,
+      .version = SNAPSHOT_VERSION,
+      .length = snap->length,
+      .lang_len = snap->lang_len,
+      .text_len = snap->text_offsets[snap->length],
+      .lang_text_len = lang_text_len,
+      .topic_len = snap->topic_len,
+      .topic_text_len = snap->topic_offsets[snap->topic_len],
+      .topic_rows_len = snap->topic_rows_len,
+      .topic_words_len = snap->topic_words_len,
+      .db_version = snap->db_version,
+  };
+  const void *data[SECTION_COUNT] = {
+      snap->ids,           snap->stars,        snap->forks,
+      snap->sizes,         snap->times,        snap->lang_ids,
+      snap->name_ranks,    snap->text_offsets, snap->text,
+      snap->search,        lang_offsets,       lang_text,
+      snap->topic_offsets, snap->topic_text,   snap->topic_counts,
+      snap->topic_starts,  snap->topic_rows,   snap->topic_words,
+  };
+  size_t sizes[SECTION_COUNT];
+  snapshot_section_sizes(&header, sizes);
+  size_t offset = align8(sizeof(header));
+  for (size_t i = 0; i < SECTION_COUNT; i++) {
+    header.sections[i] = offset;
+    offset = align8(offset + sizes[i]);
+  }
+
+  omg_auto_char tmp_path = malloc(strlen(path) + 8);
+  sprintf(tmp_path, "%s.tmp", path);
+  FILE *f = fopen(tmp_path, "wb");
+  if (!f) {
+    free(lang_offsets);
+    free(lang_text);
+    return new_error(OMG_CODE_INTERNAL, "open snapshot file failed");
+  }
+  static const char padding[8] = {};
+  bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+  size_t written = sizeof(header);
+  for (size_t i = 0; ok && i < SECTION_COUNT; i++) {
+    ok = fwrite(padding, 1, header.sections[i] - written, f) ==
+             header.sections[i] - written &&
+         (sizes[i] == 0 || fwrite(data[i], 1, sizes[i], f) == sizes[i]);
+    written = header.sections[i] + sizes[i];
+  }
+  ok = (fclose(f) == 0) && ok;
+  free(lang_offsets);
+  free(lang_text);
+  if (!ok || rename(tmp_path, path)) {
+    unlink(tmp_path);
+    return new_error(OMG_CODE_INTERNAL, "write snapshot file failed");
+  }
+
+  return NO_ERROR;
+}
+
+// Return false when the file is missing, outdated or corrupted, then the
+// caller should build from database.
+static bool load_repo_snapshot(omg_context ctx, const char *path,
+                               int64_t db_version, repo_snapshot *out) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) || (size_t)st.st_size < sizeof(snapshot_header)) {
+    close(fd);
+    return false;
+  }
+  size_t file_size = st.st_size;
+  void *mapping = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  const snapshot_header *header = mapping;
+  size_t sizes[SECTION_COUNT];
+  snapshot_section_sizes(header, sizes);
+  // Counts are checked against file size first, so section sizes can't wrap.
+  bool valid = 0 == memcmp(header->magic, SNAPSHOT_MAGIC, 8) &&
+               header->version == SNAPSHOT_VERSION &&
+               header->db_version == db_version && header->lang_len > 0 &&
+               header->lang_len <= UINT16_MAX + 1 &&
+               header->text_len <= file_size &&
+               header->topic_text_len <= file_size &&
+               header->topic_rows_len <= file_size &&
+               header->topic_words_len <= file_size;
+  for (size_t i = 0; valid && i < SECTION_COUNT; i++) {
+    valid = header->sections[i] % 8 == 0 &&
+            header->sections[i] >= sizeof(snapshot_header) &&
+            header->sections[i] <= file_size &&
+            sizes[i] <= file_size - header->sections[i];
+  }
+  if (!valid) {
+    munmap(mapping, file_size);
+    return false;
+  }
+
+  char *base = mapping;
+  const uint32_t *text_offsets =
+      (const uint32_t *)(base + header->sections[SECTION_TEXT_OFFSETS]);
+  const uint32_t *lang_offsets =
+      (const uint32_t *)(base + header->sections[SECTION_LANG_OFFSETS]);
+  const char *lang_text = base + header->sections[SECTION_LANG_TEXT];
+  const uint16_t *lang_ids =
+      (const uint16_t *)(base + header->sections[SECTION_LANG_IDS]);
+  const char *text = base + header->sections[SECTION_TEXT];
+  valid = text_offsets[header->length] == header->text_len &&
+          (header->text_len == 0 || text[header->text_len - 1] == '\0') &&
+          lang_offsets[header->lang_len] == header->lang_text_len &&
+          (header->lang_text_len == 0 ||
+           lang_text[header->lang_text_len - 1] == '\0');
+  // Cheap compared with reading the file, and keeps a corrupted file from
+  // sending readers out of the mapping.
+  for (size_t i = 0; valid && i < header->length; i++) {
+    valid = text_offsets[i] <= text_offsets[i + 1] &&
+            lang_ids[i] < header->lang_len;
+  }
+  for (size_t i = 0; valid && i < header->lang_len; i++) {
+    valid = lang_offsets[i] <= lang_offsets[i + 1];
+  }
+  const uint32_t *topic_offsets =
+      (const uint32_t *)(base + header->sections[SECTION_TOPIC_OFFSETS]);
+  const char *topic_text = base + header->sections[SECTION_TOPIC_TEXT];
+  const uint32_t *topic_counts =
+      (const uint32_t *)(base + header->sections[SECTION_TOPIC_COUNTS]);
+  const uint32_t *topic_starts =
+      (const uint32_t *)(base + header->sections[SECTION_TOPIC_STARTS]);
+  const uint32_t *topic_rows =
+      (const uint32_t *)(base + header->sections[SECTION_TOPIC_ROWS]);
+  valid = valid && topic_offsets[header->topic_len] == header->topic_text_len &&
+          (header->topic_text_len == 0 ||
+           topic_text[header->topic_text_len - 1] == '\0');
+  size_t words = snapshot_words(header->length);
+  for (size_t i = 0; valid && i < header->topic_len; i++) {
+    uint64_t end = (uint64_t)topic_starts[i] +
+                   (topic_is_dense(topic_counts[i], header->length)
+                        ? words
+                        : topic_counts[i]);
+    valid = topic_offsets[i] <= topic_offsets[i + 1] &&
+            end <= (topic_is_dense(topic_counts[i], header->length)
+                        ? header->topic_words_len
+                        : header->topic_rows_len);
+  }
+  for (size_t i = 0; valid && i < header->topic_rows_len; i++) {
+    valid = topic_rows[i] < header->length;
+  }
+  if (!valid) {
+    munmap(mapping, file_size);
+    return false;
+  }
+
+  // Languages are few, intern them so that lang_ids compare by pointer.
+  const char **langs = calloc(header->lang_len, sizeof(const char *));
+  for (size_t i = 1; i < header->lang_len; i++) {
+    langs[i] = omg_intern(ctx, lang_text + lang_offsets[i]);
+  }
+
+  *out = (repo_snapshot){
+      .built = true,
+      .length = header->length,
+      .ids = (int32_t *)(base + header->sections[SECTION_IDS]),
+      .stars = (int32_t *)(base + header->sections[SECTION_STARS]),
+      .forks = (int32_t *)(base + header->sections[SECTION_FORKS]),
+      .sizes = (int32_t *)(base + header->sections[SECTION_SIZES]),
+      .times = (int64_t *)(base + header->sections[SECTION_TIMES]),
+      .lang_ids = (uint16_t *)lang_ids,
+      .name_ranks = (uint32_t *)(base + header->sections[SECTION_NAME_RANKS]),
+      .text = (char *)text,
+      .search = base + header->sections[SECTION_SEARCH],
+      .text_offsets = (uint32_t *)text_offsets,
+      .langs = langs,
+      .lang_len = header->lang_len,
+      .topic_len = header->topic_len,
+      .topic_text = (char *)topic_text,
+      .topic_offsets = (uint32_t *)topic_offsets,
+      .topic_counts = (uint32_t *)topic_counts,
+      .topic_starts = (uint32_t *)topic_starts,
+      .topic_rows = (uint32_t *)topic_rows,
+      .topic_rows_len = header->topic_rows_len,
+      .topic_words =
+          (uint64_t *)(base + header->sections[SECTION_TOPIC_WORDS]),
+      .topic_words_len = header->topic_words_len,
+      .mapping = mapping,
+      .mapping_size = file_size,
+      .db_version = db_version,
+  };
+  return true;
+}
+
+// Every change to rows a snapshot is built from is logged to omg_changelog,
+// whose AUTOINCREMENT seq only grows, so it serves as the version of those
+// rows, also across processes sharing the database.
+static omg_error snapshot_db_version(omg_context ctx, int64_t *out) {
+  const char *sql = "select coalesce((select seq from sqlite_sequence "
+                    "where name = 'omg_changelog'), 0)";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  *out = sqlite3_column_int64(stmt, 0);
+  return NO_ERROR;
+}
+
+static omg_error ensure_repo_snapshot(omg_context ctx, bool is_star,
+                                      repo_snapshot **out) {
+  repo_snapshot *snap =
+      is_star ? &ctx->starred_snapshot : &ctx->created_snapshot;
+  const char *path =
+      is_star ? ctx->starred_snapshot_path : ctx->created_snapshot_path;
+  int64_t db_version = 0;
+  omg_error err = snapshot_db_version(ctx, &db_version);
+  if (!is_ok(err)) {
+    return err;
+  }
+  // changed by another connection, or by a write path not invalidating it
+  if (snap->built && snap->db_version != db_version) {
+    free_repo_snapshot(snap);
+  }
+  if (!snap->built &&
+      !(path && load_repo_snapshot(ctx, path, db_version, snap))) {
+    err = build_repo_snapshot(ctx, is_star, snap);
+    if (!is_ok(err)) {
+      return err;
+    }
+    snap->db_version = db_version;
+    if (path) {
+      // a missing snapshot file only slows down next start
+      err = write_repo_snapshot(snap, path);
+#ifdef VERBOSE
+      if (!is_ok(err)) {
+        print_error(err);
+      }
+#endif
+    }
+  }
+  *out = snap;
+  return NO_ERROR;
+}
+
+// Rebuild both snapshots and their files after repositories changed by sync,
+// so that next start is served from the files.
+static omg_error save_repo_snapshots(omg_context ctx) {
+  repo_snapshot *snap = NULL;
+  omg_error err = ensure_repo_snapshot(ctx, true, &snap);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  return ensure_repo_snapshot(ctx, false, &snap);
+}
+
+// Find row whose text contains offset, text_offsets is ascending.
+static uint32_t snapshot_row_of(repo_snapshot *snap, size_t offset) {
+  size_t lo = 0;
+  size_t hi = snap->length;
+  while (hi - lo > 1) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (snap->text_offsets[mid] <= offset) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+typedef struct {
+  int64_t key;
+  uint32_t row;
+} snapshot_sort_key;
+
+static int compare_snapshot_sort_key(const void *a, const void *b) {
+  const snapshot_sort_key *x = a;
+  const snapshot_sort_key *y = b;
+  if (x->key != y->key) {
+    return x->key < y->key ? -1 : 1;
+  }
+  return x->row < y->row ? -1 : (x->row > y->row);
+}
+
+static void sort_snapshot_hits(repo_snapshot *snap, omg_repo_sort sort,
+                               uint32_t *rows, size_t len) {
+  if (sort == OMG_SORT_DEFAULT || len < 2) {
+    // rows are already in starred_at/created_at desc order
+    return;
+  }
+
+  snapshot_sort_key *keys = malloc(sizeof(snapshot_sort_key) * len);
+  for (size_t i = 0; i < len; i++) {
+    uint32_t row = rows[i];
+    int64_t key = sort == OMG_SORT_STARS ? -(int64_t)snap->stars[row]
+                                         : (int64_t)snap->name_ranks[row];
+    keys[i] = (snapshot_sort_key){.key = key, .row = row};
+  }
+  qsort(keys, len, sizeof(snapshot_sort_key), compare_snapshot_sort_key);
+  for (size_t i = 0; i < len; i++) {
+    rows[i] = keys[i].row;
+  }
+  free(keys);
+}
+
+// Index of topic in snapshot, or -1 when no repository is tagged with it.
+static int64_t snapshot_topic_of(repo_snapshot *snap, const char *topic) {
+  size_t lo = 0;
+  size_t hi = snap->topic_len;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    int cmp = strcasecmp(snap->topic_text + snap->topic_offsets[mid], topic);
+    if (cmp == 0) {
+      return mid;
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return -1;
+}
+
+// Bitmap of rows tagged with topic i, sparse topics are expanded into
+// scratch.
+static const uint64_t *snapshot_topic_bits(repo_snapshot *snap, size_t i,
+                                           uint64_t *scratch) {
+  if (topic_is_dense(snap->topic_counts[i], snap->length)) {
+    return snap->topic_words + snap->topic_starts[i];
+  }
+
+  memset(scratch, 0, sizeof(uint64_t) * snapshot_words(snap->length));
+  const uint32_t *rows = snap->topic_rows + snap->topic_starts[i];
+  for (size_t j = 0; j < snap->topic_counts[i]; j++) {
+    scratch[rows[j] / 64] |= 1ULL << (rows[j] % 64);
+  }
+  return scratch;
+}
+
+// Rows matching topics and excluded_topics of filter as a bitmap, NULL when
+// filter has no topics. Combining topics is a few word-wise AND/ANDNOT over
+// length / 64 words, cheap enough to run on every keystroke.
+static uint64_t *snapshot_topic_mask(repo_snapshot *snap,
+                                     const omg_repo_filter *filter) {
+  bool by_topics = filter->topics && filter->topics[0];
+  bool by_excluded = filter->excluded_topics && filter->excluded_topics[0];
+  if (!by_topics && !by_excluded) {
+    return NULL;
+  }
+
+  size_t words = snapshot_words(snap->length);
+  uint64_t *mask = malloc(sizeof(uint64_t) * (words + 1));
+  uint64_t *scratch = malloc(sizeof(uint64_t) * (words + 1));
+  memset(mask, 0xff, sizeof(uint64_t) * words);
+  for (const char *const *t = filter->topics; t && *t; t++) {
+    int64_t i = snapshot_topic_of(snap, *t);
+    if (i < 0) {
+      memset(mask, 0, sizeof(uint64_t) * words);
+      break;
+    }
+    const uint64_t *bits = snapshot_topic_bits(snap, i, scratch);
+    for (size_t w = 0; w < words; w++) {
+      mask[w] &= bits[w];
+    }
+  }
+  for (const char *const *t = filter->excluded_topics; t && *t; t++) {
+    int64_t i = snapshot_topic_of(snap, *t);
+    if (i < 0) {
+      continue;
+    }
+    const uint64_t *bits = snapshot_topic_bits(snap, i, scratch);
+    for (size_t w = 0; w < words; w++) {
+      mask[w] &= ~bits[w];
+    }
+  }
+  if (snap->length % 64) {
+    mask[words - 1] &= (1ULL << (snap->length % 64)) - 1;
+  }
+  free(scratch);
+  return mask;
+}
+
+omg_error omg_filter_repo_snapshot(omg_context ctx, bool is_star,
+                                   const omg_repo_filter *filter,
+                                   omg_snapshot_hits *out) {
+  repo_snapshot *snap = NULL;
+  omg_error err = ensure_repo_snapshot(ctx, is_star, &snap);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  const omg_repo_filter no_filter = {};
+  if (!filter) {
+    filter = &no_filter;
+  }
+  uint32_t *rows = malloc(sizeof(uint32_t) * (snap->length + 1));
+  size_t hits = 0;
+
+  bool by_lang = !empty_string(filter->language);
+  uint16_t lang_id = 0;
+  if (by_lang) {
+    for (size_t i = 1; i < snap->lang_len; i++) {
+      if (0 == strcasecmp(snap->langs[i], filter->language)) {
+        lang_id = i;
+        break;
+      }
+    }
+    if (lang_id == 0) {
+      *out = (omg_snapshot_hits){.row_array = rows, .length = 0};
+      return NO_ERROR;
+    }
+  }
+
+  uint64_t *mask = snapshot_topic_mask(snap, filter);
+  if (empty_string(filter->keyword) && mask) {
+    size_t words = snapshot_words(snap->length);
+    for (size_t w = 0; w < words; w++) {
+      for (uint64_t bits = mask[w]; bits; bits &= bits - 1) {
+        uint32_t row = w * 64 + __builtin_ctzll(bits);
+        if (!by_lang || snap->lang_ids[row] == lang_id) {
+          rows[hits++] = row;
+        }
+      }
+    }
+  } else if (empty_string(filter->keyword)) {
+    for (size_t i = 0; i < snap->length; i++) {
+      if (!by_lang || snap->lang_ids[i] == lang_id) {
+        rows[hits++] = i;
+      }
+    }
+  } else {
+    size_t keyword_len = strlen(filter->keyword);
+    omg_auto_char keyword = malloc(keyword_len + 1);
+    for (size_t i = 0; i <= keyword_len; i++) {
+      char c = filter->keyword[i];
+      keyword[i] = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    }
+    // Scan the whole contiguous text once, memmem is vectorized in libc.
+    // Rows are separated by '\0', so a match never spans two rows.
+    const char *begin = snap->search;
+    const char *end = begin + snap->text_offsets[snap->length];
+    const char *p = begin;
+    while (p < end && (p = memmem(p, end - p, keyword, keyword_len))) {
+      uint32_t row = snapshot_row_of(snap, p - begin);
+      if ((!by_lang || snap->lang_ids[row] == lang_id) &&
+          (!mask || (mask[row / 64] >> (row % 64)) & 1)) {
+        rows[hits++] = row;
+      }
+      // skip to next row
+      p = begin + snap->text_offsets[row + 1];
+    }
+  }
+
+  free(mask);
+  sort_snapshot_hits(snap, filter->sort, rows, hits);
+  *out = (omg_snapshot_hits){.row_array = rows, .length = hits};
+  return NO_ERROR;
+}
+
+omg_error omg_get_snapshot_repo(omg_context ctx, bool is_star, uint32_t row,
+                                omg_snapshot_repo *out) {
+  // rows come from the last filter, so keep serving the snapshot it used
+  repo_snapshot *snap =
+      is_star ? &ctx->starred_snapshot : &ctx->created_snapshot;
+  if (!snap->built) {
+    omg_error err = ensure_repo_snapshot(ctx, is_star, &snap);
+    if (!is_ok(err)) {
+      return err;
+    }
+  }
+  if (row >= snap->length) {
+    return (omg_error){.code = OMG_CODE_INTERNAL,
+                       .message = "snapshot row out of range"};
+  }
+
+  const char *full_name = snap->text + snap->text_offsets[row];
+  *out = (omg_snapshot_repo){
+      .id = snap->ids[row],
+      .full_name = full_name,
+      .description = full_name + strlen(full_name) + 1,
+      .lang = snap->langs[snap->lang_ids[row]],
+      .stargazers_count = snap->stars[row],
+      .forks_count = snap->forks[row],
+      .size = snap->sizes[row],
+      .time = snap->times[row],
+  };
+  return NO_ERROR;
+}
+
+static int compare_topic(const void *a, const void *b) {
+  const omg_topic *x = a;
+  const omg_topic *y = b;
+  if (x->count != y->count) {
+    return y->count - x->count;
+  }
+  return strcasecmp(x->name, y->name);
+}
+
+omg_error omg_query_topics(omg_context ctx, bool is_star,
+                           omg_topic_list *out) {
+  repo_snapshot *snap = NULL;
+  omg_error err = ensure_repo_snapshot(ctx, is_star, &snap);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  // names are copied, snapshot may be rebuilt while the list is in use
+  arena a = arena_new(sizeof(omg_topic) * (snap->topic_len + 1));
+  omg_topic *topics = (omg_topic *)a->data;
+  for (size_t i = 0; i < snap->topic_len; i++) {
+    topics[i] = (omg_topic){
+        .name = arena_strdup(a, snap->topic_text + snap->topic_offsets[i]),
+        .count = snap->topic_counts[i],
+    };
+  }
+  qsort(topics, snap->topic_len, sizeof(omg_topic), compare_topic);
+
+  *out = (omg_topic_list){.topic_array = topics, .length = snap->topic_len};
+  return NO_ERROR;
+}
+
+void omg_free_topic_list(omg_topic_list *lst) {
+  if (lst) {
+#ifdef VERBOSE
+    printf("free omg_topic_list, length is %zu\n", lst->length);
+#endif
+    arena_free_array(lst->topic_array);
+  }
+}
+
+/**********/
+/* Facets */
+/**********/
+
+static const char *FACET_NAMES[] = {"lang", "license", "private"};
+
+// Rows are (facet, value, count), grouped by facet in FACET_NAMES order.
+static const char *FACET_SQL =
+    "SELECT facet, `value`, `count` FROM omg_repo_facet "
+    "WHERE is_star = ?5 AND `count` > 0 "
+    "ORDER BY facet, `count` DESC, `value`";
+
+static const char *FILTERED_FACET_SQL =
+    "WITH hits AS (SELECT lang, license, private FROM %s r WHERE 1 %s) "
+    "SELECT 'lang' AS facet, coalesce(lang, '') AS `value`, count(*) AS n "
+    "FROM hits GROUP BY 2 "
+    "UNION ALL SELECT 'license', coalesce(license, ''), count(*) "
+    "FROM hits GROUP BY 2 "
+    "UNION ALL SELECT 'private', "
+    "CASE WHEN private THEN 'private' ELSE 'public' END, count(*) "
+    "FROM hits GROUP BY 2 "
+    "ORDER BY 1, 3 DESC, 2";
+
+omg_error omg_query_facets(omg_context ctx, bool is_star,
+                           const omg_repo_filter *filter,
+                           omg_facet_list *out) {
+  const omg_repo_filter no_filter = {};
+  if (!filter) {
+    filter = &no_filter;
+  }
+  bool filtered = !empty_string(filter->keyword) ||
+                  !empty_string(filter->language) ||
+                  (filter->topics && filter->topics[0]) ||
+                  (filter->excluded_topics && filter->excluded_topics[0]);
+
+  auto_sqlite3_stmt stmt = NULL;
+  if (filtered) {
+    char conditions[SQL_DEFAULT_LEN * 2];
+    conditions[0] = '\0';
+    append_repo_filter_sql(conditions, filter);
+    omg_auto_char sql =
+        malloc(strlen(FILTERED_FACET_SQL) + strlen(conditions) + 32);
+    sprintf(sql, FILTERED_FACET_SQL,
+            is_star ? "omg_starred_repo_view" : "omg_created_repo_view",
+            conditions);
+    if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    bind_repo_filter(stmt, filter);
+  } else {
+    if (sqlite3_prepare_v2(ctx->db, FACET_SQL, -1, &stmt, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_bind_int(stmt, 5, is_star);
+  }
+
+  arena a = arena_new(sizeof(omg_facet) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const char *facet = (const char *)sqlite3_column_text(stmt, 0);
+    const char *value = (const char *)sqlite3_column_text(stmt, 1);
+    omg_facet_kind kind = OMG_FACET_LANG;
+    while (kind < OMG_FACET_PRIVATE && strcmp(FACET_NAMES[kind], facet)) {
+      kind++;
+    }
+    a = arena_reserve(a, sizeof(omg_facet) * (row + 1));
+    ((omg_facet *)a->data)[row++] = (omg_facet){
+        .kind = kind,
+        .value = empty_string(value) ? NULL : arena_strdup(a, value),
+        .count = sqlite3_column_int(stmt, 2),
+    };
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_facet_list){.facet_array = (omg_facet *)a->data,
+                          .length = row};
+  return NO_ERROR;
+}
+
+void omg_free_facet_list(omg_facet_list *lst) {
+  if (lst) {
+#ifdef VERBOSE
+    printf("free omg_facet_list, length is %zu\n", lst->length);
+#endif
+    arena_free_array(lst->facet_array);
+  }
+}
+
+/****************/
+/* Star history */
+/****************/
+
+// Rows older than `age` days keep only the latest one of every `width` days.
+static const struct {
+  int age;
+  int width;
+} STATS_RETENTION[] = {
+    {90, 7},
+    {365, 30},
+};
+
+// Thin out old rows of omg_repo_stats, run after each sync.
+static omg_error compact_repo_stats(omg_context ctx) {
+  const char *sql =
+      "DELETE FROM omg_repo_stats AS s "
+      "WHERE s.day < ?1 AND EXISTS ( "
+      "   SELECT 1 FROM omg_repo_stats AS newer "
+      "   WHERE newer.repo_id = s.repo_id AND newer.day > s.day "
+      "   AND newer.day < ?1 AND newer.day / ?2 = s.day / ?2)";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  int64_t today = time(NULL) / 86400;
+  size_t total = sizeof(STATS_RETENTION) / sizeof(STATS_RETENTION[0]);
+  for (size_t i = 0; i < total; i++) {
+    sqlite3_bind_int64(stmt, 1, today - STATS_RETENTION[i].age);
+    sqlite3_bind_int(stmt, 2, STATS_RETENTION[i].width);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+  }
+
+  return NO_ERROR;
+}
+
+void omg_free_repo_growth(omg_repo_growth *growth) {
+  if (growth) {
+    FREE_OBJ_FIELD(growth, full_name);
+  }
+}
+
+void omg_free_repo_growth_list(omg_repo_growth_list *lst) {
+  if (lst) {
+#ifdef VERBOSE
+    printf("free omg_repo_growth_list, len:%zu\n", lst->length);
+#endif
+    arena_free_array(lst->growth_array);
+  }
+}
+
+// Compare current counts with the latest history row at least `days` old,
+// or the oldest one when the repository is tracked for less than `days`.
+#define REPO_GROWTH_SQL                                                        \
+  "SELECT r.id, r.full_name, r.stargazers_count, "                             \
+  "   r.stargazers_count - s.stargazers_count AS star_delta, "                 \
+  "   r.forks_count - s.forks_count AS fork_delta "                            \
+  "FROM omg_repo AS r JOIN omg_repo_stats AS s "                               \
+  "   ON s.repo_id = r.id AND s.day = coalesce( "                              \
+  "     (SELECT max(day) FROM omg_repo_stats "                                 \
+  "       WHERE repo_id = r.id AND day <= ?1), "                               \
+  "     (SELECT min(day) FROM omg_repo_stats WHERE repo_id = r.id)) "
+
+static omg_repo_growth repo_growth_from_db(arena a, sqlite3_stmt *stmt) {
+  return (omg_repo_growth){
+      .repo_id = sqlite3_column_int(stmt, 0),
+      .full_name = arena_column_text(a, stmt, 1),
+      .stargazers_count = sqlite3_column_int(stmt, 2),
+      .star_delta = sqlite3_column_int(stmt, 3),
+      .fork_delta = sqlite3_column_int(stmt, 4),
+  };
+}
+
+omg_error omg_query_repo_growth(omg_context ctx, int repo_id, int days,
+                                omg_repo_growth *out) {
+  const char *sql = REPO_GROWTH_SQL "WHERE r.id = ?2";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_int64(stmt, 1, time(NULL) / 86400 - days);
+  sqlite3_bind_int(stmt, 2, repo_id);
+
+  int rc = sqlite3_step(stmt);
+  if (rc == SQLITE_DONE) {
+    return (omg_error){.code = OMG_CODE_INTERNAL,
+                       .message = "no history of repository"};
+  }
+  if (rc != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = repo_growth_from_db(NULL, stmt);
+  return NO_ERROR;
+}
+
+omg_error omg_query_top_risers(omg_context ctx, int days, int limit,
+                               omg_repo_growth_list *out) {
+  const char *sql = REPO_GROWTH_SQL "WHERE star_delta > 0 "
+                                    "ORDER BY star_delta DESC LIMIT ?2";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_int64(stmt, 1, time(NULL) / 86400 - days);
+  sqlite3_bind_int(stmt, 2, limit);
+
+  arena a = arena_new(sizeof(omg_repo_growth) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_repo_growth) * (row + 1));
+    ((omg_repo_growth *)a->data)[row++] = repo_growth_from_db(a, stmt);
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_repo_growth_list){
+      .growth_array = (omg_repo_growth *)a->data, .length = row};
+  return NO_ERROR;
+}
+
+void omg_free_user(omg_user *user) {
+  if (user) {
+#ifdef VERBOSE
+    printf("free omg_user\n");
+#endif
+    FREE_OBJ_FIELD(user, login);
+    FREE_OBJ_FIELD(user, name);
+    FREE_OBJ_FIELD(user, company);
+    FREE_OBJ_FIELD(user, blog);
+    FREE_OBJ_FIELD(user, location);
+    FREE_OBJ_FIELD(user, email);
+    FREE_OBJ_FIELD(user, bio);
+    FREE_OBJ_FIELD(user, twitter_username);
+    FREE_OBJ_FIELD(user, created_at);
+  }
+}
+
+static int integer_or_default(json_t *obj, const char *key) {
+  json_t *tmp = json_object_get(obj, key);
+  if (tmp) {
+    return json_integer_value(tmp);
+  }
+  return -1;
+}
+
+omg_error omg_whoami(omg_context ctx, const char *username, omg_user *out) {
+  char url[128];
+  if (empty_string(username)) {
+    sprintf(url, "%s/user", API_ROOT);
+  } else {
+    sprintf(url, "%s/users/%s", API_ROOT, username);
+  }
+
+  json_auto_t *resp = NULL;
+  omg_error err = omg_request(ctx, GET_METHOD, url, NULL, &resp);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  json_t *msg = json_object_get(resp, "message");
+  if (msg) {
+    fprintf(stderr, "get whoami(%s) failed. %s", username, json_dumps(resp, 0));
+    if (0 == strcmp(json_string_value(msg), "Not Found")) {
+      return (omg_error){.code = OMG_CODE_GITHUB, .message = "User Not Found"};
+    }
+
+    return (omg_error){.code = OMG_CODE_GITHUB,
+                       .message = "GitHub PAT authentication failed"};
+  }
+
+  int private_repos = integer_or_default(resp, "total_private_repos");
+  int private_gists = integer_or_default(resp, "private_gists");
+  int disk_usage = integer_or_default(resp, "disk_usage");
+  *out = (omg_user){
+      .login = dup_json_string(resp, "login"),
+      .id = json_integer_value(json_object_get(resp, "id")),
+      .name = dup_json_string(resp, "name"),
+      .company = dup_json_string(resp, "company"),
+      .blog = dup_json_string(resp, "blog"),
+      .location = dup_json_string(resp, "location"),
+      .email = dup_json_string(resp, "email"),
+      .hireable = json_boolean_value(json_object_get(resp, "hireable")),
+      .bio = dup_json_string(resp, "bio"),
+      .twitter_username = dup_json_string(resp, "twitter_username"),
+      .public_repos = json_integer_value(json_object_get(resp, "public_repos")),
+      .public_gists = json_integer_value(json_object_get(resp, "public_gists")),
+      .private_repos = private_repos,
+      .private_gists = private_gists,
+      .followers = json_integer_value(json_object_get(resp, "followers")),
+      .following = json_integer_value(json_object_get(resp, "following")),
+      .created_at = dup_json_string(resp, "created_at"),
+      .disk_usage = disk_usage,
+  };
+
+  return NO_ERROR;
+}
+
+void omg_free_commit(omg_commit *commit) {
+  if (commit) {
+    FREE_OBJ_FIELD(commit, sha);
+    FREE_OBJ_FIELD(commit, message);
+    FREE_OBJ_FIELD(commit, author);
+    FREE_OBJ_FIELD(commit, email);
+    FREE_OBJ_FIELD(commit, date);
+  }
+}
+
+void omg_free_commit_list(omg_commit_list *commit_lst) {
+  if (commit_lst) {
+#ifdef VERBOSE
+    printf("free omg_commit_list, length is %zu\n", commit_lst->length);
+#endif
+    arena_free_array(commit_lst->commit_array);
+  }
+}
+
+#define COMMIT_PER_PAGE 100
+// connections opened to GitHub at the same time by fetch_api_pages, the rest
+// are queued by curl
+#define API_CONCURRENCY 8
+
+// One GET of fetch_api_pages.
+typedef struct {
+  char url[512];
+  // sent as If-None-Match when not empty, replaced by ETag of response
+  char etag[128];
+  long status;
+  // body of 200 and GitHub's error message, NULL otherwise
+  json_t *json;
+  // transport or JSON error of this page alone, status and json are not
+  // meaningful then
+  omg_error err;
+} api_page;
+
+typedef struct {
+  CURL *curl;
+  struct curl_slist *headers;
+  response body;
+  api_page *page;
+} page_transfer;
+
+// Copy value of an `ETag:` header line into etag, other lines are ignored.
+static void copy_etag_header(const char *buffer, size_t len, char *etag,
+                             size_t etag_size) {
+  if (len <= 5 || strncasecmp(buffer, "etag:", 5) != 0) {
+    return;
+  }
+  const char *value = buffer + 5;
+  size_t n = len - 5;
+  while (n > 0 && *value == ' ') {
+    value++;
+    n--;
+  }
+  while (n > 0 && isspace((unsigned char)value[n - 1])) {
+    n--;
+  }
+  if (n < etag_size) {
+    memcpy(etag, value, n);
+    etag[n] = '\0';
+  }
+}
+
+static size_t page_header_cb(char *buffer, size_t size, size_t nitems,
+                             void *userdata) {
+  api_page *page = userdata;
+  copy_etag_header(buffer, size * nitems, page->etag, sizeof(page->etag));
+  return size * nitems;
+}
+
+// GET pages concurrently, status and err of each page are left to callers,
+// so one failed page doesn't discard the others. Only failures of the whole
+// batch are returned.
+static omg_error fetch_api_pages(omg_context ctx, api_page *pages,
+                                 size_t length) {
+  CURLM *multi = curl_multi_init();
+  if (!multi) {
+    return new_error(OMG_CODE_CURL, "curl multi init");
+  }
+  curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+                    (long)API_CONCURRENCY);
+  page_transfer *transfers = calloc(length, sizeof(page_transfer));
+  omg_error err = NO_ERROR;
+  for (size_t i = 0; i < length; i++) {
+    page_transfer *t = &transfers[i];
+    t->curl = curl_easy_init();
+    if (!t->curl) {
+      err = new_error(OMG_CODE_CURL, "curl init");
+      break;
+    }
+    t->page = &pages[i];
+    t->body = (response){.memory = malloc(1), .size = 0};
+    if (t->page->etag[0]) {
+      for (struct curl_slist *h = ctx->api_headers; h; h = h->next) {
+        t->headers = curl_slist_append(t->headers, h->data);
+      }
+      char if_none_match[160];
+      snprintf(if_none_match, sizeof(if_none_match), "If-None-Match: %s",
+               t->page->etag);
+      t->headers = curl_slist_append(t->headers, if_none_match);
+    }
+    curl_easy_setopt(t->curl, CURLOPT_URL, t->page->url);
+    curl_easy_setopt(t->curl, CURLOPT_HTTPHEADER,
+                     t->headers ? t->headers : ctx->api_headers);
+    curl_easy_setopt(t->curl, CURLOPT_TIMEOUT, ctx->timeout);
+    curl_easy_setopt(t->curl, CURLOPT_WRITEFUNCTION, mem_cb);
+    curl_easy_setopt(t->curl, CURLOPT_WRITEDATA, (void *)&t->body);
+    curl_easy_setopt(t->curl, CURLOPT_HEADERFUNCTION, page_header_cb);
+    curl_easy_setopt(t->curl, CURLOPT_HEADERDATA, (void *)t->page);
+    curl_easy_setopt(t->curl, CURLOPT_PRIVATE, (void *)t);
+#ifdef VERBOSE
+    curl_easy_setopt(t->curl, CURLOPT_VERBOSE, 1L);
+#endif
+    curl_multi_add_handle(multi, t->curl);
+  }
+
+  int running = 0;
+  do {
+    CURLMcode mc = curl_multi_perform(multi, &running);
+    if (mc == CURLM_OK && running) {
+      mc = curl_multi_poll(multi, NULL, 0, 1000, NULL);
+    }
+    if (mc != CURLM_OK) {
+      err = new_error(OMG_CODE_CURL, curl_multi_strerror(mc));
+    }
+  } while (is_ok(err) && running);
+
+  CURLMsg *msg = NULL;
+  int queued = 0;
+  while ((msg = curl_multi_info_read(multi, &queued))) {
+    if (msg->msg == CURLMSG_DONE && msg->data.result != CURLE_OK) {
+      page_transfer *t = NULL;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&t);
+      t->page->err =
+          new_error(OMG_CODE_CURL, curl_easy_strerror(msg->data.result));
+    }
+  }
+  for (size_t i = 0; i < length && transfers[i].curl; i++) {
+    page_transfer *t = &transfers[i];
+    curl_easy_getinfo(t->curl, CURLINFO_RESPONSE_CODE, &t->page->status);
+    bool page_ok = is_ok(err) && is_ok(t->page->err);
+    if (page_ok && t->page->status >= 400) {
+      // error bodies are informative only, they may not be JSON
+      t->page->json = json_loads(t->body.memory, JSON_COMPACT, NULL);
+    } else if (page_ok && t->page->status == 200) {
+      json_error_t error;
+      t->page->json = json_loads(t->body.memory, JSON_COMPACT, &error);
+      if (!t->page->json) {
+        t->page->err = new_error(OMG_CODE_JSON, error.text);
+      }
+    }
+    curl_multi_remove_handle(multi, t->curl);
+    curl_easy_cleanup(t->curl);
+    curl_slist_free_all(t->headers);
+    free(t->body.memory);
+  }
+  free(transfers);
+  curl_multi_cleanup(multi);
+
+  if (!is_ok(err)) {
+    for (size_t i = 0; i < length; i++) {
+      json_decref(pages[i].json);
+      pages[i].json = NULL;
+    }
+  }
+  return err;
+}
+
+// Error of a page GitHub rejected, with the message it returned.
+static omg_error api_page_error(api_page *page) {
+  fprintf(stderr, "visit %s failed with %ld\n", page->url, page->status);
+  const char *message =
+      json_string_value(json_object_get(page->json, "message"));
+  return new_error(OMG_CODE_CURL, message ? message : "request failed");
+}
+
+// Fetch `pages` pages of commits concurrently, since is NULL for all.
+// out[i] is NULL for 409 which GitHub returns for empty repositories.
+static omg_error fetch_commit_pages(omg_context ctx, const char *full_name,
+                                    const char *since, size_t first_page,
+                                    size_t pages, size_t per_page,
+                                    json_t **out) {
+  api_page *requests = calloc(pages, sizeof(api_page));
+  for (size_t i = 0; i < pages; i++) {
+    char *url = requests[i].url;
+    size_t size = sizeof(requests[i].url);
+    int n = snprintf(url, size, "%s/repos/%s/commits?per_page=%zu&page=%zu",
+                     API_ROOT, full_name, per_page, first_page + i);
+    if (since) {
+      snprintf(url + n, size - n, "&since=%s", since);
+    }
+  }
+  omg_error err = fetch_api_pages(ctx, requests, pages);
+  for (size_t i = 0; i < pages; i++) {
+    api_page *page = &requests[i];
+    // commits are saved only when all pages are fetched
+    if (is_ok(err) && !is_ok(page->err)) {
+      err = page->err;
+    } else if (is_ok(err) && page->status >= 400 && page->status != 409) {
+      err = api_page_error(page);
+    }
+    if (page->status == 200) {
+      out[i] = page->json;
+    } else {
+      json_decref(page->json);
+    }
+  }
+  free(requests);
+
+  if (!is_ok(err)) {
+    for (size_t i = 0; i < pages; i++) {
+      json_decref(out[i]);
+      out[i] = NULL;
+    }
+  }
+  return err;
+}
+
+// `since` is inclusive, so pages overlap cached commits unless more than
+// fit in them are newer. Then cached ones are disconnected from fetched ones
+// and dropped, may_gap tells whether pages were cut by limit.
+static omg_error save_commits(omg_context ctx, const char *full_name,
+                              json_t **pages, size_t length, bool may_gap) {
+  const char *sql = "insert into omg_commit(full_name, sha, message, author, "
+                    "email, date, committed_at) "
+                    "values(?1, ?2, ?3, ?4, ?5, ?6, ?7) "
+                    "on conflict(full_name, sha) do nothing";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  size_t total = 0;
+  size_t inserted = 0;
+  const char *oldest = NULL;
+  for (size_t i = 0; i < length; i++) {
+    for (size_t j = 0; j < json_array_size(pages[i]); j++) {
+      json_t *one_commit = json_array_get(pages[i], j);
+      json_t *commit_info = json_object_get(one_commit, "commit");
+      json_t *author_info = json_object_get(commit_info, "author");
+      json_t *committer_info = json_object_get(commit_info, "committer");
+      const char *values[] = {
+          json_string_value(json_object_get(one_commit, "sha")),
+          json_string_value(json_object_get(commit_info, "message")),
+          json_string_value(json_object_get(author_info, "name")),
+          json_string_value(json_object_get(author_info, "email")),
+          json_string_value(json_object_get(author_info, "date")),
+          json_string_value(json_object_get(committer_info, "date")),
+      };
+      if (!values[0]) {
+        continue;
+      }
+      sqlite3_bind_text(stmt, 1, full_name, -1, SQLITE_STATIC);
+      for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        sqlite3_bind_text(stmt, k + 2, values[k], -1, SQLITE_STATIC);
+      }
+      if (sqlite3_step(stmt) != SQLITE_DONE) {
+        return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+      }
+      sqlite3_reset(stmt);
+      total++;
+      inserted += sqlite3_changes(ctx->db);
+      if (values[5] && (!oldest || strcmp(values[5], oldest) < 0)) {
+        oldest = values[5];
+      }
+    }
+  }
+
+  if (may_gap && inserted == total && oldest) {
+    sql = "delete from omg_commit where full_name = ?1 and committed_at < ?2";
+    auto_sqlite3_stmt gap_stmt = NULL;
+    if (sqlite3_prepare_v2(ctx->db, sql, -1, &gap_stmt, NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_bind_text(gap_stmt, 1, full_name, -1, SQLITE_STATIC);
+    sqlite3_bind_text(gap_stmt, 2, oldest, -1, SQLITE_STATIC);
+    if (sqlite3_step(gap_stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+  }
+
+  sql = "insert into omg_commit_fetch(full_name, fetched_at) "
+        "values(?1, strftime('%Y-%m-%dT%H:%M:%SZ', 'now')) "
+        "on conflict(full_name) do update set fetched_at = "
+        "excluded.fetched_at";
+  auto_sqlite3_stmt fetch_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &fetch_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_text(fetch_stmt, 1, full_name, -1, SQLITE_STATIC);
+  if (sqlite3_step(fetch_stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
+}
+
+static size_t full_pages(json_t **pages, size_t length, size_t per_page) {
+  size_t n = 0;
+  while (n < length && json_array_size(pages[n]) == per_page) {
+    n++;
+  }
+  return n;
+}
+
+// Newest committed_at of cached commits, NULL when nothing is cached.
+static char *newest_commit_time(omg_context ctx, const char *full_name) {
+  const char *sql =
+      "select max(committed_at) from omg_commit where full_name = ?1";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return NULL;
+  }
+  sqlite3_bind_text(stmt, 1, full_name, -1, SQLITE_STATIC);
+  if (sqlite3_step(stmt) != SQLITE_ROW) {
+    return NULL;
+  }
+  return strdup_when_not_null(sqlite3_column_text(stmt, 0));
+}
+
+omg_error omg_refresh_commits(omg_context ctx, const char *full_name,
+                              int limit) {
+  if (limit <= 0) {
+    limit = COMMIT_PER_PAGE;
+  }
+  size_t per_page = limit < COMMIT_PER_PAGE ? limit : COMMIT_PER_PAGE;
+  size_t pages = (limit + per_page - 1) / per_page;
+  auto_string since = newest_commit_time(ctx, full_name);
+  json_t **out = calloc(pages, sizeof(json_t *));
+  // Usually few commits are newer than cached ones, probe with first page
+  // before fetching the rest.
+  size_t fetched = since ? 1 : pages;
+  omg_error err =
+      fetch_commit_pages(ctx, full_name, since, 1, fetched, per_page, out);
+  if (is_ok(err) && fetched < pages && full_pages(out, 1, per_page) == 1) {
+    err = fetch_commit_pages(ctx, full_name, since, 2, pages - 1, per_page,
+                             out + 1);
+    fetched = pages;
+  }
+
+  if (is_ok(err)) {
+    bool may_gap = since && full_pages(out, fetched, per_page) == pages;
+    sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL);
+    err = save_commits(ctx, full_name, out, fetched, may_gap);
+    sqlite3_exec(ctx->db, is_ok(err) ? "commit" : "rollback", NULL, NULL,
+                 NULL);
+  }
+  for (size_t i = 0; i < pages; i++) {
+    json_decref(out[i]);
+  }
+  free(out);
+  return err;
+}
+
+omg_error omg_query_cached_commits(omg_context ctx, const char *full_name,
+                                   int limit, omg_commit_list *out) {
+  const char *sql = "select sha, message, author, email, date "
+                    "from omg_commit where full_name = ?1 "
+                    "order by committed_at desc, date desc limit ?2";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_text(stmt, 1, full_name, -1, SQLITE_STATIC);
+  sqlite3_bind_int(stmt, 2, limit > 0 ? limit : -1);
+
+  arena a = arena_new(sizeof(omg_commit) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_commit) * (row + 1));
+    ((omg_commit *)a->data)[row++] = (omg_commit){
+        .sha = arena_column_text(a, stmt, 0),
+        .message = arena_column_text(a, stmt, 1),
+        .author = arena_column_text(a, stmt, 2),
+        .email = arena_column_text(a, stmt, 3),
+        .date = arena_column_text(a, stmt, 4),
+    };
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_commit_list){.commit_array = (omg_commit *)a->data,
+                           .length = row};
+  return NO_ERROR;
+}
+
+omg_error omg_query_commits(omg_context ctx, const char *full_name, int limit,
+                            omg_commit_list *out) {
+  omg_error err = omg_refresh_commits(ctx, full_name, limit);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  return omg_query_cached_commits(ctx, full_name, limit, out);
+}
+
+// releases
+
+void omg_free_release_asset(omg_release_asset *release_asset) {
+  if (release_asset) {
+    FREE_OBJ_FIELD(release_asset, name);
+    FREE_OBJ_FIELD(release_asset, download_url);
+  }
+}
+
+void omg_free_release(omg_release *release) {
+  if (release) {
+    FREE_OBJ_FIELD(release, full_name);
+    FREE_OBJ_FIELD(release, name);
+    FREE_OBJ_FIELD(release, login);
+    FREE_OBJ_FIELD(release, tag_name);
+    FREE_OBJ_FIELD(release, body);
+    FREE_OBJ_FIELD(release, published_at);
+    if (release->asset_array) {
+      for (int i = 0; i < release->asset_length; i++) {
+        omg_free_release_asset(&release->asset_array[i]);
+      }
+      free(release->asset_array);
+    }
+  }
+}
+
+void omg_free_release_list(omg_release_list *release_lst) {
+  if (release_lst) {
+#ifdef VERBOSE
+    printf("free omg_release_list, length is %zu\n", release_lst->length);
+#endif
+    arena_free_array(release_lst->release_array);
+  }
+}
+
+#define RELEASE_PER_PAGE 100
+
+typedef struct {
+  sqlite3_stmt *release;
+  sqlite3_stmt *clear_assets;
+  sqlite3_stmt *asset;
+  sqlite3_stmt *stale;
+  sqlite3_stmt *fetch;
+  sqlite3_stmt *not_modified;
+  sqlite3_stmt *missing;
+} release_stmts;
+
+static void finalize_release_stmts(release_stmts *stmts) {
+  sqlite3_stmt **all = (sqlite3_stmt **)stmts;
+  for (size_t i = 0; i < sizeof(release_stmts) / sizeof(sqlite3_stmt *); i++) {
+    sqlite3_finalize(all[i]);
+  }
+}
+
+static omg_error prepare_release_stmts(omg_context ctx,
+                                       release_stmts *stmts) {
+  const char *sqls[] = {
+      "insert into omg_release(id, full_name, name, login, tag_name, body, "
+      "draft, prerelease, published_at) "
+      "values(?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9) "
+      "on conflict(id) do update set full_name = ?2, name = ?3, login = ?4, "
+      "tag_name = ?5, body = ?6, draft = ?7, prerelease = ?8, "
+      "published_at = ?9",
+      "delete from omg_release_asset where release_id = ?1",
+      "insert or replace into omg_release_asset(id, release_id, name, size, "
+      "download_count, download_url) values(?1, ?2, ?3, ?4, ?5, ?6)",
+      // releases between fetched ones are deleted upstream, older ones are
+      // only cut by per_page when ?3 is not null
+      "delete from omg_release where full_name = ?1 "
+      "and id not in (select value from json_each(?2)) "
+      "and (?3 is null or published_at is null or published_at >= ?3)",
+      "insert into omg_release_fetch(full_name, etag, fetched_at) "
+      "values(?1, ?2, strftime('%Y-%m-%dT%H:%M:%SZ', 'now')) "
+      "on conflict(full_name) do update set etag = ?2, "
+      "fetched_at = excluded.fetched_at",
+      "update omg_release_fetch set "
+      "fetched_at = strftime('%Y-%m-%dT%H:%M:%SZ', 'now') "
+      "where full_name = ?1",
+      "delete from omg_release where full_name = ?1",
+  };
+  sqlite3_stmt **all = (sqlite3_stmt **)stmts;
+  for (size_t i = 0; i < sizeof(sqls) / sizeof(sqls[0]); i++) {
+    if (sqlite3_prepare_v2(ctx->db, sqls[i], -1, &all[i], NULL)) {
+      omg_error err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+      finalize_release_stmts(stmts);
+      return err;
+    }
+  }
+  return NO_ERROR;
+}
+
+static omg_error step_release_stmt(omg_context ctx, sqlite3_stmt *stmt) {
+  int rc = sqlite3_step(stmt);
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
+}
+
+static omg_error save_release_assets(omg_context ctx, release_stmts *stmts,
+                                     json_int_t release_id, json_t *assets) {
+  sqlite3_bind_int64(stmts->clear_assets, 1, release_id);
+  omg_error err = step_release_stmt(ctx, stmts->clear_assets);
+  for (size_t i = 0; is_ok(err) && i < json_array_size(assets); i++) {
+    json_t *one_asset = json_array_get(assets, i);
+    sqlite3_stmt *stmt = stmts->asset;
+    sqlite3_bind_int64(stmt, 1,
+                       json_integer_value(json_object_get(one_asset, "id")));
+    sqlite3_bind_int64(stmt, 2, release_id);
+    sqlite3_bind_text(stmt, 3,
+                      json_string_value(json_object_get(one_asset, "name")),
+                      -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 4,
+                       json_integer_value(json_object_get(one_asset, "size")));
+    sqlite3_bind_int64(
+        stmt, 5,
+        json_integer_value(json_object_get(one_asset, "download_count")));
+    sqlite3_bind_text(
+        stmt, 6,
+        json_string_value(json_object_get(one_asset, "browser_download_url")),
+        -1, SQLITE_STATIC);
+    err = step_release_stmt(ctx, stmt);
+  }
+  return err;
+}
+
+// Replace cached releases of full_name with a fetched page.
+static omg_error save_releases(omg_context ctx, release_stmts *stmts,
+                               const char *full_name, api_page *page,
+                               size_t per_page) {
+  json_auto_t *ids = json_array();
+  const char *oldest = NULL;
+  omg_error err = NO_ERROR;
+  for (size_t i = 0; is_ok(err) && i < json_array_size(page->json); i++) {
+    json_t *one_release = json_array_get(page->json, i);
+    json_t *author_info = json_object_get(one_release, "author");
+    json_int_t id = json_integer_value(json_object_get(one_release, "id"));
+    const char *published_at =
+        json_string_value(json_object_get(one_release, "published_at"));
+    if (published_at && (!oldest || strcmp(published_at, oldest) < 0)) {
+      oldest = published_at;
+    }
+    json_array_append_new(ids, json_integer(id));
+
+    sqlite3_stmt *stmt = stmts->release;
+    const char *texts[] = {
+        full_name,
+        json_string_value(json_object_get(one_release, "name")),
+        json_string_value(json_object_get(author_info, "login")),
+        json_string_value(json_object_get(one_release, "tag_name")),
+        json_string_value(json_object_get(one_release, "body")),
+    };
+    sqlite3_bind_int64(stmt, 1, id);
+    for (size_t k = 0; k < sizeof(texts) / sizeof(texts[0]); k++) {
+      sqlite3_bind_text(stmt, k + 2, texts[k], -1, SQLITE_STATIC);
+    }
+    sqlite3_bind_int(stmt, 7,
+                     json_is_true(json_object_get(one_release, "draft")));
+    sqlite3_bind_int(stmt, 8,
+                     json_is_true(json_object_get(one_release, "prerelease")));
+    sqlite3_bind_text(stmt, 9, published_at, -1, SQLITE_STATIC);
+    err = step_release_stmt(ctx, stmt);
+    if (is_ok(err)) {
+      err = save_release_assets(ctx, stmts, id,
+                                json_object_get(one_release, "assets"));
+    }
+  }
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  auto_string id_json = json_dumps(ids, JSON_COMPACT);
+  sqlite3_bind_text(stmts->stale, 1, full_name, -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmts->stale, 2, id_json, -1, SQLITE_STATIC);
+  if (json_array_size(page->json) == per_page) {
+    sqlite3_bind_text(stmts->stale, 3, oldest, -1, SQLITE_STATIC);
+  }
+  err = step_release_stmt(ctx, stmts->stale);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  sqlite3_bind_text(stmts->fetch, 1, full_name, -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmts->fetch, 2, page->etag[0] ? page->etag : NULL, -1,
+                    SQLITE_STATIC);
+  return step_release_stmt(ctx, stmts->fetch);
+}
+
+static omg_error save_release_page(omg_context ctx, release_stmts *stmts,
+                                   const char *full_name, api_page *page,
+                                   size_t per_page) {
+  // nothing was fetched, cached releases are kept
+  if (!is_ok(page->err)) {
+    return page->err;
+  }
+  switch (page->status) {
+  case 200:
+    return save_releases(ctx, stmts, full_name, page, per_page);
+  case 304:
+    sqlite3_bind_text(stmts->not_modified, 1, full_name, -1, SQLITE_STATIC);
+    return step_release_stmt(ctx, stmts->not_modified);
+  case 404:
+    // repository is gone, so are its releases
+    sqlite3_bind_text(stmts->missing, 1, full_name, -1, SQLITE_STATIC);
+    return step_release_stmt(ctx, stmts->missing);
+  default:
+    return api_page_error(page);
+  }
+}
+
+// ETag of last fetch, it's derived from response body, so a changed per_page
+// simply misses.
+static omg_error load_release_etags(omg_context ctx,
+                                    const char *const *full_names,
+                                    size_t length, api_page *pages) {
+  const char *sql = "select etag from omg_release_fetch where full_name = ?1";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  for (size_t i = 0; i < length; i++) {
+    sqlite3_bind_text(stmt, 1, full_names[i], -1, SQLITE_STATIC);
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+      const char *etag = (const char *)sqlite3_column_text(stmt, 0);
+      if (etag && strlen(etag) < sizeof(pages[i].etag)) {
+        strcpy(pages[i].etag, etag);
+      }
+    }
+    sqlite3_reset(stmt);
+  }
+  return NO_ERROR;
+}
+
+omg_error omg_refresh_releases(omg_context ctx, const char *const *full_names,
+                               size_t length, int limit) {
+  size_t per_page =
+      limit > 0 && limit < RELEASE_PER_PAGE ? limit : RELEASE_PER_PAGE;
+  api_page *pages = calloc(length, sizeof(api_page));
+  for (size_t i = 0; i < length; i++) {
+    snprintf(pages[i].url, sizeof(pages[i].url),
+             "%s/repos/%s/releases?per_page=%zu", API_ROOT, full_names[i],
+             per_page);
+  }
+  omg_error err = load_release_etags(ctx, full_names, length, pages);
+  if (is_ok(err)) {
+    err = fetch_api_pages(ctx, pages, length);
+  }
+
+  release_stmts stmts = {};
+  if (is_ok(err)) {
+    err = prepare_release_stmts(ctx, &stmts);
+  }
+  if (is_ok(err)) {
+    // keep going after a failed repository, so one rate limited or broken
+    // response doesn't waste the rest, first error is returned
+    sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL);
+    for (size_t i = 0; i < length; i++) {
+      omg_error page_err =
+          save_release_page(ctx, &stmts, full_names[i], &pages[i], per_page);
+      if (is_ok(err)) {
+        err = page_err;
+      }
+    }
+    sqlite3_exec(ctx->db, "commit", NULL, NULL, NULL);
+    finalize_release_stmts(&stmts);
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    json_decref(pages[i].json);
+  }
+  free(pages);
+  return err;
+}
+
+omg_error omg_refresh_starred_releases(omg_context ctx, int limit) {
+  const char *sql = "select r.full_name from omg_starred_repo s "
+                    "join omg_repo r on r.id = s.repo_id";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  arena a = arena_new(sizeof(char *) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(char *) * (row + 1));
+    ((char **)a->data)[row++] = arena_column_text(a, stmt, 0);
+  }
+  omg_error err = NO_ERROR;
+  if (rc != SQLITE_DONE) {
+    err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  } else if (row > 0) {
+    err = omg_refresh_releases(ctx, (const char *const *)a->data, row, limit);
+  }
+  arena_free_array(a->data);
+  return err;
+}
+
+// Build release list from rows of `select id, full_name, name, login,
+// tag_name, body, draft, prerelease, published_at`, assets of all releases
+// share the arena.
+static omg_error release_list_from_db(omg_context ctx, sqlite3_stmt *stmt,
+                                      omg_release_list *out) {
+  const char *sql = "select id, name, size, download_count, download_url "
+                    "from omg_release_asset where release_id = ?1 order by id";
+  auto_sqlite3_stmt asset_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &asset_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  arena a = arena_new(sizeof(omg_release) * 16);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_release) * (row + 1));
+    omg_release release = {
+        .id = sqlite3_column_int(stmt, 0),
+        .full_name = arena_column_text(a, stmt, 1),
+        .name = arena_column_text(a, stmt, 2),
+        .login = arena_column_text(a, stmt, 3),
+        .tag_name = arena_column_text(a, stmt, 4),
+        .body = arena_column_text(a, stmt, 5),
+        .draft = sqlite3_column_int(stmt, 6),
+        .prerelease = sqlite3_column_int(stmt, 7),
+        .published_at = arena_column_text(a, stmt, 8),
+    };
+
+    sqlite3_bind_int64(asset_stmt, 1, sqlite3_column_int64(stmt, 0));
+    int asset_cap = 0;
+    while ((rc = sqlite3_step(asset_stmt)) == SQLITE_ROW) {
+      if (release.asset_length == asset_cap) {
+        // arrays are rarely long, regrow them in the arena
+        asset_cap = asset_cap ? asset_cap * 2 : 4;
+        omg_release_asset *assets =
+            arena_alloc_array(a, sizeof(omg_release_asset) * asset_cap);
+        if (release.asset_length) {
+          memcpy(assets, release.asset_array,
+                 sizeof(omg_release_asset) * release.asset_length);
+        }
+        release.asset_array = assets;
+      }
+      release.asset_array[release.asset_length++] = (omg_release_asset){
+          .id = sqlite3_column_int(asset_stmt, 0),
+          .name = arena_column_text(a, asset_stmt, 1),
+          .size = sqlite3_column_int(asset_stmt, 2),
+          .download_count = sqlite3_column_int(asset_stmt, 3),
+          .download_url = arena_column_text(a, asset_stmt, 4),
+      };
+    }
+    sqlite3_reset(asset_stmt);
+    if (rc != SQLITE_DONE) {
+      break;
+    }
+    ((omg_release *)a->data)[row++] = release;
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_release_list){.release_array = (omg_release *)a->data,
+                            .length = row};
+  return NO_ERROR;
+}
+
+#define RELEASE_COLUMNS                                                        \
+  "select id, full_name, name, login, tag_name, body, draft, prerelease, "     \
+  "published_at from omg_release "
+
+omg_error omg_query_cached_releases(omg_context ctx, const char *full_name,
+                                    int limit, omg_release_list *out) {
+  // drafts first, like GitHub
+  const char *sql = RELEASE_COLUMNS
+      "where full_name = ?1 "
+      "order by published_at is not null, published_at desc, id desc "
+      "limit ?2";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_text(stmt, 1, full_name, -1, SQLITE_STATIC);
+  sqlite3_bind_int(stmt, 2, limit > 0 ? limit : -1);
+  return release_list_from_db(ctx, stmt, out);
+}
+
+omg_error omg_query_releases_since(omg_context ctx, const char *since,
+                                   int limit, omg_release_list *out) {
+  const char *sql = RELEASE_COLUMNS "where published_at > ?1 "
+                                    "order by published_at desc limit ?2";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_text(stmt, 1, since ? since : "", -1, SQLITE_STATIC);
+  sqlite3_bind_int(stmt, 2, limit > 0 ? limit : -1);
+  return release_list_from_db(ctx, stmt, out);
+}
+
+omg_error omg_query_releases(omg_context ctx, const char *full_name, int limit,
+                             omg_release_list *out) {
+  omg_error err = omg_refresh_releases(ctx, &full_name, 1, limit);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  return omg_query_cached_releases(ctx, full_name, limit, out);
+}
+
+// trending
+
+static const size_t TRENDING_LIST_LENGTH = 25;
+static const size_t TRENDING_TUPLE_LENGTH = 4;
+
+// parse number like 1,234 into 1234
+static size_t omg_parse_number(char *num_with_comma) {
+  int number = 0;
+  int i = 0;
+  char c;
+  while ((c = num_with_comma[i]) != '\0') {
+    if (c == ',') {
+      i++;
+      continue;
+    }
+    number = number * 10 + (c - '0');
+    i++;
+  }
+  return number;
+}
+
+// Fallback for markup the scanner doesn't understand, it only knows
+// description, full_name and recent stars. Match the next repository after
+// *head and move *head past it, false when there is none.
+static bool regex_trending_repo(omg_context ctx, arena a, const char **head,
+                                omg_repo *repo) {
+  regmatch_t pmatch[TRENDING_TUPLE_LENGTH];
+  if (pcre2_regexec(&ctx->trending_re, *head, TRENDING_TUPLE_LENGTH, pmatch,
+                    0)) {
+    return false;
+  }
+  char *matched[TRENDING_TUPLE_LENGTH];
+  for (size_t j = 1; j < TRENDING_TUPLE_LENGTH; j++) {
+    regoff_t len = pmatch[j].rm_eo - pmatch[j].rm_so;
+    matched[j] = pmatch[j].rm_so < 0
+                     ? NULL
+                     : arena_strndup(a, *head + pmatch[j].rm_so, len);
+  }
+
+  *repo = (omg_repo){
+      .description = matched[1],
+      .full_name = matched[2],
+      .recent_stars = omg_parse_number(matched[3]),
+  };
+  *head += pmatch[3].rm_eo;
+  return true;
+}
+
+static omg_error parse_trending_regex(omg_context ctx, const char *html,
+                                      omg_repo_list *out) {
+  arena a = arena_new(sizeof(omg_repo) * TRENDING_LIST_LENGTH);
+  omg_repo *repo_array = (omg_repo *)a->data;
+
+  const char *head = html;
+  size_t arr_len = 0;
+  while (arr_len < TRENDING_LIST_LENGTH &&
+         regex_trending_repo(ctx, a, &head, &repo_array[arr_len])) {
+    arr_len++;
+  }
+
+  *out = (omg_repo_list){.repo_array = repo_array, .length = arr_len};
+  return NO_ERROR;
+}
+
+// Trending page is scanned forward once, every article looks like
+//
+// <article class="Box-row">
+//   <h2 ...><a ... href="/owner/name" ...>...</a></h2>
+//   <p class="...">description</p>                      (optional)
+//   <span itemprop="programmingLanguage">Go</span>      (optional)
+//   <a href="/owner/name/stargazers" ...><svg>...</svg> 1,234 </a>
+//   <a href="/owner/name/forks" ...><svg>...</svg> 123 </a>
+//   <span ...><svg>...</svg> 56 stars today</span>     (or this week/month)
+// </article>
+//
+// Searches never go past the end of current article.
+static const char *scan_find(const char *p, const char *end,
+                             const char *needle) {
+  if (!p || p >= end) {
+    return NULL;
+  }
+  return memmem(p, end - p, needle, strlen(needle));
+}
+
+// Position right after needle, NULL when not found.
+static const char *scan_after(const char *p, const char *end,
+                              const char *needle) {
+  const char *found = scan_find(p, end, needle);
+  return found ? found + strlen(needle) : NULL;
+}
+
+// Parse number like 1,234 which ends right before p, whitespace between is
+// skipped.
+static int scan_number_before(const char *start, const char *p) {
+  while (p > start && isspace((unsigned char)p[-1])) {
+    p--;
+  }
+  const char *digits = p;
+  while (digits > start &&
+         (isdigit((unsigned char)digits[-1]) || digits[-1] == ',')) {
+    digits--;
+  }
+  int number = 0;
+  for (; digits < p; digits++) {
+    if (*digits != ',') {
+      number = number * 10 + (*digits - '0');
+    }
+  }
+  return number;
+}
+
+// Copy text between p and end with tags(like <g-emoji>) dropped, common
+// entities decoded and surrounding whitespace trimmed.
+static char *scan_text(arena a, const char *p, const char *end) {
+  static const struct {
+    const char *entity;
+    char c;
+  } ENTITIES[] = {{"&amp;", '&'},  {"&lt;", '<'},   {"&gt;", '>'},
+                  {"&quot;", '"'}, {"&#39;", '\''}, {"&#x27;", '\''}};
+
+  char *text = arena_alloc(a, end - p + 1);
+  size_t len = 0;
+  while (p < end) {
+    if (*p == '<') {
+      const char *close = memchr(p, '>', end - p);
+      p = close ? close + 1 : end;
+      continue;
+    }
+    bool decoded = false;
+    for (size_t i = 0; *p == '&' && i < sizeof(ENTITIES) / sizeof(ENTITIES[0]);
+         i++) {
+      size_t n = strlen(ENTITIES[i].entity);
+      if ((size_t)(end - p) >= n && memcmp(p, ENTITIES[i].entity, n) == 0) {
+        text[len++] = ENTITIES[i].c;
+        p += n;
+        decoded = true;
+        break;
+      }
+    }
+    if (!decoded) {
+      text[len++] = *p++;
+    }
+  }
+  size_t from = 0;
+  while (from < len && isspace((unsigned char)text[from])) {
+    from++;
+  }
+  while (len > from && isspace((unsigned char)text[len - 1])) {
+    len--;
+  }
+  memmove(text, text + from, len - from);
+  text[len - from] = '\0';
+  return text;
+}
+
+// Scan one article, false when it doesn't look like a repository.
+static bool scan_trending_article(omg_context ctx, arena a, const char *p,
+                                  const char *end, omg_repo *repo) {
+  const char *name = scan_after(scan_find(p, end, "<h2"), end, "href=\"/");
+  const char *name_end = name ? memchr(name, '"', end - name) : NULL;
+  if (!name_end || name_end == name) {
+    return false;
+  }
+  *repo = (omg_repo){.full_name = arena_strndup(a, name, name_end - name)};
+
+  char href[512];
+  snprintf(href, sizeof(href), "href=\"/%s/stargazers\"", repo->full_name);
+  const char *stars = scan_find(name_end, end, href);
+  if (!stars) {
+    return false;
+  }
+
+  // skip tags like <path> of svg icons in the heading
+  const char *desc = scan_find(name_end, stars, "</h2>");
+  while ((desc = scan_find(desc, stars, "<p")) && desc[2] != '>' &&
+         !isspace((unsigned char)desc[2])) {
+    desc += 2;
+  }
+  desc = scan_after(desc, stars, ">");
+  const char *desc_end = scan_find(desc, stars, "</p>");
+  if (desc_end) {
+    repo->description = scan_text(a, desc, desc_end);
+  }
+
+  const char *lang =
+      scan_after(name_end, stars, "itemprop=\"programmingLanguage\">");
+  const char *lang_end = lang ? memchr(lang, '<', stars - lang) : NULL;
+  if (lang_end) {
+    repo->lang = omg_intern(ctx, arena_strndup(a, lang, lang_end - lang));
+  }
+
+  const char *stars_end = scan_find(stars, end, "</a>");
+  if (stars_end) {
+    repo->stargazers_count = scan_number_before(stars, stars_end);
+  }
+
+  snprintf(href, sizeof(href), "href=\"/%s/forks\"", repo->full_name);
+  const char *forks = scan_find(stars, end, href);
+  const char *forks_end = scan_find(forks, end, "</a>");
+  if (forks_end) {
+    repo->forks_count = scan_number_before(forks, forks_end);
+  }
+
+  const char *recent = forks_end ? forks_end : stars_end;
+  const char *recent_end = scan_find(recent, end, " stars ");
+  if (recent_end) {
+    repo->recent_stars = scan_number_before(recent, recent_end);
+  }
+  return true;
+}
+
+// Article the scanner doesn't understand goes through the regex alone, so
+// other articles keep everything scanned from them.
+static bool regex_trending_article(omg_context ctx, arena a, const char *p,
+                                   const char *end, omg_repo *repo) {
+  omg_auto_char text = strndup(p, end - p);
+  const char *head = text;
+  return regex_trending_repo(ctx, a, &head, repo);
+}
+
+// Number of repositories scanned, 0 when there is no article.
+static size_t scan_trending(omg_context ctx, arena a, const char *html,
+                            size_t len, omg_repo *repo_array) {
+  const char *end = html + len;
+  const char *p = html;
+  size_t n = 0;
+  while (n < TRENDING_LIST_LENGTH) {
+    const char *article = scan_find(p, end, "<article");
+    if (!article) {
+      break;
+    }
+    const char *article_end = scan_find(article, end, "</article>");
+    if (!article_end) {
+      article_end = end;
+    }
+    if (scan_trending_article(ctx, a, article, article_end, &repo_array[n]) ||
+        regex_trending_article(ctx, a, article, article_end, &repo_array[n])) {
+      n++;
+    }
+    p = article_end;
+  }
+  return n;
+}
+
+omg_error omg__parse_trending(omg_context ctx, const char *html, size_t len,
+                              bool regex, omg_repo_list *out) {
+  if (!regex) {
+    arena a = arena_new(sizeof(omg_repo) * TRENDING_LIST_LENGTH);
+    size_t n = scan_trending(ctx, a, html, len, (omg_repo *)a->data);
+    if (n > 0) {
+      *out = (omg_repo_list){.repo_array = (omg_repo *)a->data, .length = n};
+      return NO_ERROR;
+    }
+    arena_free_array(a->data);
+#ifdef VERBOSE
+    printf("no trending article, fallback to regex\n");
+#endif
+  }
+
+  return parse_trending_regex(ctx, html, out);
+}
+
+typedef struct {
+  response body;
+  // bytes already searched for the end of articles
+  size_t scanned;
+  size_t articles;
+} trending_response;
+
+static void free_trending_response(trending_response *resp) {
+  free_response(&resp->body);
+}
+
+// Stop the transfer once all articles arrived, rest of the page is footer.
+static size_t trending_cb(void *contents, size_t size, size_t nmemb,
+                          void *userp) {
+  trending_response *resp = userp;
+  size_t realsize = mem_cb(contents, size, nmemb, &resp->body);
+  if (realsize == 0) {
+    return 0;
+  }
+
+  const char *end = resp->body.memory + resp->body.size;
+  const char *p = resp->body.memory + resp->scanned;
+  const char *found = NULL;
+  while ((found = scan_find(p, end, "</article>"))) {
+    resp->articles++;
+    p = found + strlen("</article>");
+  }
+  // a tag may be split between chunks
+  size_t keep = strlen("</article>") - 1;
+  size_t scanned = p - resp->body.memory;
+  if (resp->body.size - scanned > keep) {
+    scanned = resp->body.size - keep;
+  }
+  resp->scanned = scanned;
+  return resp->articles >= TRENDING_LIST_LENGTH ? 0 : realsize;
+}
+
+// wait this long after a 429 without Retry-After
+#define TRENDING_RETRY_AFTER 60
+
+static void trending_url(char *url, size_t size, const char *spoken_lang,
+                         const char *lang, const char *range) {
+  snprintf(url, size,
+           "https://github.com/trending/%s?since=%s&spoken_language_code=%s",
+           empty_string(lang) ? "" : lang,   // lang
+           empty_string(range) ? "" : range, // range
+           empty_string(spoken_lang) ? "" : spoken_lang);
+}
+
+// Check a finished trending transfer and parse the page, retry_after is set
+// to seconds GitHub asks to wait when it answers 429.
+static omg_error trending_result(omg_context ctx, CURL *curl, CURLcode res,
+                                 trending_response *resp, omg_repo_list *out,
+                                 int64_t *retry_after) {
+  bool all_articles = res == CURLE_WRITE_ERROR &&
+                      resp->articles >= TRENDING_LIST_LENGTH;
+  if (res != CURLE_OK && !all_articles) {
+    return new_error(OMG_CODE_CURL, curl_easy_strerror(res));
+  }
+
+  long response_code;
+  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+  if (response_code != 200) {
+    fprintf(stderr, "visit trending failed. code:%ld\n", response_code);
+    if (response_code == 429) {
+      curl_off_t wait = 0;
+      curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &wait);
+      *retry_after = wait > 0 ? wait : TRENDING_RETRY_AFTER;
+      return (omg_error){.code = OMG_CODE_CURL,
+                         .message = "429 Too Many Requests, try again later!"};
+    }
+    return (omg_error){.code = OMG_CODE_CURL,
+                       .message = "Get trending URL not 200 OK"};
+  }
+
+  return omg__parse_trending(ctx, resp->body.memory, resp->body.size, false,
+                             out);
+}
+
+// Fetch and parse a trending page.
+static omg_error fetch_trending(omg_context ctx, const char *spoken_lang,
+                                const char *lang, const char *range,
+                                omg_repo_list *out, int64_t *retry_after) {
+  char url[256];
+  trending_url(url, sizeof(url), spoken_lang, lang, range);
+
+  CURL *curl = ctx->trending_curl;
+  if (!curl) {
+    return (omg_error){.code = OMG_CODE_CURL, .message = "curl init"};
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  trending_response resp __attribute__((cleanup(free_trending_response))) = {
+      .body = {.memory = malloc(1), .size = 0}};
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, trending_cb);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *)&resp);
+
+  CURLcode res = curl_easy_perform(curl);
+  return trending_result(ctx, curl, res, &resp, out, retry_after);
+}
+
+static void bind_trending_key(sqlite3_stmt *stmt, const char *spoken_lang,
+                              const char *lang, const char *range) {
+  sqlite3_bind_text(stmt, 1, spoken_lang ? spoken_lang : "", -1,
+                    SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 2, lang ? lang : "", -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 3, range ? range : "", -1, SQLITE_STATIC);
+}
+
+// Trending history is kept this many days.
+#define TRENDING_HISTORY_DAYS 730
+
+// Record a fetched page as today's, and drop days of the page older than
+// TRENDING_HISTORY_DAYS.
+static omg_error save_trending_history(omg_context ctx,
+                                       const char *spoken_lang,
+                                       const char *lang, const char *range,
+                                       omg_repo_list repo_lst) {
+  int64_t today = time(NULL) / 86400;
+  const char *sql = "delete from omg_trending_history where spoken_lang = ?1 "
+                    "and lang = ?2 and `range` = ?3 and (day = ?4 or day < ?5)";
+  auto_sqlite3_stmt clear_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &clear_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(clear_stmt, spoken_lang, lang, range);
+  sqlite3_bind_int64(clear_stmt, 4, today);
+  sqlite3_bind_int64(clear_stmt, 5, today - TRENDING_HISTORY_DAYS);
+  if (sqlite3_step(clear_stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  sql = "insert or ignore into omg_trending_name(full_name) values(?1)";
+  auto_sqlite3_stmt name_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &name_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sql = "insert into omg_trending_history(spoken_lang, lang, "
+        "`range`, day, rank, name_id, recent_stars) values(?1, ?2, ?3, ?4, "
+        "?5, (select id from omg_trending_name where full_name = ?6), ?7)";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  for (size_t i = 0; i < repo_lst.length; i++) {
+    omg_repo repo = repo_lst.repo_array[i];
+    sqlite3_bind_text(name_stmt, 1, repo.full_name, -1, SQLITE_STATIC);
+    if (sqlite3_step(name_stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(name_stmt);
+
+    bind_trending_key(stmt, spoken_lang, lang, range);
+    sqlite3_bind_int64(stmt, 4, today);
+    sqlite3_bind_int(stmt, 5, i);
+    sqlite3_bind_text(stmt, 6, repo.full_name, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 7, repo.recent_stars);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+  }
+  return NO_ERROR;
+}
+
+// Drop history of pages no longer fetched and names no longer referenced, run
+// after each sync. Pages still fetched are trimmed on save.
+static omg_error compact_trending_history(omg_context ctx) {
+  const char *sql = "delete from omg_trending_history where day < ?1";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_int64(stmt, 1, time(NULL) / 86400 - TRENDING_HISTORY_DAYS);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  sql = "delete from omg_trending_name where id not in "
+        "(select name_id from omg_trending_history)";
+  if (sqlite3_exec(ctx->db, sql, NULL, NULL, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
+}
+
+static omg_error save_trending(omg_context ctx, const char *spoken_lang,
+                               const char *lang, const char *range,
+                               omg_repo_list repo_lst) {
+  const char *sql = "delete from omg_trending_repo where spoken_lang = ?1 "
+                    "and lang = ?2 and `range` = ?3";
+  auto_sqlite3_stmt clear_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &clear_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(clear_stmt, spoken_lang, lang, range);
+  if (sqlite3_step(clear_stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  sql = "insert into omg_trending_repo(spoken_lang, lang, `range`, rank, "
+        "full_name, description, stargazers_count, repo_lang, forks_count, "
+        "recent_stars) values(?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10)";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  for (size_t i = 0; i < repo_lst.length; i++) {
+    omg_repo repo = repo_lst.repo_array[i];
+    bind_trending_key(stmt, spoken_lang, lang, range);
+    sqlite3_bind_int(stmt, 4, i);
+    sqlite3_bind_text(stmt, 5, repo.full_name, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 6, repo.description, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 7, repo.stargazers_count);
+    sqlite3_bind_text(stmt, 8, repo.lang, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 9, repo.forks_count);
+    sqlite3_bind_int(stmt, 10, repo.recent_stars);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+  }
+
+  sql = "insert into omg_trending_fetch(spoken_lang, lang, `range`, "
+        "fetched_at, retry_at) values(?1, ?2, ?3, ?4, null) "
+        "on conflict(spoken_lang, lang, `range`) do update set "
+        "fetched_at = ?4, retry_at = null";
+  auto_sqlite3_stmt fetch_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &fetch_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(fetch_stmt, spoken_lang, lang, range);
+  sqlite3_bind_int64(fetch_stmt, 4, time(NULL));
+  if (sqlite3_step(fetch_stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return save_trending_history(ctx, spoken_lang, lang, range, repo_lst);
+}
+
+// Remember when GitHub will accept requests of this page again.
+static omg_error save_trending_retry_at(omg_context ctx,
+                                        const char *spoken_lang,
+                                        const char *lang, const char *range,
+                                        int64_t retry_at) {
+  const char *sql = "insert into omg_trending_fetch(spoken_lang, lang, "
+                    "`range`, retry_at) values(?1, ?2, ?3, ?4) "
+                    "on conflict(spoken_lang, lang, `range`) do update set "
+                    "retry_at = ?4";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(stmt, spoken_lang, lang, range);
+  sqlite3_bind_int64(stmt, 4, retry_at);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
+}
+
+// When GitHub accepts requests of this page again, 0 when not rate limited.
+static omg_error trending_retry_at(omg_context ctx, const char *spoken_lang,
+                                   const char *lang, const char *range,
+                                   int64_t *retry_at) {
+  const char *sql = "select retry_at from omg_trending_fetch "
+                    "where spoken_lang = ?1 and lang = ?2 and `range` = ?3";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(stmt, spoken_lang, lang, range);
+  *retry_at =
+      sqlite3_step(stmt) == SQLITE_ROW ? sqlite3_column_int64(stmt, 0) : 0;
+  return NO_ERROR;
+}
+
+omg_error omg_refresh_trending(omg_context ctx, const char *spoken_lang,
+                               const char *lang, const char *range) {
+  int64_t now = time(NULL);
+  int64_t retry_at = 0;
+  omg_error err = trending_retry_at(ctx, spoken_lang, lang, range, &retry_at);
+  if (!is_ok(err)) {
+    return err;
+  }
+  if (retry_at > now) {
+    return (omg_error){.code = OMG_CODE_CURL,
+                       .message = "429 Too Many Requests, try again later!"};
+  }
+
+  omg_auto_repo_list repo_lst = {};
+  int64_t retry_after = 0;
+  err = fetch_trending(ctx, spoken_lang, lang, range, &repo_lst, &retry_after);
+  if (!is_ok(err)) {
+    if (retry_after > 0) {
+      save_trending_retry_at(ctx, spoken_lang, lang, range,
+                             now + retry_after);
+    }
+    return err;
+  }
+
+  sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL);
+  err = save_trending(ctx, spoken_lang, lang, range, repo_lst);
+  sqlite3_exec(ctx->db, is_ok(err) ? "commit" : "rollback", NULL, NULL, NULL);
+  return err;
+}
+
+omg_error omg_query_cached_trending(omg_context ctx, const char *spoken_lang,
+                                    const char *lang, const char *range,
+                                    omg_repo_list *out, bool *fresh) {
+  const char *sql = "select fetched_at from omg_trending_fetch "
+                    "where spoken_lang = ?1 and lang = ?2 and `range` = ?3";
+  auto_sqlite3_stmt fetch_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &fetch_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(fetch_stmt, spoken_lang, lang, range);
+  if (fresh) {
+    *fresh = sqlite3_step(fetch_stmt) == SQLITE_ROW &&
+             sqlite3_column_type(fetch_stmt, 0) != SQLITE_NULL &&
+             time(NULL) - sqlite3_column_int64(fetch_stmt, 0) <
+                 ctx->trending_ttl;
+  }
+
+  sql = "select full_name, description, stargazers_count, repo_lang, "
+        "forks_count, recent_stars from omg_trending_repo "
+        "where spoken_lang = ?1 and lang = ?2 and `range` = ?3 order by rank";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(stmt, spoken_lang, lang, range);
+
+  arena a = arena_new(sizeof(omg_repo) * TRENDING_LIST_LENGTH);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_repo) * (row + 1));
+    ((omg_repo *)a->data)[row++] = (omg_repo){
+        .full_name = arena_column_text(a, stmt, 0),
+        .description = arena_column_text(a, stmt, 1),
+        .stargazers_count = sqlite3_column_int(stmt, 2),
+        .lang = omg_intern(ctx, (const char *)sqlite3_column_text(stmt, 3)),
+        .forks_count = sqlite3_column_int(stmt, 4),
+        .recent_stars = sqlite3_column_int(stmt, 5),
+    };
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_repo_list){.repo_array = (omg_repo *)a->data, .length = row};
+  return NO_ERROR;
+}
+
+omg_error omg_query_trending(omg_context ctx, const char *spoken_lang,
+                             const char *lang, const char *range,
+                             omg_repo_list *out) {
+  if (ctx->trending_ttl < 0) {
+    int64_t retry_after = 0;
+    return fetch_trending(ctx, spoken_lang, lang, range, out, &retry_after);
+  }
+
+  bool fresh = false;
+  omg_error err = omg_query_cached_trending(ctx, spoken_lang, lang, range,
+                                            out, &fresh);
+  if (!is_ok(err) || fresh) {
+    return err;
+  }
+
+  err = omg_refresh_trending(ctx, spoken_lang, lang, range);
+  if (!is_ok(err)) {
+    // stale page is better than nothing, especially when rate limited
+    return out->length > 0 ? NO_ERROR : err;
+  }
+  omg_free_repo_list(out);
+  return omg_query_cached_trending(ctx, spoken_lang, lang, range, out, NULL);
+}
+
+// trending pages downloaded at the same time by omg_query_trendings
+#define TRENDING_CONCURRENCY 4
+
+typedef struct {
+  const omg_trending_source *source;
+  // cached page, replaced when a new one is fetched
+  omg_repo_list repos;
+  bool fetch;
+  bool fetched;
+  omg_error err;
+  int64_t retry_after;
+  CURL *curl;
+  trending_response resp;
+} trending_job;
+
+// Download pages of jobs marked `fetch` concurrently, a page is parsed as
+// soon as it arrives while others are still downloading. Failure of a page
+// is kept in its job, only failure of the whole transfer is returned.
+static omg_error fetch_trending_jobs(omg_context ctx, trending_job *jobs,
+                                     size_t length) {
+  CURLM *multi = curl_multi_init();
+  if (!multi) {
+    return new_error(OMG_CODE_CURL, "curl multi init");
+  }
+  curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+                    (long)TRENDING_CONCURRENCY);
+  for (size_t i = 0; i < length; i++) {
+    trending_job *job = &jobs[i];
+    if (!job->fetch) {
+      continue;
+    }
+    // shares headers and timeout of the single page handle
+    job->curl = curl_easy_duphandle(ctx->trending_curl);
+    if (!job->curl) {
+      job->err = new_error(OMG_CODE_CURL, "curl init");
+      continue;
+    }
+    char url[256];
+    const omg_trending_source *src = job->source;
+    trending_url(url, sizeof(url), src->spoken_lang, src->lang, src->since);
+    job->resp = (trending_response){.body = {.memory = malloc(1), .size = 0}};
+    curl_easy_setopt(job->curl, CURLOPT_URL, url);
+    curl_easy_setopt(job->curl, CURLOPT_WRITEFUNCTION, trending_cb);
+    curl_easy_setopt(job->curl, CURLOPT_WRITEDATA, (void *)&job->resp);
+    curl_easy_setopt(job->curl, CURLOPT_PRIVATE, (void *)job);
+    curl_multi_add_handle(multi, job->curl);
+  }
+
+  omg_error err = NO_ERROR;
+  int running = 0;
+  do {
+    CURLMcode mc = curl_multi_perform(multi, &running);
+    CURLMsg *msg = NULL;
+    int queued = 0;
+    while ((msg = curl_multi_info_read(multi, &queued))) {
+      if (msg->msg != CURLMSG_DONE) {
+        continue;
+      }
+      trending_job *job = NULL;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&job);
+      omg_repo_list repos = {};
+      job->err = trending_result(ctx, job->curl, msg->data.result, &job->resp,
+                                 &repos, &job->retry_after);
+      if (is_ok(job->err)) {
+        omg_free_repo_list(&job->repos);
+        job->repos = repos;
+        job->fetched = true;
+      }
+    }
+    if (mc == CURLM_OK && running) {
+      mc = curl_multi_poll(multi, NULL, 0, 1000, NULL);
+    }
+    if (mc != CURLM_OK) {
+      err = new_error(OMG_CODE_CURL, curl_multi_strerror(mc));
+    }
+  } while (is_ok(err) && running);
+
+  for (size_t i = 0; i < length; i++) {
+    trending_job *job = &jobs[i];
+    if (job->curl) {
+      curl_multi_remove_handle(multi, job->curl);
+      curl_easy_cleanup(job->curl);
+      free_trending_response(&job->resp);
+      job->curl = NULL;
+    }
+  }
+  curl_multi_cleanup(multi);
+  return err;
+}
+
+// Cache fetched pages in one transaction, and remember when rate limited
+// ones can be fetched again.
+static omg_error save_trending_jobs(omg_context ctx, trending_job *jobs,
+                                    size_t length) {
+  int64_t now = time(NULL);
+  omg_error err = NO_ERROR;
+  sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL);
+  for (size_t i = 0; i < length && is_ok(err); i++) {
+    trending_job *job = &jobs[i];
+    const omg_trending_source *src = job->source;
+    if (job->fetched) {
+      err = save_trending(ctx, src->spoken_lang, src->lang, src->since,
+                          job->repos);
+    } else if (job->retry_after > 0) {
+      err = save_trending_retry_at(ctx, src->spoken_lang, src->lang,
+                                   src->since, now + job->retry_after);
+    }
+  }
+  sqlite3_exec(ctx->db, is_ok(err) ? "commit" : "rollback", NULL, NULL, NULL);
+  return err;
+}
+
+// Merge pages round-robin by rank, so first repositories of every page come
+// first. A repository on several pages is kept once, with fields of the page
+// it ranks best on. Pages are short, duplicates are found by a linear scan.
+static omg_trending_list merge_trending_jobs(trending_job *jobs,
+                                             size_t length) {
+  size_t total = 0;
+  size_t longest = 0;
+  for (size_t i = 0; i < length; i++) {
+    total += jobs[i].repos.length;
+    if (jobs[i].repos.length > longest) {
+      longest = jobs[i].repos.length;
+    }
+  }
+
+  arena a = arena_new(sizeof(omg_trending_repo) * total);
+  omg_trending_repo *merged = (omg_trending_repo *)a->data;
+  size_t n = 0;
+  for (size_t rank = 0; rank < longest; rank++) {
+    for (size_t i = 0; i < length; i++) {
+      if (rank >= jobs[i].repos.length) {
+        continue;
+      }
+      omg_repo repo = jobs[i].repos.repo_array[rank];
+      size_t j = 0;
+      while (j < n && strcasecmp(merged[j].repo.full_name, repo.full_name)) {
+        j++;
+      }
+      if (j == n) {
+        repo.full_name = arena_strdup(a, repo.full_name);
+        repo.description = arena_strdup(a, repo.description);
+        int *ranks = arena_alloc_array(a, sizeof(int) * length);
+        memset(ranks, 0, sizeof(int) * length);
+        merged[n++] = (omg_trending_repo){.repo = repo, .ranks = ranks};
+      }
+      merged[j].ranks[i] = rank + 1;
+    }
+  }
+
+  return (omg_trending_list){.repo_array = merged, .length = n};
+}
+
+omg_error omg_query_trendings(omg_context ctx,
+                              const omg_trending_source *sources,
+                              size_t length, omg_trending_list *out) {
+  trending_job *jobs = calloc(length, sizeof(trending_job));
+  int64_t now = time(NULL);
+  omg_error err = NO_ERROR;
+  for (size_t i = 0; i < length && is_ok(err); i++) {
+    const omg_trending_source *src = &sources[i];
+    jobs[i] = (trending_job){.source = src, .fetch = true};
+    if (ctx->trending_ttl < 0) {
+      continue;
+    }
+
+    bool fresh = false;
+    err = omg_query_cached_trending(ctx, src->spoken_lang, src->lang,
+                                    src->since, &jobs[i].repos, &fresh);
+    int64_t retry_at = 0;
+    if (is_ok(err) && !fresh) {
+      err = trending_retry_at(ctx, src->spoken_lang, src->lang, src->since,
+                              &retry_at);
+    }
+    jobs[i].fetch = !fresh && retry_at <= now;
+    if (retry_at > now) {
+      jobs[i].err = (omg_error){
+          .code = OMG_CODE_CURL,
+          .message = "429 Too Many Requests, try again later!"};
+    }
+  }
+
+  if (is_ok(err)) {
+    err = fetch_trending_jobs(ctx, jobs, length);
+  }
+  if (is_ok(err) && ctx->trending_ttl >= 0) {
+    err = save_trending_jobs(ctx, jobs, length);
+  }
+  if (is_ok(err)) {
+    *out = merge_trending_jobs(jobs, length);
+    // stale or missing pages are fine as long as something is shown
+    for (size_t i = 0; i < length && out->length == 0; i++) {
+      if (!is_ok(jobs[i].err)) {
+        err = jobs[i].err;
+        omg_free_trending_list(out);
+        *out = (omg_trending_list){};
+        break;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    omg_free_repo_list(&jobs[i].repos);
+  }
+  free(jobs);
+  return err;
+}
+
+void omg_free_trending_list(omg_trending_list *lst) {
+  if (lst) {
+#ifdef VERBOSE
+    printf("free omg_trending_list, length is %zu\n", lst->length);
+#endif
+    arena_free_array(lst->repo_array);
+  }
+}
+
+// Days of a page are numbered per repository, consecutive days share
+// `day - number`, so each such group is a streak.
+#define TRENDING_STREAK_SQL                                                    \
+  "WITH h AS ( "                                                               \
+  "   SELECT name_id, day, rank, recent_stars, "                               \
+  "     day - row_number() OVER (PARTITION BY name_id ORDER BY day) AS run "   \
+  "   FROM omg_trending_history "                                              \
+  "   WHERE spoken_lang = ?1 AND lang = ?2 AND `range` = ?3 AND day > ?4), "   \
+  "runs AS ( "                                                                 \
+  "   SELECT name_id, count(*) AS len, min(day) AS first_day, "                \
+  "     max(day) AS last_day, min(rank) AS best, sum(recent_stars) AS stars "  \
+  "   FROM h GROUP BY name_id, run) "                                          \
+  "SELECT n.full_name, sum(len) AS days, max(len), "                           \
+  "   max(iif(last_day = (SELECT max(day) FROM h), len, 0)) AS streak, "       \
+  "   min(best) + 1, date(min(first_day) * 86400, 'unixepoch'), "              \
+  "   date(max(last_day) * 86400, 'unixepoch'), sum(stars) AS total "          \
+  "FROM runs JOIN omg_trending_name AS n ON n.id = runs.name_id "              \
+  "GROUP BY runs.name_id ORDER BY days DESC, streak DESC, total DESC "         \
+  "LIMIT ?5"
+
+omg_error omg_query_trending_streaks(omg_context ctx, const char *spoken_lang,
+                                     const char *lang, const char *range,
+                                     int days, int limit,
+                                     omg_trending_streak_list *out) {
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, TRENDING_STREAK_SQL, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  bind_trending_key(stmt, spoken_lang, lang, range);
+  sqlite3_bind_int64(stmt, 4, time(NULL) / 86400 - days);
+  sqlite3_bind_int(stmt, 5, limit > 0 ? limit : -1);
+
+  arena a = arena_new(sizeof(omg_trending_streak) * TRENDING_LIST_LENGTH);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_trending_streak) * (row + 1));
+    ((omg_trending_streak *)a->data)[row++] = (omg_trending_streak){
+        .full_name = arena_column_text(a, stmt, 0),
+        .days = sqlite3_column_int(stmt, 1),
+        .longest_streak = sqlite3_column_int(stmt, 2),
+        .current_streak = sqlite3_column_int(stmt, 3),
+        .best_rank = sqlite3_column_int(stmt, 4),
+        .first_seen = arena_column_text(a, stmt, 5),
+        .last_seen = arena_column_text(a, stmt, 6),
+        .stars_gained = sqlite3_column_int(stmt, 7),
+    };
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_trending_streak_list){
+      .streak_array = (omg_trending_streak *)a->data, .length = row};
+  return NO_ERROR;
+}
+
+void omg_free_trending_streak_list(omg_trending_streak_list *lst) {
+  if (lst) {
+#ifdef VERBOSE
+    printf("free omg_trending_streak_list, length is %zu\n", lst->length);
+#endif
+    arena_free_array(lst->streak_array);
+  }
+}
+
+void omg_free_gist(omg_gist *gist) {
+  if (gist) {
+#ifdef VERBOSE
+    printf("free gist, id is %s\n", gist->id);
+#endif
+    FREE_OBJ_FIELD(gist, id);
+    FREE_OBJ_FIELD(gist, created_at);
+    FREE_OBJ_FIELD(gist, description);
+    omg_gist_file *file = &gist->file;
+    FREE_OBJ_FIELD(file, filename);
+    FREE_OBJ_FIELD(file, language);
+    FREE_OBJ_FIELD(file, raw_url);
+    FREE_OBJ_FIELD(gist, _file_array);
+  }
+}
+
+void omg_free_gist_list(omg_gist_list *lst) {
+  if (lst) {
+#ifdef VERBOSE
+    printf("free omg_gist_list, length is %zu\n", lst->length);
+#endif
+    arena_free_array(lst->gist_array);
+  }
+}
+
+static omg_error fetch_gists_by_page(omg_context ctx, size_t page_num,
+                                     bool is_star, omg_gist_list *out) {
+
+  char url[128];
+  sprintf(url, "%s/gists%s?per_page=%zu&page=%zu", API_ROOT,
+          is_star ? "/starred" : "", PER_PAGE, page_num);
+  json_auto_t *resp = NULL;
+  omg_error err = omg_request(ctx, GET_METHOD, url, NULL, &resp);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  size_t resp_len = json_array_size(resp);
+  arena a = arena_new(sizeof(omg_gist) * resp_len);
+  omg_gist *gist_array = (omg_gist *)a->data;
+  for (size_t i = 0; i < resp_len; i++) {
+    json_t *one_gist = json_array_get(resp, i);
+    json_t *files = json_object_get(one_gist, "files");
+    size_t file_length = json_object_size(files);
+    omg_gist_file *file_array = (omg_gist_file *)arena_alloc(
+        a, sizeof(omg_gist_file) * (file_length ? file_length : 1));
+    const char *key;
+    json_t *value;
+    size_t j = 0;
+    json_object_foreach(files, key, value) {
+      file_array[j++] = (omg_gist_file){
+          .filename = arena_strdup(a, key),
+          .language = arena_json_string(a, value, "language"),
+          .raw_url = arena_json_string(a, value, "raw_url"),
+          .size = json_integer_value(json_object_get(value, "size")),
+      };
+    }
+    gist_array[i] = (omg_gist){
+        .id = arena_json_string(a, one_gist, "id"),
+        .created_at = arena_json_string(a, one_gist, "created_at"),
+        .description = arena_json_string(a, one_gist, "description"),
+        .public = json_boolean_value(json_object_get(one_gist, "created_at")),
+        ._file_array = file_array,
+        ._file_length = file_length,
+        .file = file_length ? file_array[0] : (omg_gist_file){},
+    };
+  }
+  *out = (omg_gist_list){.gist_array = gist_array, .length = resp_len};
+  return NO_ERROR;
+}
+
+// Files of a gist may be renamed or removed. Existing files are updated in
+// place and only missing ones are deleted, so unchanged files are not
+// rewritten on every sync.
+static omg_error save_gist_files(omg_context ctx, omg_gist gist) {
+  const char *sql = "insert into "
+                    "omg_gist_file(gist_id,filename,language,raw_url,size)"
+                    "values(?1,?2,?3,?4,?5)"
+                    "on conflict(gist_id, filename) do update set "
+                    "language=?3, raw_url=?4, size=?5";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  json_auto_t *names = json_array();
+  for (size_t i = 0; i < gist._file_length; i++) {
+    omg_gist_file file = gist._file_array[i];
+    int column = 1;
+    sqlite3_bind_text(stmt, column++, gist.id, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, column++, file.filename, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, column++, file.language, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, column++, file.raw_url, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, column++, file.size);
+    int rc = sqlite3_step(stmt);
+    if (rc != SQLITE_DONE) {
+      fprintf(stderr, "insert gist file(%s) failed. code:%d, msg:%s\n",
+              file.filename, rc, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    if (file.filename) {
+      json_array_append_new(names, json_string(file.filename));
+    }
+  }
+
+  sql = "delete from omg_gist_file where gist_id = ?1 "
+        "and filename not in (select value from json_each(?2))";
+  auto_sqlite3_stmt delete_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &delete_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  auto_string names_json = json_dumps(names, JSON_COMPACT);
+  sqlite3_bind_text(delete_stmt, 1, gist.id, -1, SQLITE_STATIC);
+  sqlite3_bind_text(delete_stmt, 2, names_json, -1, SQLITE_STATIC);
+  if (sqlite3_step(delete_stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
+}
+
+static omg_error omg_save_gists_common(omg_context ctx, omg_gist_list lst) {
+  const char *sql = "insert into omg_gist(id,created_at,description,public)"
+                    "values(?1,?2,?3,?4)"
+                    "on conflict(id)"
+                    "do update set "
+                    "description=?3, public=?4";
+  auto_sqlite3_stmt stmt = NULL;
+  int rc = sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL);
+  if (rc) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  for (size_t i = 0; i < lst.length; i++) {
+    omg_gist gist = lst.gist_array[i];
+    int column = 1;
+    sqlite3_bind_text(stmt, column++, gist.id, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, column++, gist.created_at, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, column++, gist.description, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, column++, gist.public);
+    rc = sqlite3_step(stmt);
+    if (rc != SQLITE_DONE) {
+      fprintf(stderr, "insert gist(%s) failed. code:%d, msg:%s\n", gist.id, rc,
+              sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    omg_error err = save_gist_files(ctx, gist);
+    if (!is_ok(err)) {
+      return err;
+    }
+  }
+  return NO_ERROR;
+}
+
+static omg_error omg_save_gists(omg_context ctx, bool is_star,
+                                omg_gist_list lst) {
+  omg_error err = omg_save_gists_common(ctx, lst);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  auto_sqlite3_stmt stmt = NULL;
+  const char *sql = "insert into omg_created_gist(gist_id, sync_gen) "
+                    "values(?1, ?2) "
+                    "on conflict(gist_id) do update set sync_gen = ?2";
+  if (is_star) {
+    sql = "insert into omg_starred_gist(gist_id, sync_gen) "
+          "values(?1, ?2) "
+          "on conflict(gist_id) do update set sync_gen = ?2";
+  }
+  int rc = sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL);
+  if (rc) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  for (size_t i = 0; i < lst.length; i++) {
+    sqlite3_bind_text(stmt, 1, lst.gist_array[i].id, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 2, ctx->sync_gen);
+    // a row left unstamped would be swept, so the sync must not finish
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+  }
+  return NO_ERROR;
+}
+
+omg_error omg__save_gists(omg_context ctx, bool is_star, omg_gist_list lst) {
+  return omg_save_gists(ctx, is_star, lst);
+}
+
+static omg_error omg_sync_gists_common(omg_context ctx, bool is_star) {
+  omg_error err = start_sync(ctx);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  sync_tracker tracker =
+      start_sync_tracker(is_star ? "starred gists" : "created gists");
+  size_t page_num = 1;
+  bool complete = false;
+  while (true) {
+    {
+#ifdef OMG_TEST
+      if (page_num > 2) {
+        break;
+      }
+#endif
+      omg_auto_gist_list gist_lst = {};
+      err = fetch_gists_by_page(ctx, page_num++, is_star, &gist_lst);
+      if (!is_ok(err)) {
+        return err;
+      }
+      err = omg_save_gists(ctx, is_star, gist_lst);
+      if (!is_ok(err)) {
+        return err;
+      }
+
+      complete = gist_lst.length < PER_PAGE;
+      report_sync_page(ctx, &tracker, gist_lst.length, complete);
+      if (complete) {
+        break;
+      }
+    }
+  }
+
+  return finish_sync(ctx, is_star ? "omg_starred_gist" : "omg_created_gist",
+                     complete);
+}
+
+omg_error omg_sync_created_gists(omg_context ctx) {
+  return omg_sync_gists_common(ctx, false);
+}
+
+omg_error omg_sync_starred_gists(omg_context ctx) {
+  return omg_sync_gists_common(ctx, true);
+}
+
+// LIKE pattern matching text literally, used with `escape '\'`. It matches
+// text as a prefix, or anywhere when contains is true.
+static char *like_pattern(const char *text, bool contains) {
+  size_t len = strlen(text);
+  char *pattern = malloc(len * 2 + 3);
+  char *p = pattern;
+  if (contains) {
+    *p++ = '%';
+  }
+  for (size_t i = 0; i < len; i++) {
+    char c = text[i];
+    if (c == '%' || c == '_' || c == '\\') {
+      *p++ = '\\';
+    }
+    *p++ = c;
+  }
+  *p++ = '%';
+  *p = '\0';
+  return pattern;
+}
+
+static omg_error prepare_query_gists_sql(omg_context ctx, bool is_star,
+                                         const omg_gist_filter *filter,
+                                         sqlite3_stmt **out) {
+  const omg_gist_filter no_filter = {};
+  if (!filter) {
+    filter = &no_filter;
+  }
+  bool has_language = !empty_string(filter->language);
+  bool has_filename = !empty_string(filter->filename);
+  bool has_keyword = !empty_string(filter->keyword);
+  char sql[768];
+  sprintf(sql,
+          "select g.id, datetime(g.created_at, 'localtime'), g.description, "
+          "f.filename, f.language, f.raw_url, f.size "
+          " from %s g join omg_gist_file f on f.gist_id = g.id "
+          " where 1 = 1 %s %s %s"
+          " order by %s",
+          is_star ? "omg_starred_gist_view" : "omg_created_gist_view",
+          has_language ? "and f.language = ?1" : "",
+          has_filename ? "and f.filename like ?2 escape '\\'" : "",
+          has_keyword
+              ? "and (g.description like ?3 escape '\\'"
+                " or f.filename like ?3 escape '\\')"
+              : "",
+          filter->sort == OMG_SORT_NAME ? "f.filename COLLATE NOCASE asc"
+                                        : "g.created_at desc");
+
+#ifdef OMG_TEST
+  printf("query gists, sql:%s\n", sql);
+#endif
+  int rc = sqlite3_prepare_v2(ctx->db, sql, strlen(sql), out, NULL);
+  if (rc) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  if (has_language) {
+    sqlite3_bind_text(*out, 1, filter->language, -1, SQLITE_STATIC);
+  }
+  if (has_filename) {
+    // a bound prefix pattern lets SQLite use idx_gist_filename
+    sqlite3_bind_text(*out, 2, like_pattern(filter->filename, false), -1,
+                      free);
+  }
+  if (has_keyword) {
+    sqlite3_bind_text(*out, 3, like_pattern(filter->keyword, true), -1, free);
+  }
+
+  return NO_ERROR;
+}
+
+omg_error omg_query_gists_common(omg_context ctx, bool is_star,
+                                 omg_gist_list *out) {
+  auto_sqlite3_stmt stmt = NULL;
+  omg_error err = prepare_query_gists_sql(ctx, is_star, NULL, &stmt);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  arena a = arena_new(sizeof(omg_gist) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(omg_gist) * (row + 1));
+    omg_gist gist = {
+        .id = arena_column_text(a, stmt, 0),
+        .created_at = arena_column_text(a, stmt, 1),
+        .description = arena_column_text(a, stmt, 2),
+        .file =
+            {
+                .filename = arena_column_text(a, stmt, 3),
+                .language = arena_column_text(a, stmt, 4),
+                .raw_url = arena_column_text(a, stmt, 5),
+                .size = sqlite3_column_int(stmt, 6),
+            },
+    };
+    ((omg_gist *)a->data)[row++] = gist;
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (omg_gist_list){.gist_array = (omg_gist *)a->data, .length = row};
+  return NO_ERROR;
+}
+
+omg_error omg_query_gists_each(omg_context ctx, bool is_star,
+                               const omg_gist_filter *filter,
+                               omg_gist_visitor visitor, void *userdata) {
+  auto_sqlite3_stmt stmt = NULL;
+  omg_error err = prepare_query_gists_sql(ctx, is_star, filter, &stmt);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    omg_gist gist = {
+        .id = (char *)sqlite3_column_text(stmt, 0),
+        .created_at = (char *)sqlite3_column_text(stmt, 1),
+        .description = (char *)sqlite3_column_text(stmt, 2),
+        .file =
+            {
+                .filename = (char *)sqlite3_column_text(stmt, 3),
+                .language = (char *)sqlite3_column_text(stmt, 4),
+                .raw_url = (char *)sqlite3_column_text(stmt, 5),
+                .size = sqlite3_column_int(stmt, 6),
+            },
+    };
+    if (!visitor(&gist, userdata)) {
+      return NO_ERROR;
+    }
+  }
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  return NO_ERROR;
+}
 
-static const size_t TRENDING_LIST_LENGTH = 25;
-static const size_t TRENDING_TUPLE_LENGTH = 4;
+omg_error omg_query_created_gists(omg_context ctx, omg_gist_list *out) {
+  return omg_query_gists_common(ctx, false, out);
+}
 
-// parse number like 1,234 into 1234
-static size_t omg_parse_number(char *num_with_comma) {
-  int number = 0;
-  int i = 0;
-  char c;
-  while ((c = num_with_comma[i]) != '\0') {
-    if (c == ',') {
-      i++;
-      continue;
+omg_error omg_query_starred_gists(omg_context ctx, omg_gist_list *out) {
+  return omg_query_gists_common(ctx, true, out);
+}
+
+omg_error omg_delete_gist(omg_context ctx, char *gist_id) {
+  const char *sql = "delete from omg_created_gist where gist_id = ?";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_text(stmt, 1, gist_id, -1, SQLITE_STATIC);
+
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  char url[128];
+  sprintf(url, "%s/gists/%s", API_ROOT, gist_id);
+  return omg_request(ctx, DELETE_METHOD, url, NULL, NULL);
+}
+
+omg_error omg_unstar_gist(omg_context ctx, char *gist_id) {
+  const char *sql = "delete from omg_starred_gist where gist_id = ?";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  sqlite3_bind_text(stmt, 1, gist_id, -1, SQLITE_STATIC);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  char url[128];
+  sprintf(url, "%s/gists/%s/star", API_ROOT, gist_id);
+  return omg_request(ctx, DELETE_METHOD, url, NULL, NULL);
+}
+
+/**********/
+/* README */
+/**********/
+
+#define README_CONCURRENCY 8
+// saved READMEs are committed in batches, so an interrupted refresh keeps
+// most of its work
+#define README_COMMIT_EVERY 200
+
+typedef struct {
+  int repo_id;
+  char *full_name;
+  char *pushed_at;
+  // NULL when never fetched
+  char *etag;
+} readme_task;
+
+typedef struct {
+  CURL *curl;
+  struct curl_slist *headers;
+  response body;
+  char etag[128];
+  // x-ratelimit-remaining is 0
+  bool rate_limited;
+  readme_task *task;
+} readme_transfer;
+
+// Starred repositories pushed since their README was fetched.
+static omg_error load_readme_tasks(omg_context ctx, readme_task **out,
+                                   size_t *length) {
+  const char *sql =
+      "select r.id, r.full_name, r.pushed_at, m.etag "
+      "from omg_starred_repo s join omg_repo r on r.id = s.repo_id "
+      "left join omg_readme m on m.repo_id = r.id "
+      "where m.repo_id is null or m.pushed_at is not r.pushed_at";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  arena a = arena_new(sizeof(readme_task) * 64);
+  size_t row = 0;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    a = arena_reserve(a, sizeof(readme_task) * (row + 1));
+    ((readme_task *)a->data)[row++] = (readme_task){
+        .repo_id = sqlite3_column_int(stmt, 0),
+        .full_name = arena_column_text(a, stmt, 1),
+        .pushed_at = arena_column_text(a, stmt, 2),
+        .etag = arena_column_text(a, stmt, 3),
+    };
+  }
+  if (rc != SQLITE_DONE) {
+    arena_free_array(a->data);
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  *out = (readme_task *)a->data;
+  *length = row;
+  return NO_ERROR;
+}
+
+static size_t readme_header_cb(char *buffer, size_t size, size_t nitems,
+                               void *userdata) {
+  readme_transfer *t = userdata;
+  size_t len = size * nitems;
+  copy_etag_header(buffer, len, t->etag, sizeof(t->etag));
+  const char *name = "x-ratelimit-remaining:";
+  size_t name_len = strlen(name);
+  if (len > name_len && strncasecmp(buffer, name, name_len) == 0) {
+    t->rate_limited = atoi(buffer + name_len) == 0;
+  }
+  return len;
+}
+
+static void start_readme_transfer(omg_context ctx, CURLM *multi,
+                                  readme_transfer *t, readme_task *task) {
+  char url[512];
+  snprintf(url, sizeof(url), "%s/repos/%s/readme", API_ROOT, task->full_name);
+  curl_slist_free_all(t->headers);
+  t->headers = curl_slist_append(NULL, ctx->auth_header);
+  t->headers = curl_slist_append(t->headers, HEADER_UA);
+  t->headers =
+      curl_slist_append(t->headers, "Accept: application/vnd.github.raw");
+  if (task->etag) {
+    char if_none_match[160];
+    snprintf(if_none_match, sizeof(if_none_match), "If-None-Match: %s",
+             task->etag);
+    t->headers = curl_slist_append(t->headers, if_none_match);
+  }
+  free(t->body.memory);
+  t->body = (response){.memory = malloc(1), .size = 0};
+  t->etag[0] = '\0';
+  t->rate_limited = false;
+  t->task = task;
+
+  curl_easy_setopt(t->curl, CURLOPT_URL, url);
+  curl_easy_setopt(t->curl, CURLOPT_HTTPHEADER, t->headers);
+  curl_easy_setopt(t->curl, CURLOPT_TIMEOUT, ctx->timeout);
+  curl_easy_setopt(t->curl, CURLOPT_FOLLOWLOCATION, 1L);
+  curl_easy_setopt(t->curl, CURLOPT_WRITEFUNCTION, mem_cb);
+  curl_easy_setopt(t->curl, CURLOPT_WRITEDATA, (void *)&t->body);
+  curl_easy_setopt(t->curl, CURLOPT_HEADERFUNCTION, readme_header_cb);
+  curl_easy_setopt(t->curl, CURLOPT_HEADERDATA, (void *)t);
+  curl_easy_setopt(t->curl, CURLOPT_PRIVATE, (void *)t);
+#ifdef VERBOSE
+  curl_easy_setopt(t->curl, CURLOPT_VERBOSE, 1L);
+#endif
+  curl_multi_add_handle(multi, t->curl);
+}
+
+// content is NULL for repositories without README.
+static omg_error save_readme(omg_context ctx, sqlite3_stmt *stmt,
+                             sqlite3_stmt *index_stmt, readme_task *task,
+                             const char *etag, const char *content,
+                             size_t len) {
+  Bytef *compressed = NULL;
+  uLongf compressed_len = 0;
+  if (content) {
+    compressed_len = compressBound(len);
+    compressed = malloc(compressed_len);
+    if (compress2(compressed, &compressed_len, (const Bytef *)content, len,
+                  Z_DEFAULT_COMPRESSION) != Z_OK) {
+      free(compressed);
+      return new_error(OMG_CODE_INTERNAL, "compress README failed");
     }
-    number = number * 10 + (c - '0');
-    i++;
   }
-  return number;
+
+  int column = 1;
+  sqlite3_bind_int(stmt, column++, task->repo_id);
+  sqlite3_bind_text(stmt, column++, task->pushed_at, -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmt, column++, etag, -1, SQLITE_STATIC);
+  if (compressed) {
+    sqlite3_bind_blob(stmt, column++, compressed, compressed_len,
+                      SQLITE_STATIC);
+  } else {
+    sqlite3_bind_null(stmt, column++);
+  }
+  sqlite3_bind_int64(stmt, column++, len);
+  int rc = sqlite3_step(stmt);
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+  free(compressed);
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  if (!content) {
+    return NO_ERROR;
+  }
+
+  // old text is removed by trigger when content is updated
+  sqlite3_bind_int(index_stmt, 1, task->repo_id);
+  sqlite3_bind_text(index_stmt, 2, content, len, SQLITE_STATIC);
+  rc = sqlite3_step(index_stmt);
+  sqlite3_reset(index_stmt);
+  sqlite3_clear_bindings(index_stmt);
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
 }
 
-static omg_error omg_parse_trending(omg_context ctx, const char *html,
-                                    omg_repo_list *out) {
-  omg_repo *repo_array = malloc(sizeof(omg_repo) * TRENDING_LIST_LENGTH);
-  regmatch_t pmatch[TRENDING_TUPLE_LENGTH];
+// Unchanged README, only remember the pushed_at it is valid for.
+static omg_error touch_readme(omg_context ctx, sqlite3_stmt *stmt,
+                              readme_task *task) {
+  sqlite3_bind_int(stmt, 1, task->repo_id);
+  sqlite3_bind_text(stmt, 2, task->pushed_at, -1, SQLITE_STATIC);
+  int rc = sqlite3_step(stmt);
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return NO_ERROR;
+}
 
-  const char *head = html;
-  size_t arr_len = 0;
-  for (size_t i = 0; i < TRENDING_LIST_LENGTH; i++) {
-    if (pcre2_regexec(&ctx->trending_re, head, TRENDING_TUPLE_LENGTH, pmatch,
-                      0)) {
+static omg_error finish_readme_transfer(omg_context ctx, CURLcode result,
+                                        readme_transfer *t,
+                                        sqlite3_stmt *save_stmt,
+                                        sqlite3_stmt *index_stmt,
+                                        sqlite3_stmt *touch_stmt,
+                                        omg_readme_sync_stats *stats) {
+  long response_code = 0;
+  curl_easy_getinfo(t->curl, CURLINFO_RESPONSE_CODE, &response_code);
+  if (result != CURLE_OK) {
+    stats->failed++;
+    return NO_ERROR;
+  }
+  switch (response_code) {
+  case 200:
+    stats->updated++;
+    return save_readme(ctx, save_stmt, index_stmt, t->task,
+                       t->etag[0] ? t->etag : NULL, t->body.memory,
+                       t->body.size);
+  case 304:
+    stats->not_modified++;
+    return touch_readme(ctx, touch_stmt, t->task);
+  case 404:
+    stats->missing++;
+    return save_readme(ctx, save_stmt, index_stmt, t->task, NULL, NULL, 0);
+  case 403:
+  case 429:
+    stats->failed++;
+    // 403 is also sent for repositories whose access is blocked, only a
+    // depleted rate limit makes remaining requests fail too
+    if (response_code == 403 && !t->rate_limited) {
+      return NO_ERROR;
+    }
+    return new_error(OMG_CODE_CURL, "API rate limit exceeded");
+  default:
+    stats->failed++;
+    return NO_ERROR;
+  }
+}
+
+static omg_error run_readme_transfers(omg_context ctx, CURLM *multi,
+                                      readme_transfer *transfers,
+                                      size_t concurrency, readme_task *tasks,
+                                      size_t length,
+                                      omg_readme_sync_stats *stats) {
+  const char *sql =
+      "insert into omg_readme(repo_id,pushed_at,etag,content,size,fetched_at)"
+      "values(?1,?2,?3,?4,?5,strftime('%Y-%m-%dT%H:%M:%SZ','now'))"
+      "on conflict(repo_id) do update set "
+      "pushed_at=?2, etag=?3, content=?4, size=?5, "
+      "fetched_at=excluded.fetched_at";
+  auto_sqlite3_stmt save_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &save_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sql = "insert into omg_readme_fts(rowid,content) values(?1,?2)";
+  auto_sqlite3_stmt index_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &index_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sql = "update omg_readme set pushed_at=?2, "
+        "fetched_at=strftime('%Y-%m-%dT%H:%M:%SZ','now') where repo_id=?1";
+  auto_sqlite3_stmt touch_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &touch_stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  if (sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  size_t next = 0;
+  for (size_t i = 0; i < concurrency && next < length; i++) {
+    start_readme_transfer(ctx, multi, &transfers[i], &tasks[next++]);
+  }
+
+  omg_error err = NO_ERROR;
+  int running = 0;
+  size_t saved = 0;
+  do {
+    CURLMcode mc = curl_multi_perform(multi, &running);
+    if (mc == CURLM_OK && running) {
+      mc = curl_multi_poll(multi, NULL, 0, 1000, NULL);
+    }
+    if (mc != CURLM_OK) {
+      err = new_error(OMG_CODE_CURL, curl_multi_strerror(mc));
       break;
     }
-    arr_len++;
-    char *matched[TRENDING_TUPLE_LENGTH];
-    for (size_t j = 1; j < TRENDING_TUPLE_LENGTH; j++) {
-      regoff_t len = pmatch[j].rm_eo - pmatch[j].rm_so;
 
-      char *buf = malloc(len + 1);
-      memcpy(buf, head + pmatch[j].rm_so, len);
-      buf[len] = '\0';
-      matched[j] = buf;
+    CURLMsg *msg = NULL;
+    int queued = 0;
+    while ((msg = curl_multi_info_read(multi, &queued))) {
+      if (msg->msg != CURLMSG_DONE) {
+        continue;
+      }
+      readme_transfer *t = NULL;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&t);
+      CURLcode result = msg->data.result;
+      curl_multi_remove_handle(multi, t->curl);
+      if (is_ok(err)) {
+        err = finish_readme_transfer(ctx, result, t, save_stmt, index_stmt,
+                                     touch_stmt, stats);
+      }
+      if (++saved % README_COMMIT_EVERY == 0 && is_ok(err) &&
+          sqlite3_exec(ctx->db, "commit; begin", NULL, NULL, NULL)) {
+        err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+      }
+      // the handle is reused for next task, in-flight ones are drained on
+      // error
+      if (is_ok(err) && next < length) {
+        start_readme_transfer(ctx, multi, t, &tasks[next++]);
+        running++;
+      }
+    }
+  } while (running);
+  if (sqlite3_exec(ctx->db, "commit", NULL, NULL, NULL)) {
+    if (is_ok(err)) {
+      err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_exec(ctx->db, "rollback", NULL, NULL, NULL);
+  }
+
+  return err;
+}
+
+omg_error omg_sync_readmes(omg_context ctx, int32_t concurrency,
+                           omg_readme_sync_stats *out) {
+  readme_task *tasks = NULL;
+  size_t length = 0;
+  omg_error err = load_readme_tasks(ctx, &tasks, &length);
+  if (!is_ok(err)) {
+    return err;
+  }
+  omg_readme_sync_stats stats = {.checked = length};
+  size_t slots = concurrency > 0 ? concurrency : README_CONCURRENCY;
+  readme_transfer *transfers = calloc(slots, sizeof(readme_transfer));
+  CURLM *multi = curl_multi_init();
+  if (!multi) {
+    err = new_error(OMG_CODE_CURL, "curl multi init");
+  }
+  for (size_t i = 0; is_ok(err) && i < slots; i++) {
+    transfers[i].curl = curl_easy_init();
+    if (!transfers[i].curl) {
+      err = new_error(OMG_CODE_CURL, "curl init");
+    }
+  }
+  if (is_ok(err)) {
+    err = run_readme_transfers(ctx, multi, transfers, slots, tasks, length,
+                               &stats);
+  }
+
+  for (size_t i = 0; i < slots; i++) {
+    curl_easy_cleanup(transfers[i].curl);
+    curl_slist_free_all(transfers[i].headers);
+    free(transfers[i].body.memory);
+  }
+  free(transfers);
+  curl_multi_cleanup(multi);
+  arena_free_array(tasks);
+
+  if (out) {
+    *out = stats;
+  }
+  return err;
+}
+
+// Quote each word of query, so users don't need to know FTS5 syntax, a
+// trailing `*` still means prefix match.
+static char *readme_match_expr(const char *query) {
+  // worst case is a lone `"`, which becomes `""""` followed by a space
+  char *expr = malloc(strlen(query) * 4 + 3);
+  size_t len = 0;
+  const char *p = query;
+  while (*p) {
+    while (isspace((unsigned char)*p)) {
+      p++;
+    }
+    if (!*p) {
+      break;
+    }
+    if (len > 0) {
+      expr[len++] = ' ';
+    }
+    expr[len++] = '"';
+    bool prefix = false;
+    for (; *p && !isspace((unsigned char)*p); p++) {
+      if (*p == '*' && (!p[1] || isspace((unsigned char)p[1]))) {
+        prefix = true;
+        continue;
+      }
+      if (*p == '"') {
+        expr[len++] = '"';
+      }
+      expr[len++] = *p;
+    }
+    expr[len++] = '"';
+    if (prefix) {
+      expr[len++] = '*';
+    }
+  }
+  expr[len] = '\0';
+  return expr;
+}
+
+omg_error omg_search_readmes_each(omg_context ctx, const char *query,
+                                  const omg_readme_marks *marks,
+                                  omg_readme_visitor visitor, void *userdata) {
+  const omg_readme_marks default_marks = {};
+  marks = marks ? marks : &default_marks;
+  omg_auto_char expr = readme_match_expr(query ? query : "");
+  if (empty_string(expr)) {
+    return NO_ERROR;
+  }
+
+  const char *sql = "select v.*, snippet(omg_readme_fts, 0, ?2, ?3, '...', ?4)"
+                    " from omg_readme_fts f"
+                    " join omg_starred_repo_view v on v.id = f.rowid"
+                    " where omg_readme_fts match ?1 order by f.rank limit ?5";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_text(stmt, 1, expr, -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 2, marks->open ? marks->open : "[", -1,
+                    SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 3, marks->close ? marks->close : "]", -1,
+                    SQLITE_STATIC);
+  sqlite3_bind_int(stmt, 4,
+                   marks->snippet_tokens > 0 ? marks->snippet_tokens : 16);
+  sqlite3_bind_int(stmt, 5, marks->limit > 0 ? marks->limit : -1);
+
+  int snippet_column = sqlite3_column_count(stmt) - 1;
+  int rc = 0;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    omg_starred_repo star = {
+        .starred_at = (char *)sqlite3_column_text(stmt, 0),
+        .repo = repo_view_from_db(stmt),
+    };
+    const char *snippet =
+        (const char *)sqlite3_column_text(stmt, snippet_column);
+    if (!visitor(&star, snippet, userdata)) {
+      return NO_ERROR;
+    }
+  }
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  return NO_ERROR;
+}
+
+omg_error omg_query_readme(omg_context ctx, int repo_id, const char *query,
+                           const omg_readme_marks *marks, char **out) {
+  const omg_readme_marks default_marks = {};
+  marks = marks ? marks : &default_marks;
+  omg_auto_char expr = readme_match_expr(query ? query : "");
+  // highlight() only works on rows matching the query
+  const char *sql =
+      empty_string(expr)
+          ? "select omg_inflate(content, `size`) from omg_readme"
+            " where repo_id = ?1"
+          : "select highlight(omg_readme_fts, 0, ?3, ?4) from omg_readme_fts"
+            " where omg_readme_fts match ?2 and rowid = ?1";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  sqlite3_bind_int(stmt, 1, repo_id);
+  if (!empty_string(expr)) {
+    sqlite3_bind_text(stmt, 2, expr, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 3, marks->open ? marks->open : "[", -1,
+                      SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 4, marks->close ? marks->close : "]", -1,
+                      SQLITE_STATIC);
+  }
+
+  int rc = sqlite3_step(stmt);
+  if (rc == SQLITE_ROW) {
+    *out = strdup_when_not_null(sqlite3_column_text(stmt, 0));
+    return NO_ERROR;
+  }
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  *out = NULL;
+  return NO_ERROR;
+}
+
+/**********/
+/* Export */
+/**********/
+
+#define EXPORT_BUFFER_SIZE (64 * 1024)
+
+typedef struct {
+  int fd;
+  size_t len;
+  // errno of the first failed write, 0 means no error
+  int error;
+  char data[EXPORT_BUFFER_SIZE];
+} export_writer;
+
+static void export_flush(export_writer *w) {
+  size_t written = 0;
+  while (!w->error && written < w->len) {
+    ssize_t n = write(w->fd, w->data + written, w->len - written);
+    if (n >= 0) {
+      written += n;
+    } else if (errno != EINTR) {
+      w->error = errno;
+    }
+  }
+  w->len = 0;
+}
+
+static void export_write(export_writer *w, const char *s, size_t len) {
+  while (len > 0) {
+    if (w->len == EXPORT_BUFFER_SIZE) {
+      export_flush(w);
+    }
+    size_t n = EXPORT_BUFFER_SIZE - w->len;
+    n = n < len ? n : len;
+    memcpy(w->data + w->len, s, n);
+    w->len += n;
+    s += n;
+    len -= n;
+  }
+}
+
+static void export_char(export_writer *w, char c) {
+  if (w->len == EXPORT_BUFFER_SIZE) {
+    export_flush(w);
+  }
+  w->data[w->len++] = c;
+}
+
+static void export_json_string(export_writer *w, const char *s, size_t len) {
+  static const char hex[] = "0123456789abcdef";
+  export_char(w, '"');
+  size_t start = 0;
+  for (size_t i = 0; i < len; i++) {
+    unsigned char c = s[i];
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+    export_write(w, s + start, i - start);
+    start = i + 1;
+    switch (c) {
+    case '"':
+      export_write(w, "\\\"", 2);
+      break;
+    case '\\':
+      export_write(w, "\\\\", 2);
+      break;
+    case '\n':
+      export_write(w, "\\n", 2);
+      break;
+    case '\r':
+      export_write(w, "\\r", 2);
+      break;
+    case '\t':
+      export_write(w, "\\t", 2);
+      break;
+    default: {
+      char escaped[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+      export_write(w, escaped, sizeof(escaped));
+    }
+    }
+  }
+  export_write(w, s + start, len - start);
+  export_char(w, '"');
+}
+
+// RFC 4180, quote only when needed.
+static void export_csv_string(export_writer *w, const char *s, size_t len) {
+  bool need_quote = false;
+  for (size_t i = 0; i < len && !need_quote; i++) {
+    need_quote = s[i] == ',' || s[i] == '"' || s[i] == '\r' || s[i] == '\n';
+  }
+  if (!need_quote) {
+    export_write(w, s, len);
+    return;
+  }
+
+  export_char(w, '"');
+  size_t start = 0;
+  for (size_t i = 0; i < len; i++) {
+    if (s[i] == '"') {
+      // write up to and including the quote, it will be written again
+      export_write(w, s + start, i + 1 - start);
+      start = i;
+    }
+  }
+  export_write(w, s + start, len - start);
+  export_char(w, '"');
+}
+
+// JSON array of topics of repository r, sorted
+#define EXPORT_TOPICS_COLUMN                                                   \
+  "(select json_group_array(topic) from omg_repo_topic t "                     \
+  "where t.repo_id = r.id) as topics "
+
+static const char *export_sql(omg_export_kind kind) {
+  switch (kind) {
+  case OMG_EXPORT_CREATED_REPOS:
+    return "select id, full_name, description, private, created_at, license, "
+           "pushed_at, stargazers_count, watchers_count, forks_count, lang, "
+           "homepage, `size`, " EXPORT_TOPICS_COLUMN
+           "from omg_created_repo_view r order by created_at desc";
+  case OMG_EXPORT_STARRED_REPOS:
+    return "select starred_at, id, full_name, description, private, "
+           "created_at, license, pushed_at, stargazers_count, "
+           "watchers_count, forks_count, lang, homepage, `size`, "
+           EXPORT_TOPICS_COLUMN
+           "from omg_starred_repo_view r order by starred_at desc";
+  case OMG_EXPORT_CREATED_GISTS:
+    return "select g.id, g.created_at, g.description, g.public, f.filename, "
+           "f.language, f.raw_url, f.size from omg_created_gist_view g "
+           "join omg_gist_file f on f.gist_id = g.id "
+           "order by g.created_at desc";
+  case OMG_EXPORT_STARRED_GISTS:
+    return "select g.id, g.created_at, g.description, g.public, f.filename, "
+           "f.language, f.raw_url, f.size from omg_starred_gist_view g "
+           "join omg_gist_file f on f.gist_id = g.id "
+           "order by g.created_at desc";
+  }
+  return NULL;
+}
+
+omg_error omg_export(omg_context ctx, omg_export_kind kind,
+                     omg_export_format format, int fd) {
+  const char *sql = export_sql(kind);
+  if (!sql) {
+    return (omg_error){.code = OMG_CODE_INTERNAL,
+                       .message = "unknown export kind"};
+  }
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+
+  export_writer *w = malloc(sizeof(export_writer));
+  *w = (export_writer){.fd = fd};
+  int columns = sqlite3_column_count(stmt);
+  if (format == OMG_FORMAT_CSV) {
+    for (int i = 0; i < columns; i++) {
+      if (i > 0) {
+        export_char(w, ',');
+      }
+      const char *name = sqlite3_column_name(stmt, i);
+      export_csv_string(w, name, strlen(name));
+    }
+    export_char(w, '\n');
+  }
+
+  // One cursor, rows are encoded straight from SQLite's buffers, so memory
+  // stays constant whatever the table size.
+  int rc = 0;
+  char number[32];
+  while (!w->error && (rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+    if (format == OMG_FORMAT_JSONL) {
+      export_char(w, '{');
+    }
+    for (int i = 0; i < columns; i++) {
+      if (format == OMG_FORMAT_JSONL) {
+        const char *name = sqlite3_column_name(stmt, i);
+        if (i > 0) {
+          export_char(w, ',');
+        }
+        export_json_string(w, name, strlen(name));
+        export_char(w, ':');
+      } else if (i > 0) {
+        export_char(w, ',');
+      }
+
+      switch (sqlite3_column_type(stmt, i)) {
+      case SQLITE_NULL:
+        if (format == OMG_FORMAT_JSONL) {
+          export_write(w, "null", 4);
+        }
+        break;
+      case SQLITE_INTEGER: {
+        int len = sprintf(number, "%lld", sqlite3_column_int64(stmt, i));
+        export_write(w, number, len);
+        break;
+      }
+      case SQLITE_FLOAT: {
+        int len = sprintf(number, "%.17g", sqlite3_column_double(stmt, i));
+        export_write(w, number, len);
+        break;
+      }
+      default: {
+        const char *text = (const char *)sqlite3_column_text(stmt, i);
+        size_t len = sqlite3_column_bytes(stmt, i);
+        if (format == OMG_FORMAT_JSONL &&
+            0 == strcmp(sqlite3_column_name(stmt, i), "topics")) {
+          // already JSON, kept as an array
+          export_write(w, text, len);
+        } else if (format == OMG_FORMAT_JSONL) {
+          export_json_string(w, text, len);
+        } else {
+          export_csv_string(w, text, len);
+        }
+      }
+      }
     }
-
-    omg_repo repo = {};
-    repo.description = matched[1];
-    repo.full_name = matched[2];
-    omg_auto_char current_stars = matched[3];
-    repo.stargazers_count = omg_parse_number(current_stars);
-    repo_array[i] = repo;
-
-    head += pmatch[3].rm_eo;
+    if (format == OMG_FORMAT_JSONL) {
+      export_char(w, '}');
+    }
+    export_char(w, '\n');
   }
+  export_flush(w);
+  int error = w->error;
+  free(w);
 
-  *out = (omg_repo_list){.repo_array = repo_array, .length = arr_len};
+  if (error) {
+    return new_error(OMG_CODE_INTERNAL, strerror(error));
+  }
+  if (rc != SQLITE_DONE) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
   return NO_ERROR;
 }
 
-omg_error omg_query_trending(omg_context ctx, const char *spoken_lang,
-                             const char *lang, const char *range,
-                             omg_repo_list *out) {
-
-  char url[128];
-  sprintf(url,
-          "https://github.com/trending/%s?since=%s&spoken_language_code=%s",
-          empty_string(lang) ? "" : lang,   // lang
-          empty_string(range) ? "" : range, // range
-          empty_string(spoken_lang) ? "" : spoken_lang);
+/**************/
+/* Changesets */
+/**************/
 
-  CURL *curl = ctx->trending_curl;
-  if (!curl) {
-    return (omg_error){.code = OMG_CODE_CURL, .message = "curl init"};
-  }
+#define CHANGESET_FORMAT "omg-changeset"
+#define CHANGESET_VERSION 1
+#define CHANGESET_SQL_SIZE 2048
+#define CHANGESET_SOURCE_SIZE 33
 
-  curl_easy_setopt(curl, CURLOPT_URL, url);
-  auto_response chunk = {.memory = malloc(1), .size = 0};
-  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *)&chunk);
+// Tables tracked by omg_changelog. Local ids and sync_gen are not shared, and
+// omg_repo_stats is rebuilt by the triggers of omg_repo on the importing side.
+typedef struct {
+  const char *name;
+  // the first `key_count` columns are the primary key
+  size_t key_count;
+  const char *columns[14];
+} changeset_table;
+
+static const changeset_table CHANGESET_TABLES[] = {
+    {"omg_repo",
+     1,
+     {"id", "full_name", "description", "private", "created_at", "license",
+      "pushed_at", "stargazers_count", "watchers_count", "forks_count",
+      "lang", "homepage", "size"}},
+    {"omg_starred_repo", 1, {"repo_id", "starred_at"}},
+    {"omg_created_repo", 1, {"repo_id"}},
+    {"omg_gist", 1, {"id", "created_at", "description", "public"}},
+    {"omg_gist_file",
+     2,
+     {"gist_id", "filename", "language", "raw_url", "size"}},
+    {"omg_starred_gist", 1, {"gist_id"}},
+    {"omg_created_gist", 1, {"gist_id"}},
+    {"omg_repo_topic", 2, {"repo_id", "topic"}},
+};
 
-  CURLcode res = curl_easy_perform(curl);
-  if (res != CURLE_OK) {
-    return new_error(OMG_CODE_CURL, curl_easy_strerror(res));
-  }
+#define CHANGESET_TABLE_COUNT                                                  \
+  (sizeof(CHANGESET_TABLES) / sizeof(CHANGESET_TABLES[0]))
 
-  long response_code;
-  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
-  if (response_code != 200) {
-    fprintf(stderr, "visit trending failed. code:%ld\n", response_code);
-    if (response_code == 429) {
-      return (omg_error){.code = OMG_CODE_CURL,
-                         .message = "429 Too Many Requests, try again later!"};
+static int changeset_table_index(const char *name) {
+  for (size_t i = 0; name && i < CHANGESET_TABLE_COUNT; i++) {
+    if (strcmp(CHANGESET_TABLES[i].name, name) == 0) {
+      return i;
     }
-    return (omg_error){.code = OMG_CODE_CURL,
-                       .message = "Get trending URL not 200 OK"};
-  }
-
-  omg_error err = omg_parse_trending(ctx, chunk.memory, out);
-  if (!is_ok(err)) {
-    return err;
   }
-
-  return NO_ERROR;
+  return -1;
 }
 
-void omg_free_gist(omg_gist *gist) {
-  if (gist) {
-#ifdef VERBOSE
-    printf("free gist, id is %s\n", gist->id);
-#endif
-    FREE_OBJ_FIELD(gist, id);
-    FREE_OBJ_FIELD(gist, created_at);
-    FREE_OBJ_FIELD(gist, description);
-    FREE_OBJ_FIELD(gist, _files_as_json);
-    omg_gist_file *file = &gist->file;
-    FREE_OBJ_FIELD(file, filename);
-    FREE_OBJ_FIELD(file, language);
-    FREE_OBJ_FIELD(file, raw_url);
+// Match primary key against the JSON array at `path` of ?1.
+static int changeset_key_where(char *sql, const changeset_table *t,
+                               const char *path) {
+  int len = sprintf(sql, " where ");
+  for (size_t i = 0; i < t->key_count; i++) {
+    len += sprintf(sql + len, "%s\"%s\" = json_extract(?1, '%s[%zu]')",
+                   i ? " and " : "", t->columns[i], path, i);
   }
+  return len;
 }
 
-void omg_free_gist_list(omg_gist_list *lst) {
-  for (size_t i = 0; i < lst->length; i++) {
-    omg_free_gist(&lst->gist_array[i]);
+static int changeset_select_sql(char *sql, const changeset_table *t) {
+  int len = sprintf(sql, "select json_object(");
+  for (size_t i = 0; t->columns[i]; i++) {
+    len += sprintf(sql + len, "%s'%s', \"%s\"", i ? ", " : "", t->columns[i],
+                   t->columns[i]);
   }
-  free(lst->gist_array);
+  len += sprintf(sql + len, ") from %s", t->name);
+  return len + changeset_key_where(sql + len, t, "$");
 }
 
-static omg_error fetch_gists_by_page(omg_context ctx, size_t page_num,
-                                     bool is_star, omg_gist_list *out) {
+static int changeset_delete_sql(char *sql, const changeset_table *t) {
+  int len = sprintf(sql, "delete from %s", t->name);
+  return len + changeset_key_where(sql + len, t, "$.key");
+}
 
-  char url[128];
-  sprintf(url, "%s/gists%s?per_page=%zu&page=%zu", API_ROOT,
-          is_star ? "/starred" : "", PER_PAGE, page_num);
-  json_auto_t *resp = NULL;
-  omg_error err = omg_request(ctx, GET_METHOD, url, NULL, &resp);
-  if (!is_ok(err)) {
-    return err;
+// Upsert from `row` of ?1, so the same line can be applied any times.
+static int changeset_upsert_sql(char *sql, const changeset_table *t) {
+  int len = sprintf(sql, "insert into %s (", t->name);
+  for (size_t i = 0; t->columns[i]; i++) {
+    len += sprintf(sql + len, "%s\"%s\"", i ? ", " : "", t->columns[i]);
   }
+  len += sprintf(sql + len, ") values (");
+  for (size_t i = 0; t->columns[i]; i++) {
+    len += sprintf(sql + len, "%sjson_extract(?1, '$.row.%s')", i ? ", " : "",
+                   t->columns[i]);
+  }
+  len += sprintf(sql + len, ") on conflict (");
+  for (size_t i = 0; i < t->key_count; i++) {
+    len += sprintf(sql + len, "%s\"%s\"", i ? ", " : "", t->columns[i]);
+  }
+  if (!t->columns[t->key_count]) {
+    return len + sprintf(sql + len, ") do nothing");
+  }
+  len += sprintf(sql + len, ") do update set ");
+  for (size_t i = t->key_count; t->columns[i]; i++) {
+    len += sprintf(sql + len, "%s\"%s\" = excluded.\"%s\"",
+                   i > t->key_count ? ", " : "", t->columns[i], t->columns[i]);
+  }
+  return len;
+}
 
-  size_t resp_len = json_array_size(resp);
-  omg_gist *gist_array = malloc(sizeof(omg_gist) * resp_len);
-  for (size_t i = 0; i < resp_len; i++) {
-    json_t *one_gist = json_array_get(resp, i);
-    gist_array[i] = (omg_gist){
-        .id = dup_json_string(one_gist, "id"),
-        .created_at = dup_json_string(one_gist, "created_at"),
-        .description = dup_json_string(one_gist, "description"),
-        .public = json_boolean_value(json_object_get(one_gist, "created_at")),
-        ._files_as_json = json_dumps(json_object_get(one_gist, "files"), 0),
-    };
+typedef int (*changeset_sql_builder)(char *sql, const changeset_table *t);
+
+// Statements are prepared on first use of each table.
+static omg_error changeset_stmt(omg_context ctx, sqlite3_stmt **stmts,
+                                int table, changeset_sql_builder build,
+                                sqlite3_stmt **out) {
+  if (!stmts[table]) {
+    char sql[CHANGESET_SQL_SIZE];
+    build(sql, &CHANGESET_TABLES[table]);
+    if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmts[table], NULL)) {
+      return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
   }
-  *out = (omg_gist_list){.gist_array = gist_array, .length = resp_len};
+  *out = stmts[table];
   return NO_ERROR;
 }
 
-static omg_error omg_save_gists_common(omg_context ctx, omg_gist_list lst) {
-  const char *sql =
-      "insert into omg_gist(id,created_at,description,files,public)"
-      "values(?1,?2,?3,?4,?5)"
-      "on conflict(id)"
-      "do update set "
-      "description=?3, files=?4, public=?5";
-  auto_sqlite3_stmt stmt = NULL;
-  int rc = sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL);
-  if (rc) {
+static void finalize_changeset_stmts(sqlite3_stmt **stmts) {
+  for (size_t i = 0; i < CHANGESET_TABLE_COUNT; i++) {
+    sqlite3_finalize(stmts[i]);
+  }
+}
+
+// Random id of this database, created on first export. Changesets carry it,
+// so positions of different sources are never compared.
+static omg_error changeset_source(omg_context ctx,
+                                  char source[CHANGESET_SOURCE_SIZE]) {
+  const char *sql = "insert or ignore into omg_meta(key, value) "
+                    "values ('changeset_source', lower(hex(randomblob(16))))";
+  if (sqlite3_exec(ctx->db, sql, NULL, NULL, NULL)) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
-  for (size_t i = 0; i < lst.length; i++) {
-    omg_gist gist = lst.gist_array[i];
-    int column = 1;
-    sqlite3_bind_text(stmt, column++, gist.id, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, column++, gist.created_at, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, column++, gist.description, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, column++, gist._files_as_json, -1, SQLITE_STATIC);
-    sqlite3_bind_int(stmt, column++, gist.public);
-    rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      fprintf(stderr, "insert gist(%s) failed. code:%d, msg:%s\n", gist.id, rc,
-              sqlite3_errmsg(ctx->db));
-    }
-    sqlite3_reset(stmt);
-    sqlite3_clear_bindings(stmt);
+  sql = "select value from omg_meta where key = 'changeset_source'";
+  auto_sqlite3_stmt stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
+  snprintf(source, CHANGESET_SOURCE_SIZE, "%s", sqlite3_column_text(stmt, 0));
   return NO_ERROR;
 }
 
-static omg_error omg_save_gists(omg_context ctx, bool is_star,
-                                omg_gist_list lst) {
-  omg_error err = omg_save_gists_common(ctx, lst);
+static omg_error write_changeset(omg_context ctx, int64_t since,
+                                 export_writer *w, int64_t *until) {
+  char source[CHANGESET_SOURCE_SIZE];
+  omg_error err = changeset_source(ctx, source);
   if (!is_ok(err)) {
     return err;
   }
-
   auto_sqlite3_stmt stmt = NULL;
-  const char *sql =
-      "insert or ignore into omg_created_gist(gist_id) values(?1)";
-  if (is_star) {
-    sql = "insert or ignore into omg_starred_gist(gist_id) values(?1)";
+  const char *sql = "select coalesce(max(seq), 0) from omg_changelog";
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL) ||
+      sqlite3_step(stmt) != SQLITE_ROW) {
+    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
-  int rc = sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL);
-  if (rc) {
+  *until = sqlite3_column_int64(stmt, 0);
+
+  char header[192];
+  int len = sprintf(header,
+                    "{\"format\":\"" CHANGESET_FORMAT "\",\"version\":%d,"
+                    "\"source\":\"%s\",\"since\":%" PRId64
+                    ",\"until\":%" PRId64 "}\n",
+                    CHANGESET_VERSION, source, since, *until);
+  export_write(w, header, len);
+
+  // Only the latest state of each row is kept in the change log, so a row
+  // changed many times is written once.
+  sql = "select tbl, row_key, deleted from omg_changelog "
+        "where seq > ?1 and seq <= ?2 order by seq";
+  auto_sqlite3_stmt changes_stmt = NULL;
+  if (sqlite3_prepare_v2(ctx->db, sql, -1, &changes_stmt, NULL)) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
+  sqlite3_bind_int64(changes_stmt, 1, since);
+  sqlite3_bind_int64(changes_stmt, 2, *until);
 
-  for (size_t i = 0; i < lst.length; i++) {
-    sqlite3_bind_text(stmt, 1, lst.gist_array[i].id, -1, SQLITE_STATIC);
-    rc = sqlite3_step(stmt);
-    if (rc != SQLITE_DONE) {
-      fprintf(stderr, "insert created/starred(%s) failed. code:%d, msg:%s\n",
-              lst.gist_array[i].id, rc, sqlite3_errmsg(ctx->db));
+  sqlite3_stmt *select_stmts[CHANGESET_TABLE_COUNT] = {};
+  int rc = 0;
+  while (!w->error && (rc = sqlite3_step(changes_stmt)) == SQLITE_ROW) {
+    const char *tbl = (const char *)sqlite3_column_text(changes_stmt, 0);
+    int table = changeset_table_index(tbl);
+    if (table < 0) {
+      continue;
+    }
+    const char *key = (const char *)sqlite3_column_text(changes_stmt, 1);
+    if (sqlite3_column_int(changes_stmt, 2)) {
+      export_write(w, "{\"table\":\"", 10);
+      export_write(w, tbl, strlen(tbl));
+      export_write(w, "\",\"op\":\"delete\",\"key\":", 22);
+      export_write(w, key, strlen(key));
+      export_write(w, "}\n", 2);
+      continue;
     }
-    sqlite3_reset(stmt);
-    sqlite3_clear_bindings(stmt);
-  }
-  return NO_ERROR;
-}
-
-static omg_error omg_sync_gists_common(omg_context ctx, bool is_star) {
-  size_t page_num = 1;
-  while (true) {
-    {
-#ifdef OMG_TEST
-      if (page_num > 2) {
-        break;
-      }
-#endif
-      omg_auto_gist_list gist_lst = {};
-      omg_error err = fetch_gists_by_page(ctx, page_num++, is_star, &gist_lst);
-      if (!is_ok(err)) {
-        return err;
-      }
-      err = omg_save_gists(ctx, is_star, gist_lst);
-      if (!is_ok(err)) {
-        return err;
-      }
 
-      if (gist_lst.length < PER_PAGE) {
-        break;
-      }
+    sqlite3_stmt *select_stmt = NULL;
+    err = changeset_stmt(ctx, select_stmts, table, changeset_select_sql,
+                         &select_stmt);
+    if (!is_ok(err)) {
+      break;
+    }
+    sqlite3_bind_text(select_stmt, 1, key, -1, SQLITE_STATIC);
+    if (sqlite3_step(select_stmt) == SQLITE_ROW) {
+      const char *row = (const char *)sqlite3_column_text(select_stmt, 0);
+      export_write(w, "{\"table\":\"", 10);
+      export_write(w, tbl, strlen(tbl));
+      export_write(w, "\",\"op\":\"upsert\",\"row\":", 22);
+      export_write(w, row, sqlite3_column_bytes(select_stmt, 0));
+      export_write(w, "}\n", 2);
     }
+    sqlite3_reset(select_stmt);
   }
+  finalize_changeset_stmts(select_stmts);
 
-  return NO_ERROR;
-}
-
-omg_error omg_sync_created_gists(omg_context ctx) {
-  return omg_sync_gists_common(ctx, false);
-}
-
-omg_error omg_sync_starred_gists(omg_context ctx) {
-  return omg_sync_gists_common(ctx, true);
+  if (is_ok(err) && !w->error && rc != SQLITE_DONE) {
+    err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  }
+  return err;
 }
 
-omg_error omg_query_gists_common(omg_context ctx, bool is_star,
-                                 omg_gist_list *out) {
-  char sql[512];
-  sprintf(sql,
-          "select g.id, datetime(created_at, 'localtime'), g.description, "
-          "json_extract(value, '$.filename'),"
-          "json_extract(value, '$.language'),"
-          "json_extract(value, '$.raw_url'),"
-          "json_extract(value, '$.size')"
-          // ->> require sqlite3 3.38.0 (2022-02-22)
-          /* "value ->> 'filename', " */
-          /* "value ->> 'language', " */
-          /* "value ->> 'raw_url', " */
-          /* "value ->> 'size' " */
-          " from %s g, json_each(files) "
-          " order by g.created_at desc",
-          is_star ? "omg_starred_gist_view" : "omg_created_gist_view");
-
-#ifdef OMG_TEST
-  printf("query gists, sql:%s\n", sql);
-#endif
-  auto_sqlite3_stmt stmt = NULL;
-  int rc = sqlite3_prepare_v2(ctx->db, sql, strlen(sql), &stmt, NULL);
-  if (rc) {
+omg_error omg_export_changeset(omg_context ctx, int64_t since, int fd,
+                               int64_t *until) {
+  // a read transaction keeps rows consistent with `until`
+  if (sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL)) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
+  export_writer *w = malloc(sizeof(export_writer));
+  *w = (export_writer){.fd = fd};
+  int64_t position = 0;
+  omg_error err = write_changeset(ctx, since, w, &position);
+  sqlite3_exec(ctx->db, "commit", NULL, NULL, NULL);
+  export_flush(w);
+  int error = w->error;
+  free(w);
 
-  size_t rows_count = 0;
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    rows_count++;
+  if (!is_ok(err)) {
+    return err;
   }
-
-  omg_gist *gist_arr = malloc(sizeof(omg_gist) * rows_count);
-  sqlite3_reset(stmt);
-  size_t row = 0;
-  rc = 0;
-  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-    omg_gist gist = {
-        .id = strdup_when_not_null(sqlite3_column_text(stmt, 0)),
-        .created_at = strdup_when_not_null(sqlite3_column_text(stmt, 1)),
-        .description = strdup_when_not_null(sqlite3_column_text(stmt, 2)),
-        .file =
-            {
-                .filename = strdup_when_not_null(sqlite3_column_text(stmt, 3)),
-                .language = strdup_when_not_null(sqlite3_column_text(stmt, 4)),
-                .raw_url = strdup_when_not_null(sqlite3_column_text(stmt, 5)),
-                .size = sqlite3_column_int(stmt, 6),
-            },
-    };
-    gist_arr[row++] = gist;
+  if (error) {
+    return new_error(OMG_CODE_INTERNAL, strerror(error));
   }
-  if (rc != SQLITE_DONE) {
-    return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+  if (until) {
+    *until = position;
   }
-
-  *out = (omg_gist_list){.gist_array = gist_arr, .length = rows_count};
   return NO_ERROR;
 }
 
-omg_error omg_query_created_gists(omg_context ctx, omg_gist_list *out) {
-  return omg_query_gists_common(ctx, false, out);
+// `source` is empty for changesets written without one.
+static omg_error read_changeset_header(FILE *in, int64_t *until,
+                                       char source[CHANGESET_SOURCE_SIZE]) {
+  auto_string line = NULL;
+  size_t cap = 0;
+  if (getline(&line, &cap, in) < 0) {
+    return new_error(OMG_CODE_INTERNAL, "empty changeset");
+  }
+  json_error_t error;
+  json_auto_t *header = json_loads(line, 0, &error);
+  if (!header) {
+    return new_error(OMG_CODE_JSON, error.text);
+  }
+  const char *format = json_string_value(json_object_get(header, "format"));
+  if (!format || strcmp(format, CHANGESET_FORMAT) != 0 ||
+      json_integer_value(json_object_get(header, "version")) !=
+          CHANGESET_VERSION) {
+    return new_error(OMG_CODE_INTERNAL, "unsupported changeset");
+  }
+  *until = json_integer_value(json_object_get(header, "until"));
+  const char *from = json_string_value(json_object_get(header, "source"));
+  snprintf(source, CHANGESET_SOURCE_SIZE, "%s", from ? from : "");
+  return NO_ERROR;
 }
 
-omg_error omg_query_starred_gists(omg_context ctx, omg_gist_list *out) {
-  return omg_query_gists_common(ctx, true, out);
+static omg_error apply_changeset(omg_context ctx, FILE *in) {
+  sqlite3_stmt *upsert_stmts[CHANGESET_TABLE_COUNT] = {};
+  sqlite3_stmt *delete_stmts[CHANGESET_TABLE_COUNT] = {};
+  auto_string line = NULL;
+  size_t cap = 0;
+  ssize_t len = 0;
+  omg_error err = NO_ERROR;
+  while (is_ok(err) && (len = getline(&line, &cap, in)) >= 0) {
+    if (len == 0 || line[0] == '\n') {
+      continue;
+    }
+    json_error_t error;
+    json_auto_t *change = json_loadb(line, len, 0, &error);
+    if (!change) {
+      err = new_error(OMG_CODE_JSON, error.text);
+      break;
+    }
+    const char *tbl = json_string_value(json_object_get(change, "table"));
+    const char *op = json_string_value(json_object_get(change, "op"));
+    int table = changeset_table_index(tbl);
+    if (table < 0 || !op) {
+      err = new_error(OMG_CODE_INTERNAL, "invalid change");
+      break;
+    }
+
+    sqlite3_stmt *stmt = NULL;
+    if (strcmp(op, "upsert") == 0) {
+      err = changeset_stmt(ctx, upsert_stmts, table, changeset_upsert_sql,
+                           &stmt);
+    } else if (strcmp(op, "delete") == 0) {
+      err = changeset_stmt(ctx, delete_stmts, table, changeset_delete_sql,
+                           &stmt);
+    } else {
+      err = new_error(OMG_CODE_INTERNAL, "invalid change");
+    }
+    if (!is_ok(err)) {
+      break;
+    }
+    sqlite3_bind_text(stmt, 1, line, len, SQLITE_STATIC);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+      err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    }
+    sqlite3_reset(stmt);
+  }
+  finalize_changeset_stmts(upsert_stmts);
+  finalize_changeset_stmts(delete_stmts);
+  return err;
 }
 
-omg_error omg_delete_gist(omg_context ctx, char *gist_id) {
-  const char *sql = "delete from omg_created_gist where gist_id = ?";
+// Position of the last changeset imported from `source`, or 0.
+static omg_error imported_position(omg_context ctx, const char *source,
+                                   int64_t *out) {
+  const char *sql = "select coalesce((select value from omg_meta "
+                    "where key = 'changeset:' || ?1), 0)";
   auto_sqlite3_stmt stmt = NULL;
   if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
-  sqlite3_bind_text(stmt, 1, gist_id, -1, SQLITE_STATIC);
-
-  if (sqlite3_step(stmt) != SQLITE_DONE) {
+  sqlite3_bind_text(stmt, 1, source, -1, SQLITE_STATIC);
+  if (sqlite3_step(stmt) != SQLITE_ROW) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
-
-  char url[128];
-  sprintf(url, "%s/gists/%s", API_ROOT, gist_id);
-  return omg_request(ctx, DELETE_METHOD, url, NULL, NULL);
+  *out = sqlite3_column_int64(stmt, 0);
+  return NO_ERROR;
 }
 
-omg_error omg_unstar_gist(omg_context ctx, char *gist_id) {
-  const char *sql = "delete from omg_starred_gist where gist_id = ?";
+static omg_error save_imported_position(omg_context ctx, const char *source,
+                                        int64_t position) {
+  const char *sql = "insert or replace into omg_meta(key, value) "
+                    "values ('changeset:' || ?1, ?2)";
   auto_sqlite3_stmt stmt = NULL;
   if (sqlite3_prepare_v2(ctx->db, sql, -1, &stmt, NULL)) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
-
-  sqlite3_bind_text(stmt, 1, gist_id, -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 1, source, -1, SQLITE_STATIC);
+  sqlite3_bind_int64(stmt, 2, position);
   if (sqlite3_step(stmt) != SQLITE_DONE) {
     return new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
   }
+  return NO_ERROR;
+}
 
-  char url[128];
-  sprintf(url, "%s/gists/%s/star", API_ROOT, gist_id);
-  return omg_request(ctx, DELETE_METHOD, url, NULL, NULL);
+// A changeset not newer than the last one imported from its source would
+// bring rows back to an older state, so it's skipped.
+static omg_error import_changeset(omg_context ctx, FILE *in,
+                                  const char *source, int64_t position) {
+  if (!source[0]) {
+    return apply_changeset(ctx, in);
+  }
+  int64_t imported = 0;
+  omg_error err = imported_position(ctx, source, &imported);
+  if (!is_ok(err) || position <= imported) {
+    return err;
+  }
+  err = apply_changeset(ctx, in);
+  if (!is_ok(err)) {
+    return err;
+  }
+  return save_imported_position(ctx, source, position);
+}
+
+omg_error omg_import_changeset(omg_context ctx, int fd, int64_t *until) {
+  int in_fd = dup(fd);
+  FILE *in = in_fd < 0 ? NULL : fdopen(in_fd, "r");
+  if (!in) {
+    if (in_fd >= 0) {
+      close(in_fd);
+    }
+    return new_error(OMG_CODE_INTERNAL, strerror(errno));
+  }
+
+  int64_t position = 0;
+  char source[CHANGESET_SOURCE_SIZE];
+  omg_error err = read_changeset_header(in, &position, source);
+  if (is_ok(err)) {
+    if (sqlite3_exec(ctx->db, "begin", NULL, NULL, NULL)) {
+      err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+    } else {
+      err = import_changeset(ctx, in, source, position);
+      if (is_ok(err) && sqlite3_exec(ctx->db, "commit", NULL, NULL, NULL)) {
+        err = new_error(OMG_CODE_DB, sqlite3_errmsg(ctx->db));
+      }
+      if (!is_ok(err)) {
+        sqlite3_exec(ctx->db, "rollback", NULL, NULL, NULL);
+      }
+    }
+  }
+  fclose(in);
+
+  if (!is_ok(err)) {
+    return err;
+  }
+  invalidate_repo_snapshots(ctx);
+  if (until) {
+    *until = position;
+  }
+  return NO_ERROR;
 }
 
 omg_error omg_create_pull(omg_context ctx, const char *full_name,
@@ -33,31 +33,103 @@ typedef struct omg_context *omg_context;
 omg_error omg_setup_context(const char *path, const char *github_token,
                             int32_t timeout, omg_context *out);
 
+// Zero value of each field means default of SQLite.
+typedef struct {
+  const char *github_token;
+  int32_t timeout;
+  // only take effect on a new database
+  int32_t page_size;
+  // pages when positive, KiB when negative
+  int32_t cache_size;
+  int64_t mmap_size;
+  // default | file | memory
+  const char *temp_store;
+  // delete | truncate | persist | memory | wal | off
+  const char *journal_mode;
+  // off | normal | full | extra
+  const char *synchronous;
+  // Seconds between two `PRAGMA optimize` run after sync, 0 means one day,
+  // negative disables it.
+  int32_t optimize_interval;
+  // Seconds a cached trending page is fresh, 0 means one hour, negative
+  // disables the cache.
+  int32_t trending_ttl;
+} omg_setup_options;
+
+omg_error omg_setup_context_with_options(const char *path,
+                                         const omg_setup_options *opts,
+                                         omg_context *out);
+
 void omg_free_context(omg_context *ctx);
 #define omg_auto_context omg_context __attribute__((cleanup(omg_free_context)))
 
 // Internal usage.
 CURL *omg__curl_handler(omg_context);
 
+// Reclaim at most max_pages free pages, 0 means all.
+omg_error omg_vacuum(omg_context ctx, int32_t max_pages);
+
+// Return a shared immutable copy of `s`, owned by ctx and valid until
+// ctx is freed. Equal strings get the same pointer.
+const char *omg_intern(omg_context ctx, const char *s);
+
+// Sync progress
+// Reported once per page fetched by omg_sync_created_repos,
+// omg_sync_starred_repos, omg_sync_created_gists and omg_sync_starred_gists.
+typedef struct {
+  // "created repositories" | "starred repositories" | "created gists" |
+  // "starred gists"
+  const char *kind;
+  // pages fetched so far, starts from 1
+  int32_t page;
+  // pages left according to Link header of GitHub, -1 when unknown
+  int32_t remaining_pages;
+  // rows saved so far
+  int64_t rows;
+  // response bytes received so far
+  int64_t bytes;
+  // milliseconds since this sync started
+  int64_t elapsed_ms;
+} omg_sync_progress;
+
+// Called on the thread running sync, progress is only valid during the
+// callback.
+typedef void (*omg_sync_progress_fn)(const omg_sync_progress *progress,
+                                     void *userdata);
+
+// Set fn to NULL to stop reporting.
+void omg_set_sync_progress(omg_context ctx, omg_sync_progress_fn fn,
+                           void *userdata);
+
 typedef struct {
   int id;
   const char *full_name;
   const char *description;
   bool private;
   const char *created_at;
+  // interned by omg_intern, don't free it
   const char *license;
   const char *pushed_at;
   int stargazers_count;
   int watchers_count;
   int forks_count;
+  // interned by omg_intern, don't free it
   const char *lang;
   const char *homepage;
   int size;
+  // Only set on repositories fetched from GitHub, interned by omg_intern.
+  // Local queries filter topics by omg_repo_filter instead.
+  const char **topics;
+  size_t topic_length;
+  // Only set on trending repositories, stars gained in the trending range.
+  int recent_stars;
 } omg_repo;
 
 void omg_free_repo(omg_repo *repo);
 #define omg_auto_repo omg_repo __attribute__((cleanup(omg_free_repo)))
 
+// Strings of all repos live in one arena owned by the list, free the list
+// with omg_free_repo_list, never free its repos one by one.
 typedef struct {
   omg_repo *repo_array;
   size_t length;
@@ -83,6 +155,7 @@ void omg_free_starred_repo(omg_starred_repo *star);
 #define omg_auto_starred_repo                                                  \
   omg_starred_repo __attribute__((cleanup(omg_free_starred_repo)))
 
+// Arena-backed like omg_repo_list, use omg_free_starred_repo_list only.
 typedef struct {
   omg_starred_repo *star_array;
   size_t length;
@@ -98,6 +171,211 @@ omg_error omg_query_starred_repos(omg_context ctx, const char *keyword,
                                   omg_starred_repo_list *out);
 omg_error omg_unstar_repo(omg_context ctx, size_t repo_id);
 omg_error omg_star_repo(omg_context ctx, const char *repo_full_name);
+// Internal usage, one sync of starred repositories over a single page that
+// sweeps older rows only when `complete` is true.
+omg_error omg__sync_starred_page(omg_context ctx,
+                                 omg_starred_repo_list star_lst, bool complete);
+
+// Repository filter
+typedef enum {
+  OMG_SORT_DEFAULT = 0, // starred_at/created_at desc
+  OMG_SORT_STARS,       // stargazers_count desc
+  OMG_SORT_NAME,        // full_name asc, case-insensitive
+} omg_repo_sort;
+
+typedef struct {
+  // case-insensitive, match full_name or description
+  const char *keyword;
+  // case-insensitive, exact match
+  const char *language;
+  // NULL-terminated, case-insensitive, rows must have all of `topics` and
+  // none of `excluded_topics`, both may be NULL
+  const char *const *topics;
+  const char *const *excluded_topics;
+  omg_repo_sort sort;
+} omg_repo_filter;
+
+// Repository snapshot
+// An in-memory, column-oriented copy of starred/created repositories, built
+// lazily on first filter and rebuilt by the next filter after repositories
+// changed, also when changed by another process.
+// Used for keystroke-level filtering without touching SQLite.
+typedef struct {
+  int id;
+  // borrowed from snapshot, valid until it is rebuilt
+  const char *full_name;
+  const char *description;
+  const char *lang;
+  int stargazers_count;
+  int forks_count;
+  int size;
+  /* starred_at for stars, created_at for created repos, unix seconds */
+  int64_t time;
+} omg_snapshot_repo;
+
+typedef struct {
+  uint32_t *row_array;
+  size_t length;
+} omg_snapshot_hits;
+
+void omg_free_snapshot_hits(omg_snapshot_hits *);
+#define omg_auto_snapshot_hits                                                 \
+  omg_snapshot_hits __attribute__((cleanup(omg_free_snapshot_hits)))
+
+omg_error omg_filter_repo_snapshot(omg_context ctx, bool is_star,
+                                   const omg_repo_filter *filter,
+                                   omg_snapshot_hits *out);
+omg_error omg_get_snapshot_repo(omg_context ctx, bool is_star, uint32_t row,
+                                omg_snapshot_repo *out);
+
+// Topics
+typedef struct {
+  const char *name;
+  // repositories tagged with it
+  int count;
+} omg_topic;
+
+// Arena-backed like omg_repo_list, use omg_free_topic_list only.
+typedef struct {
+  omg_topic *topic_array;
+  size_t length;
+} omg_topic_list;
+
+void omg_free_topic_list(omg_topic_list *);
+#define omg_auto_topic_list                                                    \
+  omg_topic_list __attribute__((cleanup(omg_free_topic_list)))
+
+// Topics of starred/created repositories, most used first, served from
+// snapshot like omg_filter_repo_snapshot.
+omg_error omg_query_topics(omg_context ctx, bool is_star,
+                           omg_topic_list *out);
+
+// Facets
+typedef enum {
+  OMG_FACET_LANG = 0,
+  OMG_FACET_LICENSE,
+  // value is "private" or "public"
+  OMG_FACET_PRIVATE,
+} omg_facet_kind;
+
+typedef struct {
+  omg_facet_kind kind;
+  // NULL for repositories without language/license
+  const char *value;
+  int count;
+} omg_facet;
+
+// Arena-backed like omg_repo_list, use omg_free_facet_list only.
+typedef struct {
+  omg_facet *facet_array;
+  size_t length;
+} omg_facet_list;
+
+void omg_free_facet_list(omg_facet_list *);
+#define omg_auto_facet_list                                                    \
+  omg_facet_list __attribute__((cleanup(omg_free_facet_list)))
+
+// Counts of starred/created repositories per language, license and
+// visibility, grouped by kind, most common first. Without a filter they are
+// read from counts maintained on save, otherwise counted over matching rows.
+omg_error omg_query_facets(omg_context ctx, bool is_star,
+                           const omg_repo_filter *filter,
+                           omg_facet_list *out);
+
+// Visitors
+// Invoked once per row, return false to stop.
+// Strings are borrowed from the SQLite row, only valid during the callback.
+typedef bool (*omg_repo_visitor)(const omg_repo *repo, void *userdata);
+typedef bool (*omg_starred_repo_visitor)(const omg_starred_repo *star,
+                                         void *userdata);
+
+// filter may be NULL
+omg_error omg_query_created_repos_each(omg_context ctx,
+                                       const omg_repo_filter *filter,
+                                       omg_repo_visitor visitor,
+                                       void *userdata);
+omg_error omg_query_starred_repos_each(omg_context ctx,
+                                       const omg_repo_filter *filter,
+                                       omg_starred_repo_visitor visitor,
+                                       void *userdata);
+
+// Star history
+// Star/fork counts are recorded by day whenever they change during sync,
+// old records are thinned out to keep the history small.
+typedef struct {
+  int repo_id;
+  const char *full_name;
+  int stargazers_count;
+  // changes since `days` ago
+  int star_delta;
+  int fork_delta;
+} omg_repo_growth;
+
+void omg_free_repo_growth(omg_repo_growth *growth);
+#define omg_auto_repo_growth                                                   \
+  omg_repo_growth __attribute__((cleanup(omg_free_repo_growth)))
+
+// Arena-backed like omg_repo_list, use omg_free_repo_growth_list only.
+typedef struct {
+  omg_repo_growth *growth_array;
+  size_t length;
+} omg_repo_growth_list;
+
+void omg_free_repo_growth_list(omg_repo_growth_list *);
+#define omg_auto_repo_growth_list                                              \
+  omg_repo_growth_list __attribute__((cleanup(omg_free_repo_growth_list)))
+
+omg_error omg_query_repo_growth(omg_context ctx, int repo_id, int days,
+                                omg_repo_growth *out);
+// Repositories with the most stars gained in the last `days`.
+omg_error omg_query_top_risers(omg_context ctx, int days, int limit,
+                               omg_repo_growth_list *out);
+// Internal usage, save repositories as a sync does.
+omg_error omg__save_repos(omg_context ctx, omg_repo_list repo_lst);
+
+// README
+// READMEs of starred repositories are cached compressed and indexed for
+// full-text search. Only repositories pushed since last fetch are requested,
+// with their ETag, so a refresh is cheap.
+typedef struct {
+  // repositories pushed since last fetch
+  int32_t checked;
+  int32_t updated;
+  // unchanged according to ETag
+  int32_t not_modified;
+  // repositories without README
+  int32_t missing;
+  int32_t failed;
+} omg_readme_sync_stats;
+
+// concurrency <= 0 means 8 requests in flight, out may be NULL.
+omg_error omg_sync_readmes(omg_context ctx, int32_t concurrency,
+                           omg_readme_sync_stats *out);
+
+// Zero value of each field means default.
+typedef struct {
+  // around each matched term, default to "[" and "]"
+  const char *open;
+  const char *close;
+  // max tokens of a snippet, default to 16
+  int32_t snippet_tokens;
+  // max rows, default to no limit
+  int32_t limit;
+} omg_readme_marks;
+
+// Strings are borrowed like other visitors.
+typedef bool (*omg_readme_visitor)(const omg_starred_repo *star,
+                                   const char *snippet, void *userdata);
+
+// Words of query are matched as a whole, `word*` matches a prefix. Best
+// matches come first, marks may be NULL.
+omg_error omg_search_readmes_each(omg_context ctx, const char *query,
+                                  const omg_readme_marks *marks,
+                                  omg_readme_visitor visitor, void *userdata);
+// Whole README, with matched terms of query highlighted when query is not
+// NULL. out is NULL when there is no README(or no match), free it with free.
+omg_error omg_query_readme(omg_context ctx, int repo_id, const char *query,
+                           const omg_readme_marks *marks, char **out);
 
 // Users
 typedef struct omg_user {
@@ -139,6 +417,7 @@ void omg_free_commit(omg_commit *commit);
 #define omg_auto_repo_commit                                                   \
   omg_repo_commit __attribute__((cleanup(omg_free_commit)))
 
+// Arena-backed like omg_repo_list, use omg_free_commit_list only.
 typedef struct {
   omg_commit *commit_array;
   size_t length;
@@ -148,6 +427,15 @@ void omg_free_commit_list(omg_commit_list *);
 #define omg_auto_commit_list                                                   \
   omg_commit_list __attribute__((cleanup(omg_free_commit_list)))
 
+// Commits are cached per repository. A refresh only fetches commits newer
+// than the newest cached one, pages of a larger limit are fetched
+// concurrently, 100 commits per page.
+omg_error omg_refresh_commits(omg_context ctx, const char *full_name,
+                              int limit);
+// Latest `limit` cached commits, without network, empty when never fetched.
+omg_error omg_query_cached_commits(omg_context ctx, const char *full_name,
+                                   int limit, omg_commit_list *out);
+// Refresh then query cached commits.
 omg_error omg_query_commits(omg_context, const char *full_name, int limit,
                             omg_commit_list *);
 
@@ -167,6 +455,7 @@ void omg_free_release_asset(omg_release_asset *release_asset);
 // Releases
 typedef struct {
   int id;
+  char *full_name;
   char *name;
   char *login;
   char *tag_name;
@@ -182,6 +471,7 @@ void omg_free_release(omg_release *release);
 #define omg_auto_repo_release                                                  \
   omg_repo_release __attribute__((cleanup(omg_free_release)))
 
+// Arena-backed, assets included, use omg_free_release_list only.
 typedef struct {
   omg_release *release_array;
   size_t length;
@@ -191,13 +481,116 @@ void omg_free_release_list(omg_release_list *);
 #define omg_auto_release_list                                                  \
   omg_release_list __attribute__((cleanup(omg_free_release_list)))
 
+// Releases are cached per repository. A refresh sends the ETag of last fetch,
+// unchanged repositories answer 304, which doesn't count against rate limit.
+// Repositories are fetched concurrently, latest `limit`(max 100) releases of
+// each. A failed repository doesn't stop the rest, first error is returned.
+omg_error omg_refresh_releases(omg_context ctx, const char *const *full_names,
+                               size_t length, int limit);
+// Refresh releases of all starred repositories.
+omg_error omg_refresh_starred_releases(omg_context ctx, int limit);
+// Latest `limit` cached releases, without network, empty when never fetched.
+omg_error omg_query_cached_releases(omg_context ctx, const char *full_name,
+                                    int limit, omg_release_list *out);
+// Cached releases of all repositories published after `since`(ISO 8601),
+// newest first, drafts excluded.
+omg_error omg_query_releases_since(omg_context ctx, const char *since,
+                                   int limit, omg_release_list *out);
+// Refresh then query cached releases.
 omg_error omg_query_releases(omg_context, const char *full_name, int limit,
                              omg_release_list *);
 
 // Trending
+// Pages are cached in database for `trending_ttl` seconds. A stale page is
+// refetched, or served when GitHub rejects the request. After a 429 no
+// request is sent until the time GitHub asks to wait has passed.
 omg_error omg_query_trending(omg_context, const char *spoken_lang,
                              const char *lang, const char *since,
                              omg_repo_list *);
+// Cached page regardless of its age, without network, empty when never
+// fetched. `fresh`(nullable) tells whether it's within `trending_ttl`.
+omg_error omg_query_cached_trending(omg_context ctx, const char *spoken_lang,
+                                    const char *lang, const char *since,
+                                    omg_repo_list *out, bool *fresh);
+// Fetch a page and replace its cache.
+omg_error omg_refresh_trending(omg_context ctx, const char *spoken_lang,
+                               const char *lang, const char *since);
+
+typedef struct {
+  // nullable
+  const char *spoken_lang;
+  // nullable, any language when NULL
+  const char *lang;
+  const char *since;
+} omg_trending_source;
+
+typedef struct {
+  omg_repo repo;
+  // ranks[i] is 1-based rank on page of sources[i], 0 when absent.
+  int *ranks;
+} omg_trending_repo;
+
+// Arena-backed like omg_repo_list, use omg_free_trending_list only.
+typedef struct {
+  omg_trending_repo *repo_array;
+  size_t length;
+} omg_trending_list;
+
+void omg_free_trending_list(omg_trending_list *);
+#define omg_auto_trending_list                                                 \
+  omg_trending_list __attribute__((cleanup(omg_free_trending_list)))
+
+// Query pages of several sources at once, stale ones are fetched
+// concurrently. Repositories are merged round-robin by rank and deduplicated
+// by full_name. Pages that can't be fetched are served from cache or left
+// out, an error is returned only when nothing can be shown.
+omg_error omg_query_trendings(omg_context ctx,
+                              const omg_trending_source *sources,
+                              size_t length, omg_trending_list *out);
+
+// Trending history
+// Every fetched page is recorded as the page of that day unless the trending
+// cache is disabled, history is kept for two years.
+typedef struct {
+  char *full_name;
+  // days on the page
+  int days;
+  // most consecutive days on the page
+  int longest_streak;
+  // consecutive days on the page up to the latest recorded day, 0 when it's
+  // not on that day's page
+  int current_streak;
+  // 1-based
+  int best_rank;
+  // YYYY-MM-DD
+  char *first_seen;
+  char *last_seen;
+  // sum of stars gained shown on each day, which adds up to stars gained
+  // during these days for the daily range
+  int stars_gained;
+} omg_trending_streak;
+
+// Arena-backed like omg_repo_list, use omg_free_trending_streak_list only.
+typedef struct {
+  omg_trending_streak *streak_array;
+  size_t length;
+} omg_trending_streak_list;
+
+void omg_free_trending_streak_list(omg_trending_streak_list *);
+#define omg_auto_trending_streak_list                                          \
+  omg_trending_streak_list                                                     \
+      __attribute__((cleanup(omg_free_trending_streak_list)))
+
+// Repositories on the page in the last `days` days, without network. Most
+// days first, then current streak and stars gained. limit <= 0 means all.
+omg_error omg_query_trending_streaks(omg_context ctx, const char *spoken_lang,
+                                     const char *lang, const char *since,
+                                     int days, int limit,
+                                     omg_trending_streak_list *out);
+// Internal usage, parse a saved trending page. The scanner falls back to
+// regex when it doesn't understand the markup, `regex` forces the fallback.
+omg_error omg__parse_trending(omg_context ctx, const char *html, size_t len,
+                              bool regex, omg_repo_list *out);
 
 // Gists
 
@@ -213,13 +606,16 @@ typedef struct {
   char *created_at;
   char *description;
   bool public;
-  char *_files_as_json; // private, use file instead
+  // private, all files of the gist when fetched from GitHub, use file instead
+  omg_gist_file *_file_array;
+  size_t _file_length;
   omg_gist_file file;
 } omg_gist;
 
 void omg_free_gist(omg_gist *);
 #define omg_auto_gist omg_gist __attribute__((cleanup(omg_free_gist)))
 
+// Arena-backed like omg_repo_list, use omg_free_gist_list only.
 typedef struct {
   omg_gist *gist_array;
   size_t length;
@@ -229,12 +625,63 @@ void omg_free_gist_list(omg_gist_list *);
 #define omg_auto_gist_list                                                     \
   omg_gist_list __attribute__((cleanup(omg_free_gist_list)))
 
+// Strings are borrowed from the SQLite row, only valid during the callback.
+// Return false to stop.
+typedef bool (*omg_gist_visitor)(const omg_gist *gist, void *userdata);
+
+typedef struct {
+  // case-insensitive, exact match
+  const char *language;
+  // case-insensitive, prefix match
+  const char *filename;
+  // case-insensitive, match description or filename
+  const char *keyword;
+  // OMG_SORT_NAME sorts by filename, others by created_at desc
+  omg_repo_sort sort;
+} omg_gist_filter;
+
 omg_error omg_sync_created_gists(omg_context ctx);
 omg_error omg_sync_starred_gists(omg_context ctx);
 omg_error omg_query_created_gists(omg_context ctx, omg_gist_list *out);
 omg_error omg_query_starred_gists(omg_context ctx, omg_gist_list *out);
+// One row per file of each gist, filter may be NULL
+omg_error omg_query_gists_each(omg_context ctx, bool is_star,
+                               const omg_gist_filter *filter,
+                               omg_gist_visitor visitor, void *userdata);
 omg_error omg_delete_gist(omg_context ctx, char *gist_id);
 omg_error omg_unstar_gist(omg_context ctx, char *gist_id);
+// Internal usage, save gists with their files as a sync does.
+omg_error omg__save_gists(omg_context ctx, bool is_star, omg_gist_list lst);
+
+// Export
+typedef enum {
+  OMG_EXPORT_CREATED_REPOS,
+  OMG_EXPORT_STARRED_REPOS,
+  // one row per file of each gist
+  OMG_EXPORT_CREATED_GISTS,
+  OMG_EXPORT_STARRED_GISTS,
+} omg_export_kind;
+
+typedef enum {
+  // one JSON object per line
+  OMG_FORMAT_JSONL,
+  // with a header line, RFC 4180
+  OMG_FORMAT_CSV,
+} omg_export_format;
+
+// Stream rows of local database to fd, fd is not closed.
+omg_error omg_export(omg_context ctx, omg_export_kind kind,
+                     omg_export_format format, int fd);
+
+// Changesets are JSON lines of rows upserted or deleted after the change log
+// position `since`(0 for everything), `until` is the position to pass as
+// `since` next time.
+omg_error omg_export_changeset(omg_context ctx, int64_t since, int fd,
+                               int64_t *until);
+// Apply a changeset in one transaction, applying it again is a no-op, and so
+// is a changeset older than the last one imported from the same database.
+// `until` is the position recorded in the changeset, may be NULL.
+omg_error omg_import_changeset(omg_context ctx, int fd, int64_t *until);
 
 // Pull requests
 typedef struct {
@@ -1,11 +1,13 @@
 #include "../core/omg.h"
 #include "emacs-module.h"
 #include <pthread.h>
+#include <inttypes.h>
 #include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 int plugin_is_GPL_compatible;
@@ -14,6 +16,17 @@ typedef struct emacs_runtime *runtime;
 
 emacs_value Qt;
 emacs_value Qnil;
+// Symbols used when building rows, interned once in emacs_module_init
+static emacs_value Qcons;
+static emacs_value Qlist;
+static emacs_value Qvector;
+static emacs_value Qmake_vector;
+static emacs_value Qface;
+static emacs_value Qhelp_echo;
+static emacs_value Qraw_url;
+static emacs_value Qlanguage;
+static emacs_value Qformat_time_string;
+static emacs_value Qparse_iso8601_time_string;
 /* Core interface used for invoking C API */
 omg_context ctx = NULL;
 const char *FEATURE_NAME = "omg-dyn";
@@ -51,17 +64,19 @@ const char *PIPE_EOF = "\n\n";
     _env_->funcall(_env_, env->intern(env, (fn_name)), _nargs_, _args_);       \
   })
 
-#define lisp_text_button(env, label, ...)                                      \
+// Like lisp_funcall, but fn is a symbol interned in emacs_module_init
+#define lisp_call(env, fn, ...)                                                \
   ({                                                                           \
-    lisp_funcall(env, "cons", label,                                           \
-                 lisp_funcall(env, "list", lisp_symbol(env, "face"), Qnil,     \
-                              __VA_ARGS__));                                   \
+    emacs_env *_env_ = env;                                                    \
+    emacs_value _args_[] = {__VA_ARGS__};                                      \
+    int _nargs_ = sizeof(_args_) / sizeof(emacs_value);                        \
+    _env_->funcall(_env_, (fn), _nargs_, _args_);                              \
   })
 
-#define lisp_integer(env, integer)                                             \
+#define lisp_text_button(env, label, ...)                                      \
   ({                                                                           \
-    emacs_env *_env_ = env;                                                    \
-    _env_->make_integer(_env_, (integer));                                     \
+    lisp_call(env, Qcons, label,                                               \
+              lisp_call(env, Qlist, Qface, Qnil, __VA_ARGS__));                \
   })
 
 #define ENSURE_SETUP(env)                                                      \
@@ -96,6 +111,10 @@ static char *get_string(emacs_env *env, emacs_value symbol) {
   return NULL;
 }
 
+static int64_t integer_or_zero(emacs_env *env, emacs_value v) {
+  return env->is_not_nil(env, v) ? env->extract_integer(env, v) : 0;
+}
+
 static char *string_or_empty(const char *s) {
   if (s) {
     return (char *)s;
@@ -117,6 +136,22 @@ static char *human_size(int size) {
   return buf;
 }
 
+static emacs_value lisp_number_string(emacs_env *env, int64_t n) {
+  char buf[24];
+  int len = snprintf(buf, sizeof(buf), "%" PRId64, n);
+  return env->make_string(env, buf, len);
+}
+
+static emacs_value lisp_make_vector(emacs_env *env, size_t len) {
+  return lisp_call(env, Qmake_vector, lisp_integer(env, len), Qnil);
+}
+
+// A row of tabulated-list-entries, (ID [CELLS...])
+static emacs_value lisp_row(emacs_env *env, emacs_value id, emacs_value *cells,
+                            size_t len) {
+  return lisp_call(env, Qlist, id, env->funcall(env, Qvector, len, cells));
+}
+
 static void write_pipe(int pipe, const char *msg, size_t msglen) {
   /* https://pubs.opengroup.org/onlinepubs/7908799/xsh/write.html */
   if (write(pipe, msg, msglen) == -1) {
@@ -126,20 +161,16 @@ static void write_pipe(int pipe, const char *msg, size_t msglen) {
 
 static emacs_value omg_dyn_emacs_button(emacs_env *env, const char *label,
                                         const char *help_echo) {
-  return lisp_funcall(env, "cons", lisp_string(env, label),
-                      lisp_funcall(env, "list",
-                                   // display as plain text
-                                   lisp_symbol(env, "face"), Qnil,
-                                   // echo full digits
-                                   lisp_symbol(env, "help-echo"),
-                                   lisp_string(env, help_echo)));
+  return lisp_call(env, Qcons, lisp_string(env, label),
+                   lisp_call(env, Qlist,
+                             // display as plain text
+                             Qface, Qnil,
+                             // echo full digits
+                             Qhelp_echo, lisp_string(env, help_echo)));
 }
 
 static emacs_value omg_dyn_query_common(emacs_env *env, const char *repo_time,
                                         bool is_star, omg_repo repo) {
-  char repo_id[64];
-  sprintf(repo_id, "%d", repo.id);
-
   char help_echo[512];
   omg_auto_char readable_size = human_size(repo.size);
   sprintf(help_echo, "%s\n\nLanguage:%s\nStars:%d\nForks:%d\nSize:%s\n%s:%s",
@@ -147,12 +178,69 @@ static emacs_value omg_dyn_query_common(emacs_env *env, const char *repo_time,
           readable_size, is_star ? "StarredAt" : "CreatedAt", repo_time);
   emacs_value name_button =
       omg_dyn_emacs_button(env, (char *)repo.full_name, help_echo);
-  emacs_value row = lisp_funcall(
-      env, "list", lisp_string(env, repo_id),
-      lisp_funcall(env, "vector", name_button,
-                   lisp_string(env, string_or_empty(repo.lang)),
-                   lisp_string(env, string_or_empty(repo.description)), ));
-  return row;
+  emacs_value cells[] = {
+      name_button,
+      lisp_string(env, string_or_empty(repo.lang)),
+      lisp_string(env, string_or_empty(repo.description)),
+  };
+  return lisp_row(env, lisp_number_string(env, repo.id), cells, 3);
+}
+
+// Rows are collected while visiting, then written into a vector once
+// visiting is done. Local values stay valid until the module function returns.
+typedef struct {
+  emacs_env *env;
+  emacs_value *rows;
+  size_t length;
+  size_t capacity;
+} row_collector;
+
+static void free_row_collector(row_collector *collector) {
+  free(collector->rows);
+}
+
+static emacs_value row_collector_vector(row_collector *collector) {
+  emacs_env *env = collector->env;
+  emacs_value vector = lisp_make_vector(env, collector->length);
+  for (size_t i = 0; i < collector->length; i++) {
+    env->vec_set(env, vector, i, collector->rows[i]);
+  }
+  return vector;
+}
+
+static bool row_collector_push(row_collector *collector, emacs_value row) {
+  emacs_env *env = collector->env;
+  if (env->non_local_exit_check(env) != emacs_funcall_exit_return) {
+    return false;
+  }
+  if (collector->length == collector->capacity) {
+    size_t capacity = collector->capacity ? collector->capacity * 2 : 64;
+    emacs_value *rows =
+        realloc(collector->rows, capacity * sizeof(emacs_value));
+    if (!rows) {
+      return false;
+    }
+    collector->rows = rows;
+    collector->capacity = capacity;
+  }
+  collector->rows[collector->length++] = row;
+  return true;
+}
+
+static bool omg_dyn_created_repo_visitor(const omg_repo *repo,
+                                         void *userdata) {
+  row_collector *collector = userdata;
+  return row_collector_push(
+      collector,
+      omg_dyn_query_common(collector->env, repo->created_at, false, *repo));
+}
+
+static bool omg_dyn_starred_repo_visitor(const omg_starred_repo *star,
+                                         void *userdata) {
+  row_collector *collector = userdata;
+  return row_collector_push(
+      collector,
+      omg_dyn_query_common(collector->env, star->starred_at, true, star->repo));
 }
 
 emacs_value omg_dyn_query_created_repos(emacs_env *env, ptrdiff_t nargs,
@@ -168,20 +256,17 @@ emacs_value omg_dyn_query_created_repos(emacs_env *env, ptrdiff_t nargs,
   }
 
   ENSURE_NONLOCAL_EXIT(env);
-  omg_auto_repo_list repo_lst = {};
-  omg_error err = omg_query_created_repos(ctx, keyword, lang, &repo_lst);
+  omg_repo_filter filter = {.keyword = keyword, .language = lang};
+  row_collector collector __attribute__((cleanup(free_row_collector))) = {
+      .env = env};
+  omg_error err = omg_query_created_repos_each(
+      ctx, &filter, omg_dyn_created_repo_visitor, &collector);
   if (!is_ok(err)) {
     return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
   }
-  emacs_value repo_vector = lisp_funcall(
-      env, "make-vector", lisp_integer(env, repo_lst.length), Qnil);
-  for (size_t i = 0; i < repo_lst.length; i++) {
-    omg_repo repo = repo_lst.repo_array[i];
-    emacs_value row = omg_dyn_query_common(env, repo.created_at, false, repo);
-    lisp_funcall(env, "aset", repo_vector, lisp_integer(env, i), row);
-  }
 
-  return repo_vector;
+  ENSURE_NONLOCAL_EXIT(env);
+  return row_collector_vector(&collector);
 }
 
 emacs_value omg_dyn_query_starred_repos(emacs_env *env, ptrdiff_t nargs,
@@ -198,64 +283,295 @@ emacs_value omg_dyn_query_starred_repos(emacs_env *env, ptrdiff_t nargs,
 
   ENSURE_NONLOCAL_EXIT(env);
 
-  omg_auto_starred_repo_list star_lst = {};
-  omg_error err = omg_query_starred_repos(ctx, keyword, lang, &star_lst);
+  omg_repo_filter filter = {.keyword = keyword, .language = lang};
+  row_collector collector __attribute__((cleanup(free_row_collector))) = {
+      .env = env};
+  omg_error err = omg_query_starred_repos_each(
+      ctx, &filter, omg_dyn_starred_repo_visitor, &collector);
   if (!is_ok(err)) {
     return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
   }
 
   ENSURE_NONLOCAL_EXIT(env);
+  return row_collector_vector(&collector);
+}
 
-  emacs_value star_vector = lisp_funcall(
-      env, "make-vector", lisp_integer(env, star_lst.length), Qnil);
-  for (size_t i = 0; i < star_lst.length; i++) {
-    omg_repo repo = star_lst.star_array[i].repo;
-    emacs_value row = omg_dyn_query_common(
-        env, star_lst.star_array[i].starred_at, true, repo);
-    lisp_funcall(env, "aset", star_vector, lisp_integer(env, i), row);
+// Topics of filter, a topic prefixed with "-" is excluded. Both arrays are
+// NULL-terminated and point into strings.
+typedef struct {
+  char **strings;
+  size_t length;
+  const char **included;
+  const char **excluded;
+} topic_args;
+
+static void free_topic_args(topic_args *args) {
+  for (size_t i = 0; i < args->length; i++) {
+    free(args->strings[i]);
   }
+  free(args->strings);
+  free(args->included);
+  free(args->excluded);
+}
 
-  return star_vector;
+static topic_args get_topic_args(emacs_env *env, emacs_value lst) {
+  size_t len = env->extract_integer(env, lisp_funcall(env, "length", lst));
+  topic_args args = {
+      .strings = calloc(len + 1, sizeof(char *)),
+      .included = calloc(len + 1, sizeof(char *)),
+      .excluded = calloc(len + 1, sizeof(char *)),
+  };
+  size_t included = 0;
+  size_t excluded = 0;
+  for (size_t i = 0; i < len; i++) {
+    char *topic = get_string(
+        env, lisp_funcall(env, "nth", lisp_integer(env, i), lst));
+    if (!topic || !topic[0]) {
+      free(topic);
+      continue;
+    }
+    args.strings[args.length++] = topic;
+    if (topic[0] == '-') {
+      if (topic[1]) {
+        args.excluded[excluded++] = topic + 1;
+      }
+    } else {
+      args.included[included++] = topic;
+    }
+  }
+  return args;
 }
 
-static emacs_value omg_dyn_query_gists_common(emacs_env *env, bool is_star) {
+// Rows of hits in [offset, end) as a vector
+static emacs_value snapshot_vector(emacs_env *env, bool is_star,
+                                   omg_snapshot_hits hits, size_t offset,
+                                   size_t end) {
+  emacs_value repo_vector = lisp_make_vector(env, end - offset);
+  for (size_t i = offset; i < end; i++) {
+    omg_snapshot_repo snap = {};
+    omg_error err =
+        omg_get_snapshot_repo(ctx, is_star, hits.row_array[i], &snap);
+    if (!is_ok(err)) {
+      return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+    }
+    // same format with datetime(xx, 'localtime') in SQLite
+    char repo_time[32];
+    time_t t = snap.time;
+    struct tm tm_info;
+    strftime(repo_time, sizeof(repo_time), "%Y-%m-%d %H:%M:%S",
+             localtime_r(&t, &tm_info));
+    omg_repo repo = {
+        .id = snap.id,
+        .full_name = snap.full_name,
+        .description = snap.description,
+        .lang = snap.lang,
+        .stargazers_count = snap.stargazers_count,
+        .forks_count = snap.forks_count,
+        .size = snap.size,
+    };
+    env->vec_set(env, repo_vector, i - offset,
+                 omg_dyn_query_common(env, repo_time, is_star, repo));
+  }
+
+  return repo_vector;
+}
+
+emacs_value omg_dyn_filter_repos(emacs_env *env, ptrdiff_t nargs,
+                                 emacs_value *args, void *data) {
   ENSURE_SETUP(env);
+  bool is_star = env->is_not_nil(env, args[0]);
+  omg_auto_char keyword = NULL;
+  omg_auto_char lang = NULL;
+  topic_args topics __attribute__((cleanup(free_topic_args))) = {};
+  if (nargs > 1) {
+    keyword = get_string(env, args[1]);
+    if (nargs > 2) {
+      lang = get_string(env, args[2]);
+      if (nargs > 3) {
+        topics = get_topic_args(env, args[3]);
+      }
+    }
+  }
 
-  omg_auto_gist_list star_lst = {};
-  omg_error err = {};
-  if (is_star) {
-    err = omg_query_starred_gists(ctx, &star_lst);
-  } else {
-    err = omg_query_created_gists(ctx, &star_lst);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_repo_filter filter = {.keyword = keyword,
+                            .language = lang,
+                            .topics = topics.included,
+                            .excluded_topics = topics.excluded};
+  omg_auto_snapshot_hits hits = {};
+  omg_error err = omg_filter_repo_snapshot(ctx, is_star, &filter, &hits);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
   }
+
+  return snapshot_vector(env, is_star, hits, 0, hits.length);
+}
+
+// Like omg_dyn_filter_repos, but only rows in [OFFSET, OFFSET + LIMIT) of
+// matched ones are converted, return (TOTAL . ROWS). Filter is rerun on each
+// call, which takes a few milliseconds even for tens of thousands of rows.
+emacs_value omg_dyn_filter_repos_window(emacs_env *env, ptrdiff_t nargs,
+                                        emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  bool is_star = env->is_not_nil(env, args[0]);
+  int64_t offset = env->extract_integer(env, args[1]);
+  int64_t limit = env->extract_integer(env, args[2]);
+  omg_auto_char keyword = NULL;
+  omg_auto_char lang = NULL;
+  topic_args topics __attribute__((cleanup(free_topic_args))) = {};
+  omg_repo_sort sort = OMG_SORT_DEFAULT;
+  if (nargs > 3) {
+    keyword = get_string(env, args[3]);
+    if (nargs > 4) {
+      lang = get_string(env, args[4]);
+      if (nargs > 5) {
+        topics = get_topic_args(env, args[5]);
+        if (nargs > 6) {
+          if (env->eq(env, args[6], lisp_symbol(env, "stars"))) {
+            sort = OMG_SORT_STARS;
+          } else if (env->eq(env, args[6], lisp_symbol(env, "name"))) {
+            sort = OMG_SORT_NAME;
+          }
+        }
+      }
+    }
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_repo_filter filter = {.keyword = keyword,
+                            .language = lang,
+                            .topics = topics.included,
+                            .excluded_topics = topics.excluded,
+                            .sort = sort};
+  omg_auto_snapshot_hits hits = {};
+  omg_error err = omg_filter_repo_snapshot(ctx, is_star, &filter, &hits);
   if (!is_ok(err)) {
     return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
   }
 
+  size_t begin = offset < 0 ? 0 : (size_t)offset;
+  if (begin > hits.length) {
+    begin = hits.length;
+  }
+  size_t end = hits.length;
+  if (limit >= 0 && (size_t)limit < end - begin) {
+    end = begin + limit;
+  }
+  emacs_value rows = snapshot_vector(env, is_star, hits, begin, end);
   ENSURE_NONLOCAL_EXIT(env);
+  return lisp_call(env, Qcons, lisp_integer(env, hits.length), rows);
+}
 
-  emacs_value gist_vector = lisp_funcall(
-      env, "make-vector", lisp_integer(env, star_lst.length), Qnil);
-  for (size_t i = 0; i < star_lst.length; i++) {
-    omg_gist gist = star_lst.gist_array[i];
-    omg_auto_char readable_size = human_size(gist.file.size);
-    emacs_value file_button = lisp_funcall(
-        env, "cons", lisp_string(env, gist.file.filename),
-        lisp_funcall(
-            env, "list", lisp_symbol(env, "face"), Qnil,
-            lisp_symbol(env, "raw-url"), lisp_string(env, gist.file.raw_url),
-            lisp_symbol(env, "language"), lisp_string(env, gist.file.language),
-            lisp_symbol(env, "help-echo"), lisp_string(env, readable_size)));
+emacs_value omg_dyn_query_topics(emacs_env *env, ptrdiff_t nargs,
+                                 emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  bool is_star = env->is_not_nil(env, args[0]);
+  omg_auto_topic_list topics = {};
+  omg_error err = omg_query_topics(ctx, is_star, &topics);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
 
-    emacs_value row = lisp_funcall(
-        env, "list", lisp_string(env, gist.id),
-        lisp_funcall(env, "vector", lisp_string(env, gist.created_at),
-                     file_button,
-                     lisp_string(env, string_or_empty(gist.description)), ));
-    lisp_funcall(env, "aset", gist_vector, lisp_integer(env, i), row);
+  emacs_value lst = Qnil;
+  for (size_t i = topics.length; i > 0; i--) {
+    omg_topic topic = topics.topic_array[i - 1];
+    lst = lisp_funcall(env, "cons",
+                       lisp_funcall(env, "cons", lisp_string(env, topic.name),
+                                    lisp_integer(env, topic.count)),
+                       lst);
   }
+  return lst;
+}
 
-  return gist_vector;
+emacs_value omg_dyn_query_facets(emacs_env *env, ptrdiff_t nargs,
+                                 emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  bool is_star = env->is_not_nil(env, args[0]);
+  omg_auto_char keyword = NULL;
+  omg_auto_char lang = NULL;
+  topic_args topics __attribute__((cleanup(free_topic_args))) = {};
+  if (nargs > 1) {
+    keyword = get_string(env, args[1]);
+    if (nargs > 2) {
+      lang = get_string(env, args[2]);
+      if (nargs > 3) {
+        topics = get_topic_args(env, args[3]);
+      }
+    }
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_repo_filter filter = {.keyword = keyword,
+                            .language = lang,
+                            .topics = topics.included,
+                            .excluded_topics = topics.excluded};
+  omg_auto_facet_list facets = {};
+  omg_error err = omg_query_facets(ctx, is_star, &filter, &facets);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  // facets are grouped by kind, build each group from its end
+  const char *kinds[] = {"lang", "license", "private"};
+  emacs_value groups[] = {Qnil, Qnil, Qnil};
+  for (size_t i = facets.length; i > 0; i--) {
+    omg_facet facet = facets.facet_array[i - 1];
+    emacs_value value = facet.value ? lisp_string(env, (char *)facet.value)
+                                    : Qnil;
+    groups[facet.kind] = lisp_funcall(
+        env, "cons",
+        lisp_funcall(env, "cons", value, lisp_integer(env, facet.count)),
+        groups[facet.kind]);
+  }
+  emacs_value alist = Qnil;
+  for (size_t i = 3; i > 0; i--) {
+    alist = lisp_funcall(
+        env, "cons",
+        lisp_funcall(env, "cons", lisp_symbol(env, kinds[i - 1]),
+                     groups[i - 1]),
+        alist);
+  }
+  return alist;
+}
+
+static bool omg_dyn_gist_visitor(const omg_gist *gist, void *userdata) {
+  row_collector *collector = userdata;
+  emacs_env *env = collector->env;
+  omg_auto_char readable_size = human_size(gist->file.size);
+  emacs_value file_button = lisp_text_button(
+      env, lisp_string(env, gist->file.filename),
+      // props
+      Qraw_url, lisp_string(env, gist->file.raw_url),
+      // language
+      Qlanguage, lisp_string(env, gist->file.language),
+      // size
+      Qhelp_echo, lisp_string(env, readable_size));
+
+  emacs_value cells[] = {
+      lisp_string(env, gist->created_at),
+      file_button,
+      lisp_string(env, string_or_empty(gist->description)),
+  };
+  return row_collector_push(
+      collector, lisp_row(env, lisp_string(env, gist->id), cells, 3));
+}
+
+static emacs_value omg_dyn_query_gists_common(emacs_env *env, bool is_star) {
+  ENSURE_SETUP(env);
+
+  row_collector collector __attribute__((cleanup(free_row_collector))) = {
+      .env = env};
+  omg_error err = omg_query_gists_each(ctx, is_star, NULL,
+                                       omg_dyn_gist_visitor, &collector);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+  return row_collector_vector(&collector);
 }
 
 emacs_value omg_dyn_query_starred_gists(emacs_env *env, ptrdiff_t nargs,
@@ -268,6 +584,24 @@ emacs_value omg_dyn_query_created_gists(emacs_env *env, ptrdiff_t nargs,
   return omg_dyn_query_gists_common(env, false);
 }
 
+static emacs_value trending_vector(emacs_env *env, omg_repo_list repo_lst) {
+  emacs_value repo_vector = lisp_make_vector(env, repo_lst.length);
+  for (size_t i = 0; i < repo_lst.length; i++) {
+    omg_repo repo = repo_lst.repo_array[i];
+    emacs_value cells[] = {
+        omg_dyn_emacs_button(env, repo.full_name, repo.full_name),
+        lisp_string(env, string_or_empty(repo.lang)),
+        lisp_number_string(env, repo.stargazers_count),
+        lisp_number_string(env, repo.recent_stars),
+        lisp_string(env, string_or_empty(repo.description)),
+    };
+    env->vec_set(env, repo_vector, i,
+                 lisp_row(env, lisp_number_string(env, i), cells, 5));
+  }
+
+  return repo_vector;
+}
+
 emacs_value omg_dyn_query_trendings(emacs_env *env, ptrdiff_t nargs,
                                     emacs_value *args, void *data) {
   ENSURE_SETUP(env);
@@ -284,25 +618,225 @@ emacs_value omg_dyn_query_trendings(emacs_env *env, ptrdiff_t nargs,
   }
 
   ENSURE_NONLOCAL_EXIT(env);
+  return trending_vector(env, repo_lst);
+}
+
+// Return (FRESH . REPOS) of cached trending page.
+emacs_value omg_dyn_query_cached_trendings(emacs_env *env, ptrdiff_t nargs,
+                                           emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char spoken_lang = get_string(env, args[0]);
+  omg_auto_char lang = get_string(env, args[1]);
+  omg_auto_char since = get_string(env, args[2]);
+
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_auto_repo_list repo_lst = {};
+  bool fresh = false;
+  omg_error err = omg_query_cached_trending(ctx, spoken_lang, lang, since,
+                                            &repo_lst, &fresh);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+  return lisp_funcall(env, "cons", fresh ? Qt : Qnil,
+                      trending_vector(env, repo_lst));
+}
 
-  emacs_value repo_vector = lisp_funcall(
-      env, "make-vector", lisp_integer(env, repo_lst.length), Qnil);
+emacs_value omg_dyn_query_trending_streaks(emacs_env *env, ptrdiff_t nargs,
+                                           emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char spoken_lang = get_string(env, args[0]);
+  omg_auto_char lang = get_string(env, args[1]);
+  omg_auto_char since = get_string(env, args[2]);
+  int days = env->extract_integer(env, args[3]);
+
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_auto_trending_streak_list streak_lst = {};
+  omg_error err = omg_query_trending_streaks(ctx, spoken_lang, lang, since,
+                                             days, 0, &streak_lst);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  emacs_value streak_vector = lisp_make_vector(env, streak_lst.length);
+  for (size_t i = 0; i < streak_lst.length; i++) {
+    omg_trending_streak streak = streak_lst.streak_array[i];
+    emacs_value cells[] = {
+        omg_dyn_emacs_button(env, streak.full_name, streak.full_name),
+        lisp_number_string(env, streak.days),
+        lisp_number_string(env, streak.current_streak),
+        lisp_number_string(env, streak.longest_streak),
+        lisp_number_string(env, streak.best_rank),
+        lisp_number_string(env, streak.stars_gained),
+        lisp_string(env, streak.first_seen),
+        lisp_string(env, streak.last_seen),
+    };
+    env->vec_set(env, streak_vector, i,
+                 lisp_row(env, lisp_number_string(env, i), cells, 8));
+  }
+
+  return streak_vector;
+}
+
+static void free_trending_sources(omg_trending_source *sources, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    free((char *)sources[i].lang);
+    free((char *)sources[i].since);
+  }
+  free(sources);
+}
+
+// Ranks of a repository on each of len pages joined by space, "-" when
+// absent. buf holds at least len * 12 + 1 bytes, return length written.
+static size_t trending_ranks(const omg_trending_repo *merged, size_t len,
+                             char *buf) {
+  size_t n = 0;
+  buf[0] = '\0';
+  for (size_t j = 0; j < len; j++) {
+    int rank = merged->ranks[j];
+    n += rank ? sprintf(buf + n, j ? " %d" : "%d", rank)
+              : sprintf(buf + n, j ? " -" : "-");
+  }
+  return n;
+}
+
+// Parse SOURCES, a list of (LANG . RANGE), free with free_trending_sources.
+static omg_trending_source *get_trending_sources(emacs_env *env,
+                                                 const char *spoken_lang,
+                                                 emacs_value lst,
+                                                 size_t *len) {
+  *len = env->extract_integer(env, lisp_funcall(env, "length", lst));
+  omg_trending_source *sources =
+      calloc(*len + 1, sizeof(omg_trending_source));
+  for (size_t i = 0; i < *len; i++) {
+    emacs_value pair = lisp_funcall(env, "nth", lisp_integer(env, i), lst);
+    sources[i] = (omg_trending_source){
+        .spoken_lang = spoken_lang,
+        .lang = get_string(env, lisp_funcall(env, "car", pair)),
+        .since = get_string(env, lisp_funcall(env, "cdr", pair)),
+    };
+  }
+  return sources;
+}
+
+// Query trending pages of SOURCES, a list of (LANG . RANGE), at once. Ranks
+// of a repository on each page are joined by space, "-" when absent.
+emacs_value omg_dyn_query_trendings_batch(emacs_env *env, ptrdiff_t nargs,
+                                          emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char spoken_lang = get_string(env, args[0]);
+  size_t len = 0;
+  omg_trending_source *sources =
+      get_trending_sources(env, spoken_lang, args[1], &len);
+
+  if (env->non_local_exit_check(env) != emacs_funcall_exit_return) {
+    free_trending_sources(sources, len);
+    return Qnil;
+  }
+
+  omg_auto_trending_list repo_lst = {};
+  omg_error err = omg_query_trendings(ctx, sources, len, &repo_lst);
+  free_trending_sources(sources, len);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  emacs_value repo_vector = lisp_make_vector(env, repo_lst.length);
+  char *ranks = malloc(len * 12 + 1);
   for (size_t i = 0; i < repo_lst.length; i++) {
-    omg_repo repo = repo_lst.repo_array[i];
-    emacs_value row = lisp_funcall(
-        env, "list",
-        lisp_funcall(env, "number-to-string", lisp_integer(env, i)),
-        lisp_funcall(env, "vector",
-                     omg_dyn_emacs_button(env, repo.full_name, repo.full_name),
-                     lisp_funcall(env, "number-to-string",
-                                  lisp_integer(env, repo.stargazers_count)),
-                     lisp_string(env, string_or_empty(repo.description)), ));
-    lisp_funcall(env, "aset", repo_vector, lisp_integer(env, i), row);
+    omg_trending_repo merged = repo_lst.repo_array[i];
+    omg_repo repo = merged.repo;
+    size_t n = trending_ranks(&merged, len, ranks);
+    emacs_value cells[] = {
+        omg_dyn_emacs_button(env, repo.full_name, repo.full_name),
+        lisp_string(env, string_or_empty(repo.lang)),
+        lisp_number_string(env, repo.stargazers_count),
+        lisp_number_string(env, repo.recent_stars),
+        env->make_string(env, ranks, n),
+        lisp_string(env, string_or_empty(repo.description)),
+    };
+    env->vec_set(env, repo_vector, i,
+                 lisp_row(env, lisp_number_string(env, i), cells, 6));
   }
+  free(ranks);
 
   return repo_vector;
 }
 
+typedef struct {
+  int pipe;
+  char *spoken_lang;
+  char *lang;
+  char *since;
+} refresh_trending_param;
+
+static void *refresh_trending_background(void *ptr) {
+  refresh_trending_param *param = ptr;
+  int pipe = param->pipe;
+
+  omg_error err = omg_refresh_trending(ctx, param->spoken_lang, param->lang,
+                                       param->since);
+  // Lisp queries cache as soon as PIPE_EOF arrives
+  IS_SYNC = 0;
+  if (!is_ok(err)) {
+    write_pipe(pipe, err.message, strlen(err.message));
+  }
+  write_pipe(pipe, PIPE_EOF, strlen(PIPE_EOF));
+
+  free(param->spoken_lang);
+  free(param->lang);
+  free(param->since);
+  free(param);
+  close(pipe);
+  return NULL;
+}
+
+// nil is returned without refreshing while another job is running, like
+// start_refresh.
+emacs_value omg_dyn_refresh_trendings(emacs_env *env, ptrdiff_t nargs,
+                                      emacs_value *args, void *data) {
+  if (IS_SYNC) {
+    return Qnil;
+  }
+  ENSURE_SETUP(env);
+
+  int fd = env->open_channel(env, args[0]);
+  ENSURE_NONLOCAL_EXIT(env);
+  refresh_trending_param *param = malloc(sizeof(refresh_trending_param));
+  *param = (refresh_trending_param){
+      .pipe = fd,
+      .spoken_lang = get_string(env, args[1]),
+      .lang = get_string(env, args[2]),
+      .since = get_string(env, args[3]),
+  };
+
+  int rc = -1;
+  pthread_t id;
+  if (env->non_local_exit_check(env) == emacs_funcall_exit_return) {
+    IS_SYNC = 1;
+    rc = pthread_create(&id, NULL, refresh_trending_background, param);
+  }
+  if (rc) {
+    IS_SYNC = 0;
+    close(fd);
+    free(param->spoken_lang);
+    free(param->lang);
+    free(param->since);
+    free(param);
+    if (rc < 0) {
+      return Qnil;
+    }
+    return lisp_funcall(env, "error",
+                        lisp_string(env, "create refresh thread failed"));
+  }
+  pthread_detach(id);
+
+  return Qt;
+}
+
 emacs_value omg_dyn_unstar_repo(emacs_env *env, ptrdiff_t nargs,
                                 emacs_value *args, void *data) {
   ENSURE_SETUP(env);
@@ -320,43 +854,488 @@ emacs_value omg_dyn_unstar_repo(emacs_env *env, ptrdiff_t nargs,
 emacs_value omg_dyn_star_repo(emacs_env *env, ptrdiff_t nargs,
                               emacs_value *args, void *data) {
   ENSURE_SETUP(env);
-  omg_auto_char repo_full_name = get_string(env, args[0]);
-  ENSURE_NONLOCAL_EXIT(env);
+  omg_auto_char repo_full_name = get_string(env, args[0]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_error err = omg_star_repo(ctx, repo_full_name);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  return Qt;
+}
+
+emacs_value omg_dyn_delete_gist(emacs_env *env, ptrdiff_t nargs,
+                                emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char gist_id = get_string(env, args[0]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_error err = omg_delete_gist(ctx, gist_id);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  return Qt;
+}
+
+emacs_value omg_dyn_unstar_gist(emacs_env *env, ptrdiff_t nargs,
+                                emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char gist_id = get_string(env, args[0]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_error err = omg_unstar_gist(ctx, gist_id);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  return Qt;
+}
+
+// Background queries
+// Network-backed queries run in a thread and write their result to pipe as a
+// readable s-expression, (ok VALUE) or (error MESSAGE), followed by PIPE_EOF.
+// Newlines in strings are escaped, so PIPE_EOF never appears in a result.
+typedef struct {
+  char *data;
+  size_t length;
+  size_t capacity;
+} sexp_buf;
+
+static void sexp_append(sexp_buf *buf, const char *s, size_t len) {
+  if (buf->length + len + 1 > buf->capacity) {
+    size_t capacity = buf->capacity ? buf->capacity : 256;
+    while (capacity < buf->length + len + 1) {
+      capacity *= 2;
+    }
+    buf->data = realloc(buf->data, capacity);
+    buf->capacity = capacity;
+  }
+  memcpy(buf->data + buf->length, s, len);
+  buf->length += len;
+  buf->data[buf->length] = '\0';
+}
+
+// Separate atoms by a space, unless it's the first one of a list/vector
+static void sexp_separate(sexp_buf *buf) {
+  if (buf->length) {
+    char last = buf->data[buf->length - 1];
+    if (last != '(' && last != '[') {
+      sexp_append(buf, " ", 1);
+    }
+  }
+}
+
+static void sexp_open(sexp_buf *buf, const char *paren) {
+  sexp_separate(buf);
+  sexp_append(buf, paren, 1);
+}
+
+static void sexp_close(sexp_buf *buf, const char *paren) {
+  sexp_append(buf, paren, 1);
+}
+
+static void sexp_symbol(sexp_buf *buf, const char *name) {
+  sexp_separate(buf);
+  sexp_append(buf, name, strlen(name));
+}
+
+static void sexp_integer(sexp_buf *buf, int64_t n) {
+  char num[24];
+  int len = snprintf(num, sizeof(num), "%" PRId64, n);
+  sexp_separate(buf);
+  sexp_append(buf, num, len);
+}
+
+// nil when s is NULL
+static void sexp_string(sexp_buf *buf, const char *s) {
+  if (!s) {
+    sexp_symbol(buf, "nil");
+    return;
+  }
+  sexp_separate(buf);
+  sexp_append(buf, "\"", 1);
+  const char *start = s;
+  for (; *s; s++) {
+    const char *escaped = NULL;
+    switch (*s) {
+    case '"':
+      escaped = "\\\"";
+      break;
+    case '\\':
+      escaped = "\\\\";
+      break;
+    case '\n':
+      escaped = "\\n";
+      break;
+    case '\r':
+      escaped = "\\r";
+      break;
+    }
+    if (escaped) {
+      sexp_append(buf, start, s - start);
+      sexp_append(buf, escaped, 2);
+      start = s + 1;
+    }
+  }
+  sexp_append(buf, start, s - start);
+  sexp_append(buf, "\"", 1);
+}
+
+// Arguments copied from Lisp before the thread starts
+typedef struct {
+  char *strings[6];
+  int64_t number;
+  omg_trending_source *sources;
+  size_t source_length;
+} async_args;
+
+static void free_async_args(async_args *args) {
+  for (size_t i = 0; i < 6; i++) {
+    free(args->strings[i]);
+  }
+  if (args->sources) {
+    free_trending_sources(args->sources, args->source_length);
+  }
+}
+
+// Write VALUE of (ok VALUE) to out, it's discarded when error is returned.
+typedef omg_error (*async_fn)(async_args *args, sexp_buf *out);
+
+typedef struct {
+  int pipe;
+  async_fn run;
+  async_args args;
+} async_job;
+
+static void *async_background(void *ptr) {
+  async_job *job = ptr;
+  sexp_buf out = {};
+  sexp_open(&out, "(");
+  sexp_symbol(&out, "ok");
+  omg_error err = job->run(&job->args, &out);
+  if (is_ok(err)) {
+    sexp_close(&out, ")");
+  } else {
+    out.length = 0;
+    sexp_open(&out, "(");
+    sexp_symbol(&out, "error");
+    sexp_string(&out, err.message);
+    sexp_close(&out, ")");
+  }
+  // callback may invoke other functions as soon as result arrives
+  IS_SYNC = 0;
+  write_pipe(job->pipe, out.data, out.length);
+  write_pipe(job->pipe, PIPE_EOF, strlen(PIPE_EOF));
+
+  free(out.data);
+  free_async_args(&job->args);
+  close(job->pipe);
+  free(job);
+  return NULL;
+}
+
+// Run `run` with args in background, result is written to pipe. args are
+// owned by the job from now on.
+static emacs_value start_async(emacs_env *env, emacs_value pipe, async_fn run,
+                               async_args args) {
+  if (env->non_local_exit_check(env) != emacs_funcall_exit_return) {
+    free_async_args(&args);
+    return Qnil;
+  }
+  int fd = env->open_channel(env, pipe);
+  if (env->non_local_exit_check(env) != emacs_funcall_exit_return) {
+    free_async_args(&args);
+    return Qnil;
+  }
+
+  IS_SYNC = 1;
+  async_job *job = malloc(sizeof(async_job));
+  *job = (async_job){.pipe = fd, .run = run, .args = args};
+  pthread_t id;
+  int rc = pthread_create(&id, NULL, async_background, job);
+  if (rc) {
+    IS_SYNC = 0;
+    close(fd);
+    free_async_args(&job->args);
+    free(job);
+    return lisp_funcall(env, "error",
+                        lisp_string(env, "create query thread failed"));
+  }
+  pthread_detach(id);
+
+  return Qt;
+}
+
+static omg_error run_whoami(async_args *args, sexp_buf *out) {
+  omg_auto_user who = {};
+  omg_error err = omg_whoami(ctx, args->strings[0], &who);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  struct {
+    const char *name;
+    const char *value;
+  } strings[] = {
+      {"login", who.login},       {"name", who.name},
+      {"company", who.company},   {"blog", who.blog},
+      {"location", who.location}, {"email", who.email},
+      {"created-at", who.created_at},
+  };
+  struct {
+    const char *name;
+    int64_t value;
+  } integers[] = {
+      {"id", who.id},
+      {"hireable", who.hireable},
+      {"public-repos", who.public_repos},
+      {"public-gists", who.public_gists},
+      {"private-repos", who.private_repos},
+      {"private-gists", who.private_gists},
+      {"followers", who.followers},
+      {"following", who.following},
+      {"disk-usage", who.disk_usage},
+  };
+  // same plist as omg_dyn_whoami
+  sexp_open(out, "(");
+  for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+    sexp_symbol(out, strings[i].name);
+    sexp_string(out, string_or_empty(strings[i].value));
+  }
+  for (size_t i = 0; i < sizeof(integers) / sizeof(integers[0]); i++) {
+    sexp_symbol(out, integers[i].name);
+    sexp_integer(out, integers[i].value);
+  }
+  sexp_close(out, ")");
+  return err;
+}
+
+emacs_value omg_dyn_whoami_async(emacs_env *env, ptrdiff_t nargs,
+                                 emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  async_args job_args = {};
+  if (nargs > 1 && env->is_not_nil(env, args[1])) {
+    job_args.strings[0] = get_string(env, args[1]);
+  }
+  return start_async(env, args[0], run_whoami, job_args);
+}
+
+// Same rows as omg_dyn_query_trendings_batch
+static omg_error run_trendings_batch(async_args *args, sexp_buf *out) {
+  omg_auto_trending_list repo_lst = {};
+  omg_error err = omg_query_trendings(ctx, args->sources, args->source_length,
+                                      &repo_lst);
+  if (!is_ok(err)) {
+    return err;
+  }
+
+  omg_auto_char ranks = malloc(args->source_length * 12 + 1);
+  sexp_open(out, "[");
+  for (size_t i = 0; i < repo_lst.length; i++) {
+    omg_trending_repo merged = repo_lst.repo_array[i];
+    omg_repo repo = merged.repo;
+    char id[24];
+    snprintf(id, sizeof(id), "%zu", i);
+    trending_ranks(&merged, args->source_length, ranks);
+
+    sexp_open(out, "(");
+    sexp_string(out, id);
+    sexp_open(out, "[");
+    // name button
+    sexp_open(out, "(");
+    sexp_string(out, repo.full_name);
+    sexp_symbol(out, "face");
+    sexp_symbol(out, "nil");
+    sexp_symbol(out, "help-echo");
+    sexp_string(out, repo.full_name);
+    sexp_close(out, ")");
+    sexp_string(out, string_or_empty(repo.lang));
+    char stars[24];
+    snprintf(stars, sizeof(stars), "%d", repo.stargazers_count);
+    sexp_string(out, stars);
+    snprintf(stars, sizeof(stars), "%d", repo.recent_stars);
+    sexp_string(out, stars);
+    sexp_string(out, ranks);
+    sexp_string(out, string_or_empty(repo.description));
+    sexp_close(out, "]");
+    sexp_close(out, ")");
+  }
+  sexp_close(out, "]");
+  return err;
+}
+
+emacs_value omg_dyn_query_trendings_batch_async(emacs_env *env,
+                                                ptrdiff_t nargs,
+                                                emacs_value *args,
+                                                void *data) {
+  ENSURE_SETUP(env);
+  async_args job_args = {};
+  job_args.strings[0] = get_string(env, args[1]);
+  job_args.sources = get_trending_sources(env, job_args.strings[0], args[2],
+                                          &job_args.source_length);
+  return start_async(env, args[0], run_trendings_batch, job_args);
+}
+
+static omg_error run_star_repo(async_args *args, sexp_buf *out) {
+  omg_error err = omg_star_repo(ctx, args->strings[0]);
+  sexp_symbol(out, "t");
+  return err;
+}
+
+emacs_value omg_dyn_star_repo_async(emacs_env *env, ptrdiff_t nargs,
+                                    emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  async_args job_args = {.strings = {get_string(env, args[1])}};
+  return start_async(env, args[0], run_star_repo, job_args);
+}
+
+static omg_error run_unstar_repo(async_args *args, sexp_buf *out) {
+  omg_error err = omg_unstar_repo(ctx, args->number);
+  sexp_symbol(out, "t");
+  return err;
+}
+
+emacs_value omg_dyn_unstar_repo_async(emacs_env *env, ptrdiff_t nargs,
+                                      emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  async_args job_args = {.number = env->extract_integer(env, args[1])};
+  return start_async(env, args[0], run_unstar_repo, job_args);
+}
+
+static omg_error run_delete_gist(async_args *args, sexp_buf *out) {
+  omg_error err = omg_delete_gist(ctx, args->strings[0]);
+  sexp_symbol(out, "t");
+  return err;
+}
+
+emacs_value omg_dyn_delete_gist_async(emacs_env *env, ptrdiff_t nargs,
+                                      emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  async_args job_args = {.strings = {get_string(env, args[1])}};
+  return start_async(env, args[0], run_delete_gist, job_args);
+}
+
+static omg_error run_unstar_gist(async_args *args, sexp_buf *out) {
+  omg_error err = omg_unstar_gist(ctx, args->strings[0]);
+  sexp_symbol(out, "t");
+  return err;
+}
+
+emacs_value omg_dyn_unstar_gist_async(emacs_env *env, ptrdiff_t nargs,
+                                      emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  async_args job_args = {.strings = {get_string(env, args[1])}};
+  return start_async(env, args[0], run_unstar_gist, job_args);
+}
 
-  omg_error err = omg_star_repo(ctx, repo_full_name);
+// strings are title, target repo, target branch, source head and body
+static omg_error run_create_pull(async_args *args, sexp_buf *out) {
+  omg_pull pull = {};
+  char **s = args->strings;
+  omg_error err =
+      omg_create_pull(ctx, s[1], s[0], s[4], s[3], s[2], args->number, &pull);
   if (!is_ok(err)) {
-    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+    return err;
   }
 
-  return Qt;
+  sexp_open(out, "(");
+  sexp_symbol(out, "number");
+  sexp_integer(out, pull.number);
+  sexp_symbol(out, "commits");
+  sexp_integer(out, pull.commits);
+  sexp_symbol(out, "additions");
+  sexp_integer(out, pull.additions);
+  sexp_symbol(out, "deletions");
+  sexp_integer(out, pull.deletions);
+  sexp_close(out, ")");
+  return err;
 }
 
-emacs_value omg_dyn_delete_gist(emacs_env *env, ptrdiff_t nargs,
-                                emacs_value *args, void *data) {
+emacs_value omg_dyn_create_pull_async(emacs_env *env, ptrdiff_t nargs,
+                                      emacs_value *args, void *data) {
   ENSURE_SETUP(env);
-  omg_auto_char gist_id = get_string(env, args[0]);
-  ENSURE_NONLOCAL_EXIT(env);
+  async_args job_args = {
+      .strings = {get_string(env, args[1]), get_string(env, args[2]),
+                  get_string(env, args[3]), get_string(env, args[4]),
+                  get_string(env, args[6])},
+      .number = env->extract_integer(env, args[5]),
+  };
+  return start_async(env, args[0], run_create_pull, job_args);
+}
 
-  omg_error err = omg_delete_gist(ctx, gist_id);
+// strings are repo id, category id, title and text
+static omg_error run_create_discussion(async_args *args, sexp_buf *out) {
+  omg_auto_discussion discussion = {};
+  char **s = args->strings;
+  omg_error err =
+      omg_create_discusstion(ctx, s[0], s[1], s[2], s[3], &discussion);
   if (!is_ok(err)) {
-    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+    return err;
   }
 
-  return Qt;
+  sexp_open(out, "(");
+  sexp_symbol(out, "id");
+  sexp_string(out, discussion.id);
+  sexp_symbol(out, "url");
+  sexp_string(out, discussion.url);
+  sexp_close(out, ")");
+  return err;
 }
 
-emacs_value omg_dyn_unstar_gist(emacs_env *env, ptrdiff_t nargs,
-                                emacs_value *args, void *data) {
+emacs_value omg_dyn_create_discussion_async(emacs_env *env, ptrdiff_t nargs,
+                                            emacs_value *args, void *data) {
   ENSURE_SETUP(env);
-  omg_auto_char gist_id = get_string(env, args[0]);
-  ENSURE_NONLOCAL_EXIT(env);
+  async_args job_args = {
+      .strings = {get_string(env, args[1]), get_string(env, args[2]),
+                  get_string(env, args[3]), get_string(env, args[4])},
+  };
+  return start_async(env, args[0], run_create_discussion, job_args);
+}
 
-  omg_error err = omg_unstar_gist(ctx, gist_id);
-  if (!is_ok(err)) {
-    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+// Format bytes with a binary unit, such as "1.5 MiB".
+static void format_bytes(char *buf, size_t size, double bytes) {
+  const char *units[] = {"B", "KiB", "MiB", "GiB"};
+  size_t unit = 0;
+  while (bytes >= 1024 && unit < 3) {
+    bytes /= 1024;
+    unit++;
   }
+  snprintf(buf, size, unit ? "%.1f %s" : "%.0f %s", bytes, units[unit]);
+}
 
-  return Qt;
+// One line per page, such as
+// starred repositories: page 3/12, 300 rows(150/s), 1.2 MiB(600.0 KiB/s),
+// ETA 18s
+static void write_sync_progress(const omg_sync_progress *progress,
+                                void *userdata) {
+  int pipe = *(int *)userdata;
+  double seconds = progress->elapsed_ms / 1000.0;
+  if (seconds <= 0) {
+    seconds = 0.001;
+  }
+  char bytes[32];
+  format_bytes(bytes, sizeof(bytes), progress->bytes);
+  char rate[32];
+  format_bytes(rate, sizeof(rate), progress->bytes / seconds);
+
+  char msg[256];
+  int len = snprintf(msg, sizeof(msg), "%s: page %" PRId32, progress->kind,
+                     progress->page);
+  if (progress->remaining_pages >= 0) {
+    len += snprintf(msg + len, sizeof(msg) - len, "/%" PRId32,
+                    progress->page + progress->remaining_pages);
+  }
+  len += snprintf(msg + len, sizeof(msg) - len,
+                  ", %" PRId64 " rows(%.0f/s), %s(%s/s)", progress->rows,
+                  progress->rows / seconds, bytes, rate);
+  if (progress->remaining_pages > 0) {
+    // pages are of the same size except the last one
+    double eta = seconds / progress->page * progress->remaining_pages;
+    len += snprintf(msg + len, sizeof(msg) - len, ", ETA %.0fs", eta);
+  }
+  write_pipe(pipe, msg, strlen(msg));
 }
 
 static void *omg_dyn_sync_background(void *ptr) {
@@ -365,6 +1344,7 @@ static void *omg_dyn_sync_background(void *ptr) {
 
   char *msg = "Start syncing, wait a few seconds...";
   write_pipe(pipe, msg, strlen(msg));
+  omg_set_sync_progress(ctx, write_sync_progress, &pipe);
 
   omg_error err = omg_sync_starred_repos(ctx);
   if (!is_ok(err)) {
@@ -398,6 +1378,7 @@ static void *omg_dyn_sync_background(void *ptr) {
     write_pipe(pipe, msg, strlen(msg));
   }
 
+  omg_set_sync_progress(ctx, NULL, NULL);
   msg = "All sync finished!";
   write_pipe(pipe, msg, strlen(msg));
   write_pipe(pipe, PIPE_EOF, strlen(PIPE_EOF));
@@ -431,6 +1412,100 @@ emacs_value omg_dyn_sync(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
   return Qt;
 }
 
+static void *omg_dyn_sync_readmes_background(void *ptr) {
+  int pipe = *(int *)ptr;
+  free(ptr);
+
+  char *msg = "Start fetching READMEs of starred repositories...";
+  write_pipe(pipe, msg, strlen(msg));
+
+  omg_readme_sync_stats stats = {};
+  omg_error err = omg_sync_readmes(ctx, 0, &stats);
+  if (!is_ok(err)) {
+    write_pipe(pipe, err.message, strlen(err.message));
+  }
+  char summary[256];
+  sprintf(summary,
+          "README sync finished! checked:%d, updated:%d, not modified:%d, "
+          "missing:%d, failed:%d",
+          stats.checked, stats.updated, stats.not_modified, stats.missing,
+          stats.failed);
+  write_pipe(pipe, summary, strlen(summary));
+  write_pipe(pipe, PIPE_EOF, strlen(PIPE_EOF));
+
+  IS_SYNC = 0;
+  close(pipe);
+  return NULL;
+}
+
+emacs_value omg_dyn_sync_readmes(emacs_env *env, ptrdiff_t nargs,
+                                 emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+
+  emacs_value pipe = args[0];
+  int fd = env->open_channel(env, pipe);
+
+  ENSURE_NONLOCAL_EXIT(env);
+
+  IS_SYNC = 1;
+  pthread_t id;
+  int *fd_ptr = malloc(sizeof(fd));
+  *fd_ptr = fd;
+  int rc = pthread_create(&id, NULL, omg_dyn_sync_readmes_background, fd_ptr);
+  if (rc) {
+    IS_SYNC = 0;
+    close(fd);
+    free(fd_ptr);
+    return lisp_funcall(env, "error",
+                        lisp_string(env, "create sync thread failed"));
+  }
+  pthread_detach(id);
+
+  return Qt;
+}
+
+// Tabulated list shows one line per row.
+static char *join_lines(const char *input) {
+  char *buf = strdup(string_or_empty(input));
+  for (char *p = buf; *p; p++) {
+    if (*p == '\n' || *p == '\r' || *p == '\t') {
+      *p = ' ';
+    }
+  }
+  return buf;
+}
+
+// Matched terms are wrapped in \x01 and \x02, replaced by faces in Lisp.
+static bool omg_dyn_readme_visitor(const omg_starred_repo *star,
+                                   const char *snippet, void *userdata) {
+  row_collector *collector = userdata;
+  omg_auto_char oneline = join_lines(snippet);
+  omg_repo repo = star->repo;
+  repo.description = oneline;
+  return row_collector_push(
+      collector,
+      omg_dyn_query_common(collector->env, star->starred_at, true, repo));
+}
+
+emacs_value omg_dyn_search_readmes(emacs_env *env, ptrdiff_t nargs,
+                                   emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char query = get_string(env, args[0]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_readme_marks marks = {.open = "\x01", .close = "\x02"};
+  row_collector collector __attribute__((cleanup(free_row_collector))) = {
+      .env = env};
+  omg_error err = omg_search_readmes_each(ctx, query, &marks,
+                                          omg_dyn_readme_visitor, &collector);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+  return row_collector_vector(&collector);
+}
+
 emacs_value omg_dyn_whoami(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
                            void *data) {
   ENSURE_SETUP(env);
@@ -486,10 +1561,15 @@ static char *split_newline(const char *input) {
   return buf;
 }
 
-static emacs_value localtime_format(emacs_env *env, emacs_value iso8601) {
-  return lisp_funcall(env, "format-time-string",
-                      lisp_string(env, "%Y-%m-%d %T"),
-                      lisp_funcall(env, "parse-iso8601-time-string", iso8601));
+// Format ISO 8601 time like 2022-11-26T08:10:14Z with "%Y-%m-%d %T" in
+// Emacs's time zone, which may differ from TZ of the process.
+static emacs_value localtime_format(emacs_env *env, const char *iso8601) {
+  if (!iso8601) {
+    return lisp_string(env, "");
+  }
+  return lisp_call(env, Qformat_time_string, lisp_string(env, "%Y-%m-%d %T"),
+                   lisp_call(env, Qparse_iso8601_time_string,
+                             lisp_string(env, iso8601)));
 }
 
 static char *shorten_sha(const char *sha) {
@@ -500,6 +1580,32 @@ static char *shorten_sha(const char *sha) {
   return buf;
 }
 
+static emacs_value commit_vector(emacs_env *env, omg_commit_list commit_lst) {
+  emacs_value commit_vector = lisp_make_vector(env, commit_lst.length);
+  for (size_t i = 0; i < commit_lst.length; i++) {
+    omg_commit commit = commit_lst.commit_array[i];
+
+    omg_auto_char short_sha = shorten_sha(commit.sha);
+
+    omg_auto_char short_msg = split_newline(commit.message);
+    emacs_value msg_button =
+        lisp_text_button(env, lisp_string(env, short_msg),
+                         // props
+                         Qhelp_echo, lisp_string(env, (char *)commit.message));
+
+    emacs_value cells[] = {
+        lisp_string(env, short_sha),
+        msg_button,
+        lisp_string(env, (char *)commit.author),
+        localtime_format(env, commit.date),
+    };
+    env->vec_set(env, commit_vector, i,
+                 lisp_row(env, lisp_number_string(env, i), cells, 4));
+  }
+
+  return commit_vector;
+}
+
 emacs_value omg_dyn_query_commits(emacs_env *env, ptrdiff_t nargs,
                                   emacs_value *args, void *data) {
   ENSURE_SETUP(env);
@@ -514,72 +1620,131 @@ emacs_value omg_dyn_query_commits(emacs_env *env, ptrdiff_t nargs,
   }
 
   ENSURE_NONLOCAL_EXIT(env);
+  return commit_vector(env, commit_lst);
+}
 
-  emacs_value commit_vector = lisp_funcall(
-      env, "make-vector", lisp_integer(env, commit_lst.length), Qnil);
-  for (size_t i = 0; i < commit_lst.length; i++) {
-    omg_commit commit = commit_lst.commit_array[i];
+emacs_value omg_dyn_query_cached_commits(emacs_env *env, ptrdiff_t nargs,
+                                         emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char full_name = get_string(env, args[0]);
+  int limit = env->extract_integer(env, args[1]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_auto_commit_list commit_lst = {};
+  omg_error err =
+      omg_query_cached_commits(ctx, full_name, limit, &commit_lst);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
 
-    char id[3];
-    sprintf(id, "%zu", i);
+  ENSURE_NONLOCAL_EXIT(env);
+  return commit_vector(env, commit_lst);
+}
 
-    omg_auto_char short_sha = shorten_sha(commit.sha);
+typedef omg_error (*refresh_fn)(omg_context, const char *full_name,
+                                int limit);
 
-    omg_auto_char short_msg = split_newline(commit.message);
-    emacs_value msg_button =
-        lisp_text_button(env, lisp_string(env, short_msg),
-                         // props
-                         lisp_symbol(env, "help-echo"),
-                         lisp_string(env, (char *)commit.message));
+typedef struct {
+  int pipe;
+  char *full_name;
+  int limit;
+  refresh_fn refresh;
+} refresh_param;
+
+static void *refresh_background(void *ptr) {
+  refresh_param *param = ptr;
+  int pipe = param->pipe;
 
-    emacs_value row = lisp_funcall(
-        env, "list", lisp_string(env, id),
-        lisp_funcall(
-            env, "vector", lisp_string(env, short_sha), msg_button,
-            lisp_string(env, (char *)commit.author),
-            localtime_format(env, lisp_string(env, (char *)commit.date)), ));
-    lisp_funcall(env, "aset", commit_vector, lisp_integer(env, i), row);
+  omg_error err = param->refresh(ctx, param->full_name, param->limit);
+  // Lisp queries cache as soon as PIPE_EOF arrives
+  IS_SYNC = 0;
+  if (!is_ok(err)) {
+    write_pipe(pipe, err.message, strlen(err.message));
   }
+  write_pipe(pipe, PIPE_EOF, strlen(PIPE_EOF));
 
-  return commit_vector;
+  free(param->full_name);
+  free(param);
+  close(pipe);
+  return NULL;
 }
 
-emacs_value omg_dyn_query_releases(emacs_env *env, ptrdiff_t nargs,
-                                   emacs_value *args, void *data) {
+// Run refresh of repository args[1] with limit args[2] in background,
+// PIPE_EOF is written to pipe args[0] once done. nil is returned without
+// refreshing while another job is running, cached rows are shown as is.
+static emacs_value start_refresh(emacs_env *env, emacs_value *args,
+                                 refresh_fn refresh) {
+  if (IS_SYNC) {
+    return Qnil;
+  }
   ENSURE_SETUP(env);
-  omg_auto_char full_name = get_string(env, args[0]);
-  int limit = env->extract_integer(env, args[1]);
+
+  int fd = env->open_channel(env, args[0]);
   ENSURE_NONLOCAL_EXIT(env);
+  refresh_param *param = malloc(sizeof(refresh_param));
+  *param = (refresh_param){
+      .pipe = fd,
+      .full_name = get_string(env, args[1]),
+      .limit = env->extract_integer(env, args[2]),
+      .refresh = refresh,
+  };
+
+  if (env->non_local_exit_check(env) != emacs_funcall_exit_return) {
+    close(fd);
+    free(param->full_name);
+    free(param);
+    return Qnil;
+  }
 
-  omg_auto_release_list release_lst = {};
-  omg_error err = omg_query_releases(ctx, full_name, limit, &release_lst);
-  if (!is_ok(err)) {
-    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  IS_SYNC = 1;
+  pthread_t id;
+  int rc = pthread_create(&id, NULL, refresh_background, param);
+  if (rc) {
+    IS_SYNC = 0;
+    close(fd);
+    free(param->full_name);
+    free(param);
+    return lisp_funcall(env, "error",
+                        lisp_string(env, "create refresh thread failed"));
   }
+  pthread_detach(id);
 
-  ENSURE_NONLOCAL_EXIT(env);
+  return Qt;
+}
+
+emacs_value omg_dyn_refresh_commits(emacs_env *env, ptrdiff_t nargs,
+                                    emacs_value *args, void *data) {
+  return start_refresh(env, args, omg_refresh_commits);
+}
+
+static omg_error refresh_repo_releases(omg_context ctx, const char *full_name,
+                                       int limit) {
+  return omg_refresh_releases(ctx, &full_name, 1, limit);
+}
+
+emacs_value omg_dyn_refresh_releases(emacs_env *env, ptrdiff_t nargs,
+                                     emacs_value *args, void *data) {
+  return start_refresh(env, args, refresh_repo_releases);
+}
 
-  emacs_value release_vector = lisp_funcall(
-      env, "make-vector", lisp_integer(env, release_lst.length), Qnil);
+static emacs_value release_vector(emacs_env *env,
+                                  omg_release_list release_lst) {
+  emacs_value release_vector = lisp_make_vector(env, release_lst.length);
   for (size_t i = 0; i < release_lst.length; i++) {
     omg_release release = release_lst.release_array[i];
 
-    emacs_value asset_vector = lisp_funcall(
-        env, "make-vector", lisp_integer(env, release.asset_length), Qnil);
+    emacs_value asset_vector = lisp_make_vector(env, release.asset_length);
     for (int j = 0; j < release.asset_length; j++) {
       omg_release_asset asset = release.asset_array[j];
       omg_auto_char readable_size = human_size(asset.size);
-      emacs_value row = lisp_funcall(
-          env, "list", lisp_string(env, asset.name),
-          lisp_funcall(
-              env, "vector",
-              lisp_text_button(env, lisp_string(env, asset.name),
-                               lisp_symbol(env, "raw-url"),
-                               lisp_string(env, asset.download_url)),
-              lisp_string(env, readable_size),
-              lisp_funcall(env, "number-to-string",
-                           lisp_integer(env, asset.download_count)), ));
-      lisp_funcall(env, "aset", asset_vector, lisp_integer(env, j), row);
+      emacs_value name = lisp_string(env, asset.name);
+      emacs_value cells[] = {
+          lisp_text_button(env, name, Qraw_url,
+                           lisp_string(env, asset.download_url)),
+          lisp_string(env, readable_size),
+          lisp_number_string(env, asset.download_count),
+      };
+      env->vec_set(env, asset_vector, j, lisp_row(env, name, cells, 3));
     }
 
     char *name = release.name;
@@ -589,32 +1754,66 @@ emacs_value omg_dyn_query_releases(emacs_env *env, ptrdiff_t nargs,
     emacs_value name_button = lisp_text_button(
         env, lisp_string(env, name),
         // props
-        lisp_symbol(env, "help-echo"), lisp_string(env, (char *)release.body),
+        Qhelp_echo, lisp_string(env, (char *)release.body),
         // len
         lisp_symbol(env, "asset-length"),
         lisp_integer(env, release.asset_length),
         // files
         lisp_symbol(env, "asset-files"), asset_vector, );
 
-    char id[10];
-    sprintf(id, "%d", release.id);
     char *draft = release.draft ? "true" : "false";
     char *prerelease = release.prerelease ? "true" : "false";
 
-    emacs_value row = lisp_funcall(
-        env, "list", lisp_string(env, id),
-        lisp_funcall(env, "vector",
-                     localtime_format(
-                         env, lisp_string(env, (char *)release.published_at)),
-                     name_button, lisp_string(env, (char *)release.login),
-                     lisp_string(env, (char *)release.tag_name),
-                     lisp_string(env, draft), lisp_string(env, prerelease)));
-    lisp_funcall(env, "aset", release_vector, lisp_integer(env, i), row);
+    emacs_value cells[] = {
+        localtime_format(env, release.published_at),
+        name_button,
+        lisp_string(env, (char *)release.login),
+        lisp_string(env, (char *)release.tag_name),
+        lisp_string(env, draft),
+        lisp_string(env, prerelease),
+    };
+    env->vec_set(env, release_vector, i,
+                 lisp_row(env, lisp_number_string(env, release.id), cells, 6));
   }
 
   return release_vector;
 }
 
+emacs_value omg_dyn_query_releases(emacs_env *env, ptrdiff_t nargs,
+                                   emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char full_name = get_string(env, args[0]);
+  int limit = env->extract_integer(env, args[1]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_auto_release_list release_lst = {};
+  omg_error err = omg_query_releases(ctx, full_name, limit, &release_lst);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+  return release_vector(env, release_lst);
+}
+
+emacs_value omg_dyn_query_cached_releases(emacs_env *env, ptrdiff_t nargs,
+                                          emacs_value *args, void *data) {
+  ENSURE_SETUP(env);
+  omg_auto_char full_name = get_string(env, args[0]);
+  int limit = env->extract_integer(env, args[1]);
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_auto_release_list release_lst = {};
+  omg_error err =
+      omg_query_cached_releases(ctx, full_name, limit, &release_lst);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  ENSURE_NONLOCAL_EXIT(env);
+  return release_vector(env, release_lst);
+}
+
 typedef struct {
   int pipe;
   char *url;
@@ -739,10 +1938,44 @@ emacs_value omg_dyn_setup(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
 #ifdef VERBOSE
   printf("path:%s, token:%s, timeout:%d\n", db_path, github_token, timeout);
 #endif
+  // optional database tuning, nil means default
+  emacs_value tuning[8];
+  for (size_t i = 0; i < 8; i++) {
+    tuning[i] = (ptrdiff_t)i + 3 < nargs ? args[i + 3] : Qnil;
+  }
+  omg_auto_char temp_store = get_string(env, tuning[3]);
+  omg_auto_char journal_mode = get_string(env, tuning[4]);
+  omg_auto_char synchronous = get_string(env, tuning[5]);
+  omg_setup_options opts = {
+      .github_token = github_token,
+      .timeout = timeout,
+      .page_size = integer_or_zero(env, tuning[0]),
+      .cache_size = integer_or_zero(env, tuning[1]),
+      .mmap_size = integer_or_zero(env, tuning[2]),
+      .temp_store = temp_store,
+      .journal_mode = journal_mode,
+      .synchronous = synchronous,
+      .optimize_interval = integer_or_zero(env, tuning[6]),
+      .trending_ttl = integer_or_zero(env, tuning[7]),
+  };
+
+  ENSURE_NONLOCAL_EXIT(env);
+
+  omg_error err = omg_setup_context_with_options(db_path, &opts, &ctx);
+  if (!is_ok(err)) {
+    return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
+  }
+
+  return Qt;
+}
 
+emacs_value omg_dyn_vacuum(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
+                           void *data) {
+  ENSURE_SETUP(env);
+  int32_t max_pages = nargs > 0 ? integer_or_zero(env, args[0]) : 0;
   ENSURE_NONLOCAL_EXIT(env);
 
-  omg_error err = omg_setup_context(db_path, github_token, timeout, &ctx);
+  omg_error err = omg_vacuum(ctx, max_pages);
   if (!is_ok(err)) {
     return lisp_funcall(env, "error", lisp_string(env, (char *)err.message));
   }
@@ -750,6 +1983,13 @@ emacs_value omg_dyn_setup(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
   return Qt;
 }
 
+// Cheap enough for hooks, which skip their work instead of signaling an error
+// that removes them.
+emacs_value omg_dyn_busy_p(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
+                           void *data) {
+  return IS_SYNC ? Qt : Qnil;
+}
+
 emacs_value omg_dyn_teardown(emacs_env *env, ptrdiff_t nargs, emacs_value *args,
                              void *data) {
   if (ctx) {
@@ -769,21 +2009,57 @@ int emacs_module_init(runtime ert) {
   // global emacs values
   Qt = env->make_global_ref(env, lisp_symbol(env, "t"));
   Qnil = env->make_global_ref(env, lisp_symbol(env, "nil"));
+  Qcons = env->make_global_ref(env, lisp_symbol(env, "cons"));
+  Qlist = env->make_global_ref(env, lisp_symbol(env, "list"));
+  Qvector = env->make_global_ref(env, lisp_symbol(env, "vector"));
+  Qmake_vector = env->make_global_ref(env, lisp_symbol(env, "make-vector"));
+  Qface = env->make_global_ref(env, lisp_symbol(env, "face"));
+  Qhelp_echo = env->make_global_ref(env, lisp_symbol(env, "help-echo"));
+  Qraw_url = env->make_global_ref(env, lisp_symbol(env, "raw-url"));
+  Qlanguage = env->make_global_ref(env, lisp_symbol(env, "language"));
+  Qformat_time_string =
+      env->make_global_ref(env, lisp_symbol(env, "format-time-string"));
+  Qparse_iso8601_time_string =
+      env->make_global_ref(env, lisp_symbol(env, "parse-iso8601-time-string"));
 
   // export functions
-  lisp_funcall(
-      env, "fset", lisp_symbol(env, "omg-dyn-setup"),
-      env->make_function(env, 3, 3, omg_dyn_setup, "Initialize omg-dyn", NULL));
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-setup"),
+               env->make_function(env, 3, 11, omg_dyn_setup,
+                                  "Initialize omg-dyn", NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-vacuum"),
+               env->make_function(env, 0, 1, omg_dyn_vacuum,
+                                  "Reclaim free pages of local database",
+                                  NULL));
 
   lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-teardown"),
                env->make_function(env, 0, 0, omg_dyn_teardown,
                                   "Teardown omg-dyn", NULL));
 
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-busy-p"),
+               env->make_function(env, 0, 0, omg_dyn_busy_p,
+                                  "Return t while a sync or background job "
+                                  "is running",
+                                  NULL));
+
   lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-sync"),
                env->make_function(
                    env, 1, 1, omg_dyn_sync,
                    "Sync Github repositories/gists to local database", NULL));
 
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-sync-readmes"),
+      env->make_function(env, 1, 1, omg_dyn_sync_readmes,
+                         "Fetch READMEs of starred repositories pushed since "
+                         "last fetch",
+                         NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-search-readmes"),
+               env->make_function(env, 1, 1, omg_dyn_search_readmes,
+                                  "Full-text search READMEs of starred "
+                                  "repositories",
+                                  NULL));
+
   lisp_funcall(
       env, "fset", lisp_symbol(env, "omg-dyn-whoami"),
       env->make_function(
@@ -803,6 +2079,41 @@ int emacs_module_init(runtime ert) {
                    "Query created repositories based on keyword or language",
                    NULL));
 
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-filter-repos"),
+      env->make_function(
+          env, 1, 4, omg_dyn_filter_repos,
+          "Filter starred(when first arg is non-nil) or created repositories "
+          "in memory based on keyword, language or a list of topics, topics "
+          "prefixed with - are excluded",
+          NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-filter-repos-window"),
+      env->make_function(
+          env, 3, 7, omg_dyn_filter_repos_window,
+          "Like omg-dyn-filter-repos, but return (TOTAL . ROWS) where ROWS "
+          "are matched rows in [OFFSET, OFFSET + LIMIT), sorted by SORT "
+          "(nil, stars or name)",
+          NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-facets"),
+      env->make_function(
+          env, 1, 4, omg_dyn_query_facets,
+          "Count starred(when first arg is non-nil) or created repositories "
+          "matching keyword, language and topics per lang, license and "
+          "private, as an alist of (kind (value . count) ...)",
+          NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-topics"),
+      env->make_function(
+          env, 1, 1, omg_dyn_query_topics,
+          "Query topics of starred(when first arg is non-nil) or created "
+          "repositories as (topic . count), most used first",
+          NULL));
+
   lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-query-starred-gists"),
                env->make_function(env, 0, 0, omg_dyn_query_starred_gists,
                                   "Query starred gists", NULL));
@@ -830,10 +2141,36 @@ int emacs_module_init(runtime ert) {
                env->make_function(env, 2, 2, omg_dyn_query_commits,
                                   "Query commits of a repository", NULL));
 
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-cached-commits"),
+      env->make_function(env, 2, 2, omg_dyn_query_cached_commits,
+                         "Query cached commits of a repository", NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-refresh-commits"),
+      env->make_function(
+          env, 3, 3, omg_dyn_refresh_commits,
+          "Fetch commits of a repository newer than cached ones in "
+          "background, PIPE_EOF is written to pipe once done",
+          NULL));
+
   lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-query-releases"),
                env->make_function(env, 2, 2, omg_dyn_query_releases,
                                   "Query releases of a repository", NULL));
 
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-cached-releases"),
+      env->make_function(env, 2, 2, omg_dyn_query_cached_releases,
+                         "Query cached releases of a repository", NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-refresh-releases"),
+      env->make_function(
+          env, 3, 3, omg_dyn_refresh_releases,
+          "Revalidate cached releases of a repository in background, "
+          "PIPE_EOF is written to pipe once done",
+          NULL));
+
   lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-download"),
                env->make_function(env, 3, 3, omg_dyn_download,
                                   "Spawn a thread to download asset file",
@@ -843,6 +2180,34 @@ int emacs_module_init(runtime ert) {
                env->make_function(env, 3, 3, omg_dyn_query_trendings,
                                   "Query GitHub trendings", NULL));
 
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-cached-trendings"),
+      env->make_function(env, 3, 3, omg_dyn_query_cached_trendings,
+                         "Query cached GitHub trendings, return "
+                         "(FRESH . REPOS)",
+                         NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-trendings-batch"),
+      env->make_function(env, 2, 2, omg_dyn_query_trendings_batch,
+                         "Query GitHub trendings of several (LANG . RANGE) "
+                         "at once, merged by rank",
+                         NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-trending-streaks"),
+      env->make_function(env, 4, 4, omg_dyn_query_trending_streaks,
+                         "Query repositories on a trending page in last "
+                         "DAYS days, with streaks and stars gained",
+                         NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-refresh-trendings"),
+      env->make_function(env, 4, 4, omg_dyn_refresh_trendings,
+                         "Fetch GitHub trendings in background, PIPE_EOF "
+                         "is written to pipe once done",
+                         NULL));
+
   lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-create-pull"),
                env->make_function(env, 6, 6, omg_dyn_create_pull,
                                   "Create GitHub pull request", NULL));
@@ -851,6 +2216,47 @@ int emacs_module_init(runtime ert) {
                env->make_function(env, 4, 4, omg_dyn_create_discussion,
                                   "Create GitHub discussion", NULL));
 
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-whoami-async"),
+      env->make_function(env, 1, 2, omg_dyn_whoami_async,
+                         "Like omg-dyn-whoami, but run in background, "
+                         "(ok VALUE) or (error MESSAGE) is written to pipe",
+                         NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-query-trendings-batch-async"),
+      env->make_function(env, 3, 3, omg_dyn_query_trendings_batch_async,
+                         "Like omg-dyn-query-trendings-batch, but run in "
+                         "background, (ok VALUE) or (error MESSAGE) is "
+                         "written to pipe",
+                         NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-star-repo-async"),
+               env->make_function(env, 2, 2, omg_dyn_star_repo_async,
+                                  "Star repository in background", NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-unstar-repo-async"),
+               env->make_function(env, 2, 2, omg_dyn_unstar_repo_async,
+                                  "Unstar repository in background", NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-delete-gist-async"),
+               env->make_function(env, 2, 2, omg_dyn_delete_gist_async,
+                                  "Delete gist in background", NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-unstar-gist-async"),
+               env->make_function(env, 2, 2, omg_dyn_unstar_gist_async,
+                                  "Unstar gist in background", NULL));
+
+  lisp_funcall(env, "fset", lisp_symbol(env, "omg-dyn-create-pull-async"),
+               env->make_function(env, 7, 7, omg_dyn_create_pull_async,
+                                  "Create GitHub pull request in background",
+                                  NULL));
+
+  lisp_funcall(
+      env, "fset", lisp_symbol(env, "omg-dyn-create-discussion-async"),
+      env->make_function(env, 5, 5, omg_dyn_create_discussion_async,
+                         "Create GitHub discussion in background", NULL));
+
   lisp_funcall(env, "provide", lisp_symbol(env, FEATURE_NAME));
 
   return 0;
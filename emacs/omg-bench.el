@@ -0,0 +1,33 @@
+;;; -*- lexical-binding: t -*-
+
+;; Time row conversion of omg-dyn queries against a synced database:
+;;   OMG_BENCH_DB=~/.emacs.d/omg.db make lisp-bench
+
+(add-to-list 'load-path default-directory)
+
+(require 'omg)
+(require 'benchmark)
+
+(setq omg-db-file (or (getenv "OMG_BENCH_DB") omg-db-file))
+
+(omg-setup (or (getenv "GITHUB_TOKEN") "dummy"))
+
+(defconst omg-bench-rounds 10)
+
+(defun omg-bench--run (name fn)
+  "Run FN `omg-bench-rounds' times, print microseconds per returned row."
+  (let* ((rows (length (funcall fn)))
+         (result (benchmark-run omg-bench-rounds (funcall fn)))
+         (elapsed (- (car result) (nth 2 result))))
+    (message "%-24s %6d rows %8.2fus per row (%d gc)"
+             name rows
+             (if (zerop rows) 0 (/ (* elapsed 1e6) omg-bench-rounds rows))
+             (nth 1 result))))
+
+(omg-bench--run "query-starred-repos" #'omg-dyn-query-starred-repos)
+(omg-bench--run "query-created-repos" #'omg-dyn-query-created-repos)
+(omg-bench--run "filter-starred-repos"
+                (lambda () (omg-dyn-filter-repos t)))
+(omg-bench--run "filter-starred-window"
+                (lambda () (cdr (omg-dyn-filter-repos-window t 0 500))))
+(omg-bench--run "query-starred-gists" #'omg-dyn-query-starred-gists)
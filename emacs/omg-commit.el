@@ -1,19 +1,43 @@
 ;;; -*- lexical-binding: t -*-
 
 (require 'omg-dyn)
+(require 'omg-core)
 (require 'tabulated-list)
 (require 'seq)
 
 (defcustom omg-commit-query-limit 50
-  "Limit used when query latest commits (max 100)."
+  "Limit used when query latest commits.
+Commits are cached locally, later refreshes only fetch newer ones."
   :group 'omg
   :type 'integer)
 
 (defun omg-commit--query ()
-  (seq-into (omg-dyn-query-commits omg-repo--current-full-name
-                                   omg-commit-query-limit)
+  (seq-into (omg-dyn-query-cached-commits omg-repo--current-full-name
+                                          omg-commit-query-limit)
             'list))
 
+(defun omg-commit--refresh ()
+  "Fetch commits newer than cached ones in background, then reprint buffer."
+  (let* ((buf (current-buffer))
+         (full-name omg-repo--current-full-name)
+         (proc (make-pipe-process :name (format "omg-commit %s" full-name)
+                                  :coding 'utf-8-emacs-unix
+                                  :filter (lambda (proc output)
+                                            (if (string-match-p omg--pipe-eof output)
+                                                (progn
+                                                  (delete-process proc)
+                                                  (when (buffer-live-p buf)
+                                                    (with-current-buffer buf
+                                                      (let ((omg-repo--current-full-name full-name))
+                                                        (tabulated-list-print t)))))
+                                              (omg--log "[omg-commit] %s\n" output))))))
+    (unless (omg-dyn-refresh-commits proc full-name omg-commit-query-limit)
+      ;; skipped while another job is running, cached commits are shown as is
+      (delete-process proc))))
+
+(defun omg-commit--revert ()
+  (omg--call-after-revert #'omg-commit--refresh))
+
 (defun omg-commit--get-sha ()
   (when-let ((entry (tabulated-list-get-entry)))
     (aref entry 0)))
@@ -59,6 +83,7 @@
         tabulated-list-padding 2
         tabulated-list-sort-key (cons "Date" t)
         tabulated-list-entries 'omg-commit--query)
+  (add-hook 'tabulated-list-revert-hook 'omg-commit--revert nil t)
   (tabulated-list-init-header))
 
 (provide 'omg-commit)
@@ -18,6 +18,53 @@
   :group 'omg
   :type 'integer)
 
+(defcustom omg-db-page-size nil
+  "Page size in bytes of local database, only take effect on a new
+database. nil means SQLite default."
+  :group 'omg
+  :type '(choice (const nil) integer))
+
+(defcustom omg-db-cache-size nil
+  "PRAGMA cache_size of local database, pages when positive, KiB when
+negative. nil means SQLite default."
+  :group 'omg
+  :type '(choice (const nil) integer))
+
+(defcustom omg-db-mmap-size nil
+  "Bytes of local database accessed via memory-mapped I/O.
+nil means SQLite default."
+  :group 'omg
+  :type '(choice (const nil) integer))
+
+(defcustom omg-db-temp-store nil
+  "Where temporary tables and indices of local database are stored."
+  :group 'omg
+  :type '(choice (const nil) (const "default") (const "file") (const "memory")))
+
+(defcustom omg-db-journal-mode nil
+  "Journal mode of local database."
+  :group 'omg
+  :type '(choice (const nil) (const "delete") (const "truncate")
+                 (const "persist") (const "memory") (const "wal") (const "off")))
+
+(defcustom omg-db-synchronous nil
+  "PRAGMA synchronous of local database."
+  :group 'omg
+  :type '(choice (const nil) (const "off") (const "normal") (const "full")
+                 (const "extra")))
+
+(defcustom omg-db-optimize-interval nil
+  "Seconds between two optimizations of local database after sync.
+nil means one day, negative disables it."
+  :group 'omg
+  :type '(choice (const nil) integer))
+
+(defcustom omg-trending-cache-ttl nil
+  "Seconds a cached trending page is shown without refetching.
+nil means one hour, negative disables the cache."
+  :group 'omg
+  :type '(choice (const nil) integer))
+
 (defcustom omg-download-directory eww-download-directory
   "Directory where gists/release assets will downloaded."
   :group 'omg
@@ -49,6 +96,100 @@
       (format-time-string "%Y-%m-%d %H:%M:%S")
       (apply #'format fmt args)))))
 
+(defconst omg--async-retry-interval 0.2
+  "Seconds between checks whether a job not started by `omg--async' is done.")
+
+(defvar omg--async-queue nil
+  "Calls of `omg--async' waiting for the running job, oldest first.
+Each one is a list of NAME, CALLBACK, FN and ARGS.")
+
+(defvar omg--async-timer nil
+  "Timer draining `omg--async-queue' while a sync holds the lock.")
+
+(defun omg--async (name callback fn &rest args)
+  "Call FN with a pipe and ARGS, FN runs a query named NAME in background.
+CALLBACK is called with VALUE once (ok VALUE) arrives, (error MESSAGE) is
+logged and shown instead. While another job is running, the call is queued
+and started after the calls queued before it."
+  (setq omg--async-queue
+        (append omg--async-queue (list (list name callback fn args))))
+  (omg--async-drain)
+  (when omg--async-queue
+    (message "Waiting for running job, %d call(s) queued"
+             (length omg--async-queue))))
+
+(defun omg--async-drain ()
+  "Start queued calls of `omg--async' in order while no job is running.
+Jobs started here drain the queue once they finish, jobs started elsewhere,
+like syncs, are waited for with a single timer."
+  (when omg--async-timer
+    (cancel-timer omg--async-timer)
+    (setq omg--async-timer nil))
+  (while (and omg--async-queue (not (omg-dyn-busy-p)))
+    (pcase-let ((`(,name ,callback ,fn ,args) (pop omg--async-queue)))
+      (with-demoted-errors "omg--async: %S"
+        (omg--async-start name callback fn args))))
+  (when omg--async-queue
+    (setq omg--async-timer
+          (run-at-time omg--async-retry-interval nil #'omg--async-drain))))
+
+(defun omg--async-start (name callback fn args)
+  "Start FN now, see `omg--async'."
+  (let* ((buf (generate-new-buffer (format " *%s*" name)))
+         (proc (make-pipe-process
+                :name name
+                :buffer buf
+                :coding 'utf-8-emacs-unix
+                :noquery t
+                :filter (lambda (proc output)
+                          (when-let ((result (with-current-buffer buf
+                                               (goto-char (point-max))
+                                               (insert output)
+                                               (when (string-suffix-p
+                                                      omg--pipe-eof
+                                                      (buffer-substring (max (point-min) (- (point-max) 2))
+                                                                        (point-max)))
+                                                 (goto-char (point-min))
+                                                 (read (current-buffer))))))
+                            (delete-process proc)
+                            (kill-buffer buf)
+                            (unwind-protect
+                                (pcase result
+                                  (`(ok ,value) (funcall callback value))
+                                  (`(error ,msg)
+                                   (omg--log "[%s] %s" name msg)
+                                   (message "%s failed: %s" name msg)))
+                              (omg--async-drain)))))))
+    (condition-case err
+        (apply fn proc args)
+      (error
+       (delete-process proc)
+       (kill-buffer buf)
+       (signal (car err) (cdr err))))))
+
+(defun omg--call-after-revert (fn)
+  "Call FN in current buffer once `tabulated-list-revert' has reprinted it.
+Revert hooks run before the reprint, which would fail while a background job
+started by FN holds the lock."
+  (let ((buf (current-buffer)))
+    (run-at-time 0 nil (lambda ()
+                         (when (buffer-live-p buf)
+                           (with-current-buffer buf
+                             (funcall fn)))))))
+
+(defun omg--delete-entry (buf id)
+  "Delete entry of ID in BUF, if it's still there."
+  (when (buffer-live-p buf)
+    (with-current-buffer buf
+      (save-excursion
+        (goto-char (point-min))
+        (while (and (not (eobp))
+                    (not (equal id (tabulated-list-get-id))))
+          (forward-line 1))
+        (unless (eobp)
+          (tabulated-list-delete-entry)
+          t)))))
+
 (defun omg--download-file (filename raw-url)
   (let* ((dir (if (stringp omg-download-directory)
                   omg-download-directory
@@ -3,6 +3,7 @@
 (require 'org)
 (require 'ox-md)
 (require 'omg-dyn)
+(require 'omg-core)
 
 (defcustom omg-discussion-open-in-browser t
   "If non-nil open discussion link in browser via `browse-url-default-browser' after created."
@@ -30,12 +31,17 @@
                  (let ((body (buffer-substring-no-properties (point-min) (point-max))))
                    (kill-buffer)
                    body)))
-         (ret (omg-dyn-create-discussion repo-id category-id title body))
-         (link (plist-get ret 'url)))
-    (message "Discussion created: %s" ret)
-    (kill-buffer)
-    (when omg-discussion-open-in-browser
-      (browse-url-default-browser link))))
+         (buf (current-buffer)))
+    (omg--async "omg-discussion-create"
+                (lambda (ret)
+                  (message "Discussion created: %s" ret)
+                  (when (buffer-live-p buf)
+                    (kill-buffer buf))
+                  (when omg-discussion-open-in-browser
+                    (browse-url-default-browser (plist-get ret 'url))))
+                #'omg-dyn-create-discussion-async
+                repo-id category-id title body)
+    (message "Creating discussion...")))
 
 (defun omg-discussion-cancel ()
   (interactive)
@@ -1,6 +1,7 @@
 ;;; -*- lexical-binding: t -*-
 
 (require 'omg-dyn)
+(require 'omg-core)
 (require 'tabulated-list)
 (require 'seq)
 
@@ -64,9 +65,12 @@
   (when-let ((gist-id (omg-gist--get-id))
              (filename (omg-gist--get-file-name)))
     (when (yes-or-no-p (format "Are you really want to delete %s?" filename))
-      (omg-dyn-delete-gist gist-id)
-      (tabulated-list-delete-entry)
-      (message "Deleted. %s %s" filename gist-id))))
+      (let ((buf (current-buffer)))
+        (omg--async "omg-gist-delete"
+                    (lambda (_)
+                      (omg--delete-entry buf gist-id)
+                      (message "Deleted. %s %s" filename gist-id))
+                    #'omg-dyn-delete-gist-async gist-id)))))
 
 (defvar omg-gist-mode-map
   (let ((map (make-sparse-keymap)))
@@ -96,9 +100,13 @@
   (when-let ((gist-id (omg-gist--get-id))
              (filename (omg-gist--get-file-name)))
     (when (yes-or-no-p (format "Are you really want to unstar %s?" filename))
-      (omg-dyn-unstar-gist gist-id)
-      (tabulated-list-delete-entry)
-      (message "Unstarred %s(%s)" filename (omg-gist--get-url)))))
+      (let ((buf (current-buffer))
+            (url (omg-gist--get-url)))
+        (omg--async "omg-gist-unstar"
+                    (lambda (_)
+                      (omg--delete-entry buf gist-id)
+                      (message "Unstarred %s(%s)" filename url))
+                    #'omg-dyn-unstar-gist-async gist-id)))))
 
 (defvar omg-gist-starred-mode-map
   (let ((map (make-sparse-keymap)))
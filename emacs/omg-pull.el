@@ -3,6 +3,7 @@
 (require 'org)
 (require 'ox-md)
 (require 'omg-dyn)
+(require 'omg-core)
 (require 'vc)
 
 (defcustom omg-pull-open-in-browser t
@@ -57,14 +58,19 @@ This should be an existing branch on the current repository.")
                  (let ((body (buffer-substring-no-properties (point-min) (point-max))))
                    (kill-buffer)
                    body)))
-         (ret (omg-dyn-create-pull title target-repo target-branch
-                                   source-head draft body))
-         (pull-link (format "https://github.com/%s/pull/%s" target-repo
-                            (plist-get ret 'number))))
-    (message "Pull created: %s, link: %s" ret pull-link)
-    (kill-buffer)
-    (when omg-pull-open-in-browser
-      (browse-url-default-browser pull-link))))
+         (buf (current-buffer)))
+    (omg--async "omg-pull-create"
+                (lambda (ret)
+                  (let ((pull-link (format "https://github.com/%s/pull/%s" target-repo
+                                           (plist-get ret 'number))))
+                    (message "Pull created: %s, link: %s" ret pull-link)
+                    (when (buffer-live-p buf)
+                      (kill-buffer buf))
+                    (when omg-pull-open-in-browser
+                      (browse-url-default-browser pull-link))))
+                #'omg-dyn-create-pull-async
+                title target-repo target-branch source-head draft body)
+    (message "Creating pull request...")))
 
 (defun omg-pull-cancel ()
   (interactive)
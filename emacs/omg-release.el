@@ -1,6 +1,7 @@
 ;;; -*- lexical-binding: t -*-
 
 (require 'omg-dyn)
+(require 'omg-core)
 (require 'tabulated-list)
 (require 'seq)
 
@@ -10,10 +11,32 @@
   :type 'integer)
 
 (defun omg-release--query ()
-  (seq-into (omg-dyn-query-releases omg-repo--current-full-name
-                                    omg-release-query-limit)
+  (seq-into (omg-dyn-query-cached-releases omg-repo--current-full-name
+                                           omg-release-query-limit)
             'list))
 
+(defun omg-release--refresh ()
+  "Revalidate cached releases in background, then reprint buffer."
+  (let* ((buf (current-buffer))
+         (full-name omg-repo--current-full-name)
+         (proc (make-pipe-process :name (format "omg-release %s" full-name)
+                                  :coding 'utf-8-emacs-unix
+                                  :filter (lambda (proc output)
+                                            (if (string-match-p omg--pipe-eof output)
+                                                (progn
+                                                  (delete-process proc)
+                                                  (when (buffer-live-p buf)
+                                                    (with-current-buffer buf
+                                                      (let ((omg-repo--current-full-name full-name))
+                                                        (tabulated-list-print t)))))
+                                              (omg--log "[omg-release] %s\n" output))))))
+    (unless (omg-dyn-refresh-releases proc full-name omg-release-query-limit)
+      ;; skipped while another job is running, cached releases are shown as is
+      (delete-process proc))))
+
+(defun omg-release--revert ()
+  (omg--call-after-revert #'omg-release--refresh))
+
 (defun omg-release--get-name ()
   (when-let ((entry (tabulated-list-get-entry)))
     (aref entry 1)))
@@ -64,6 +87,7 @@
         tabulated-list-padding 2
         tabulated-list-sort-key (cons "PublishedAt" t)
         tabulated-list-entries 'omg-release--query)
+  (add-hook 'tabulated-list-revert-hook 'omg-release--revert nil t)
   (tabulated-list-init-header))
 
 (defun omg-release-query-assets ()
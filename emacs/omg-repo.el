@@ -1,27 +1,104 @@
 ;;; -*- lexical-binding: t -*-
 
 (require 'omg-dyn)
+(require 'omg-core)
 (require 'tabulated-list)
 (require 'seq)
 (require 'omg-commit)
 (require 'omg-release)
 
+(defcustom omg-repo-window-size 500
+  "Number of repositories loaded at a time.
+More are loaded when scrolling near the end of buffer."
+  :group 'omg
+  :type 'integer)
+
 (defvar omg-repo--query-keyword ""
   "The case-insensitive keyword used when query repositories.")
 
 (defvar omg-repo--query-language ""
   "The case-insensitive programming language used when query repositories.")
 
+(defvar omg-repo--query-topics nil
+  "Topics used when query repositories, topics prefixed with - are excluded.")
+
+(defvar omg-repo--query-sort nil
+  "Order of repositories, nil for starred/created time, `stars' or `name'.")
+
+(defvar-local omg-repo--total 0
+  "Number of repositories matching current query.")
+
+(defvar-local omg-repo--loaded 0
+  "Number of repositories loaded into buffer.")
+
+(defvar omg-repo--readme-query ""
+  "The query used when full-text search READMEs.")
+
+(defface omg-repo-readme-match
+  '((t :inherit match))
+  "Face of matched terms in README snippets.")
+
 (defvar omg-repo--current-full-name nil
   "Current repository's full name, use for query commits/releases/issues.")
 
+(defun omg-repo--query-window (starred offset)
+  "Query `omg-repo-window-size' repositories from OFFSET of current query."
+  (let ((result (omg-dyn-filter-repos-window starred offset omg-repo-window-size
+                                             omg-repo--query-keyword omg-repo--query-language
+                                             omg-repo--query-topics omg-repo--query-sort)))
+    (setq omg-repo--total (car result)
+          omg-repo--loaded (+ offset (length (cdr result))))
+    (seq-into (cdr result) 'list)))
+
 (defun omg-repo--query-starred ()
-  (seq-into (omg-dyn-query-starred-repos omg-repo--query-keyword omg-repo--query-language)
-            'list))
+  (omg-repo--query-window t 0))
 
 (defun omg-repo--query-created ()
-  (seq-into (omg-dyn-query-created-repos omg-repo--query-keyword omg-repo--query-language)
-            'list))
+  (omg-repo--query-window nil 0))
+
+(defun omg-repo-load-more ()
+  "Load next `omg-repo-window-size' repositories at end of buffer."
+  (interactive)
+  (when (< omg-repo--loaded omg-repo--total)
+    (let ((entries (omg-repo--query-window (derived-mode-p 'omg-repo-starred-mode)
+                                           omg-repo--loaded))
+          (inhibit-read-only t))
+      (save-excursion
+        (goto-char (point-max))
+        (dolist (entry entries)
+          (apply tabulated-list-printer entry))))))
+
+(defun omg-repo--maybe-load-more ()
+  "Load more repositories when end of buffer is about to be shown.
+It runs in `post-command-hook', which drops functions signaling errors, so
+it's skipped while a background job is running and retried on next command."
+  (when (and (< omg-repo--loaded omg-repo--total)
+             (eq (current-buffer) (window-buffer))
+             (not (omg-dyn-busy-p)))
+    (with-demoted-errors "omg-repo: %S"
+      (save-excursion
+        (goto-char (window-end nil t))
+        (forward-line (window-body-height))
+        (when (eobp)
+          (omg-repo-load-more))))))
+
+(defun omg-repo--mode-line ()
+  (when (> omg-repo--total 0)
+    (format " %d/%d" omg-repo--loaded omg-repo--total)))
+
+(defun omg-repo--propertize-snippet (snippet)
+  "Replace markers around matched terms in SNIPPET with `omg-repo-readme-match'."
+  (replace-regexp-in-string "\x01[^\x02]*\x02"
+                            (lambda (m)
+                              (propertize (substring m 1 -1) 'face 'omg-repo-readme-match))
+                            snippet t t))
+
+(defun omg-repo--query-readme ()
+  (seq-map (lambda (entry)
+             (let ((cols (cadr entry)))
+               (aset cols 2 (omg-repo--propertize-snippet (aref cols 2)))
+               entry))
+           (omg-dyn-search-readmes omg-repo--readme-query)))
 
 (defun omg-repo--get-full-name()
   (when-let ((entry (tabulated-list-get-entry))
@@ -48,16 +125,65 @@
         (message "Copied %s" url))
     (user-error "There is no repository at point")))
 
+(defun omg-repo--query-facets (keyword language)
+  (omg-dyn-query-facets (derived-mode-p 'omg-repo-starred-mode)
+                        keyword language omg-repo--query-topics))
+
+(defun omg-repo--read-language (keyword)
+  "Read a language with completion, annotated with repositories matching KEYWORD."
+  (let* ((langs (cdr (assq 'lang (omg-repo--query-facets keyword ""))))
+         (completion-extra-properties
+          (list :annotation-function
+                (lambda (lang)
+                  (when-let ((count (cdr (assoc lang langs))))
+                    (format " (%d)" count))))))
+    (completing-read (format "Language(%s): " omg-repo--query-language)
+                     (delq nil (mapcar #'car langs))
+                     nil nil nil nil omg-repo--query-language)))
+
 (defun omg-repo-query-repos (keyword language)
-  (interactive (list (read-string (format "Keyword(%s): " omg-repo--query-keyword)
-                                  nil nil omg-repo--query-keyword)
-                     (read-string (format "Language(%s): " omg-repo--query-language)
-                                  nil nil omg-repo--query-language)))
+  (interactive (let ((keyword (read-string (format "Keyword(%s): " omg-repo--query-keyword)
+                                           nil nil omg-repo--query-keyword)))
+                 (list keyword (omg-repo--read-language keyword))))
   (when (derived-mode-p 'omg-repo-mode)
     (setq omg-repo--query-keyword keyword)
     (setq omg-repo--query-language language)
     (tabulated-list-print t)))
 
+(defun omg-repo-show-facets ()
+  "Show counts of repositories per language, license and visibility for current query."
+  (interactive)
+  (let ((facets (omg-repo--query-facets omg-repo--query-keyword omg-repo--query-language)))
+    (message "%s"
+             (mapconcat (lambda (group)
+                          (mapconcat (lambda (facet)
+                                       (format "%s (%d)" (or (car facet) "none") (cdr facet)))
+                                     (seq-take (cdr group) 10)
+                                     " · "))
+                        facets
+                        "\n"))))
+
+(defun omg-repo-sort (sort)
+  "Order repositories by SORT, one of starred/created time, stars or name."
+  (interactive (list (intern (completing-read "Sort by: " '("time" "stars" "name") nil t))))
+  (when (derived-mode-p 'omg-repo-mode)
+    (setq omg-repo--query-sort (unless (eq sort 'time) sort))
+    (tabulated-list-print t)))
+
+(defun omg-repo--read-topics ()
+  (let* ((topics (omg-dyn-query-topics (derived-mode-p 'omg-repo-starred-mode)))
+         (candidates (append (mapcar #'car topics)
+                             (mapcar (lambda (topic) (concat "-" (car topic))) topics))))
+    (completing-read-multiple
+     "Topics(prefix - to exclude): " candidates nil nil (mapconcat #'identity omg-repo--query-topics ","))))
+
+(defun omg-repo-query-topics (topics)
+  "Filter repositories tagged with all of TOPICS, topics prefixed with - are excluded."
+  (interactive (list (omg-repo--read-topics)))
+  (when (derived-mode-p 'omg-repo-mode)
+    (setq omg-repo--query-topics topics)
+    (tabulated-list-print t)))
+
 (defun omg-repo-query-commits (full-name)
   (interactive (list (if current-prefix-arg
                          (read-string (format "Repository name(%s): " omg-repo--current-full-name)
@@ -67,6 +193,7 @@
     (setq omg-repo--current-full-name full-name)
     (omg-commit-mode)
     (tabulated-list-print t)
+    (omg-commit--refresh)
     (switch-to-buffer (current-buffer))))
 
 (defun omg-repo-query-releases (full-name)
@@ -78,28 +205,35 @@
     (omg-release-mode)
     (setq omg-repo--current-full-name full-name)
     (tabulated-list-print t)
+    (omg-release--refresh)
     (switch-to-buffer (current-buffer))))
 
 (defun omg-repo-star (full-name)
   "Star repository at point."
   (interactive (list (omg-repo--get-full-name)))
-  (omg-dyn-star-repo full-name)
-  (message "Starred %s" full-name))
+  (omg--async "omg-repo-star"
+              (lambda (_) (message "Starred %s" full-name))
+              #'omg-dyn-star-repo-async full-name))
 
 (defun omg-repo--revert (&optional revert)
   (setq omg-repo--query-keyword "")
-  (setq omg-repo--query-language ""))
+  (setq omg-repo--query-language "")
+  (setq omg-repo--query-topics nil))
 
-(defun omg-repo--init-repos-tabulated-list (query-entries-fn)
+(defun omg-repo--init-repos-tabulated-list (query-entries-fn &optional last-column)
   (setq tabulated-list-format `[("Repository" 25)
                                 ("Language" 8)
-                                ("Description" 40)]
+                                (,(or last-column "Description") 40)]
 
         tabulated-list-padding 2
         ;; tabulated-list-sort-key sort-key
-        tabulated-list-entries query-entries-fn)
+        tabulated-list-entries query-entries-fn
+        omg-repo--total 0
+        omg-repo--loaded 0
+        mode-line-process '(:eval (omg-repo--mode-line)))
 
   (add-hook 'tabulated-list-revert-hook 'omg-repo--revert nil t)
+  (add-hook 'post-command-hook 'omg-repo--maybe-load-more nil t)
   (tabulated-list-init-header))
 
 (defvar omg-repo-mode-map
@@ -109,6 +243,9 @@
     (define-key map (kbd "w") 'omg-repo-copy-url)
     (define-key map (kbd "s") 'omg-repo-query-repos)
     (define-key map (kbd "S") 'omg-repo-star)
+    (define-key map (kbd "t") 'omg-repo-query-topics)
+    (define-key map (kbd "f") 'omg-repo-show-facets)
+    (define-key map (kbd "o") 'omg-repo-sort)
     (define-key map (kbd "r") 'omg-repo-query-releases)
     (define-key map (kbd "RET") 'omg-repo-query-commits)
     (define-key map (kbd "s-u") 'tabulated-list-revert)
@@ -122,9 +259,17 @@
   "Unstar repository at point."
   (interactive (list  (omg-repo--get-full-name)))
   (when (yes-or-no-p (format "Are you really want to unstar %s?" full-name))
-    (omg-dyn-unstar-repo (string-to-number (tabulated-list-get-id)))
-    (tabulated-list-delete-entry)
-    (message "Unstarred %s" full-name)))
+    (let ((buf (current-buffer))
+          (id (tabulated-list-get-id)))
+      (omg--async "omg-repo-unstar"
+                  (lambda (_)
+                    (when (and (omg--delete-entry buf id)
+                               (> (buffer-local-value 'omg-repo--total buf) 0))
+                      (with-current-buffer buf
+                        (setq omg-repo--total (1- omg-repo--total)
+                              omg-repo--loaded (1- omg-repo--loaded))))
+                    (message "Unstarred %s" full-name))
+                  #'omg-dyn-unstar-repo-async (string-to-number id)))))
 
 (defvar omg-repo-starred-mode-map
   (let ((map (make-sparse-keymap)))
@@ -136,6 +281,28 @@
 (define-derived-mode omg-repo-starred-mode omg-repo-mode "omg-repo starred" "Manage starred repositories"
   (omg-repo--init-repos-tabulated-list 'omg-repo--query-starred))
 
+(defvar omg-repo-readme-mode-map
+  (let ((map (make-sparse-keymap)))
+    (set-keymap-parent map omg-repo-starred-mode-map)
+    (define-key map (kbd "s") 'omg-repo-search-readme)
+    map)
+  "Local keymap for omg-repo-readme mode buffers.")
+
+(define-derived-mode omg-repo-readme-mode omg-repo-starred-mode "omg-repo readme" "Search READMEs of starred repositories"
+  (omg-repo--init-repos-tabulated-list 'omg-repo--query-readme "README"))
+
+;;;###autoload
+(defun omg-repo-search-readme (query)
+  "Full-text search READMEs of starred repositories, best matches first.
+READMEs are fetched by `omg-sync-readmes'."
+  (interactive (list (read-string (format "Search README(%s): " omg-repo--readme-query)
+                                  nil nil omg-repo--readme-query)))
+  (setq omg-repo--readme-query query)
+  (with-current-buffer (get-buffer-create "*omg-repo readme*")
+    (omg-repo-readme-mode)
+    (tabulated-list-print t)
+    (switch-to-buffer (current-buffer))))
+
 ;;;###autoload
 (defun omg-repo-list-created ()
   "Display created repositories in table view."
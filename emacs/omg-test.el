@@ -3,6 +3,7 @@
 (add-to-list 'load-path default-directory)
 
 (require 'ert)
+(require 'cl-lib)
 (require 'omg)
 
 (setq omg-db-file (make-temp-file "omg-test.db")
@@ -31,10 +32,63 @@
          (should (> (file-attribute-size attrs) 0)))))))
 
 (ert-deftest test-whoami ()
-  (with-current-buffer (omg-whoami "jiacai2050")
+  (omg-whoami "jiacai2050")
+  ;; wait fetching in background
+  (with-timeout (omg-http-timeout)
+    (while (not (get-buffer "*omg-whoami*"))
+      (accept-process-output nil 0.1)))
+  (with-current-buffer "*omg-whoami*"
     (let ((info (buffer-string)))
       (message "info is %s" info)
-      (should (string-match-p "jiacai2050" info)))))
+      (should (string-match-p "jiacai2050" info))))
+  ;; lock is released once result arrives
+  (should-not (omg-dyn-busy-p)))
+
+;; Calls made while a job runs are started one at a time, in order.
+(ert-deftest test-async-queue ()
+  (let ((busy t)
+        (started nil)
+        (omg--async-queue nil)
+        (omg--async-timer nil))
+    (cl-letf (((symbol-function 'omg-dyn-busy-p) (lambda () busy))
+              ((symbol-function 'omg--async-start)
+               (lambda (name _callback _fn _args)
+                 (push name started)
+                 (setq busy t))))
+      (omg--async "first" #'ignore #'ignore)
+      (omg--async "second" #'ignore #'ignore)
+      (should-not started)
+      (should omg--async-timer)
+      ;; running job done
+      (setq busy nil)
+      (omg--async-drain)
+      (should (equal '("first") started))
+      ;; first call done
+      (setq busy nil)
+      (omg--async-drain)
+      (should (equal '("second" "first") started))
+      (should-not omg--async-queue)
+      (should-not omg--async-timer))))
+
+;; Holds for any database: offsets past the last row give no rows, negative
+;; ones start from the first row, and windows add up to the whole result.
+(ert-deftest test-filter-repos-window ()
+  (dolist (starred '(t nil))
+    (dolist (sort '(nil stars name))
+      (let* ((all (omg-dyn-filter-repos-window starred 0 -1 nil nil nil sort))
+             (total (car all))
+             (joined []))
+        (should (= total (length (cdr all))))
+        (should (equal all (omg-dyn-filter-repos-window starred -5 -1 nil nil nil sort)))
+        (should (equal (cons total []) (omg-dyn-filter-repos-window starred total 10 nil nil nil sort)))
+        (should (equal (cons total []) (omg-dyn-filter-repos-window starred (+ total 100) 10 nil nil nil sort)))
+        (should (equal (cons total []) (omg-dyn-filter-repos-window starred 0 0 nil nil nil sort)))
+        (dotimes (i (1+ (/ total 2)))
+          (let ((window (omg-dyn-filter-repos-window starred (* i 2) 2 nil nil nil sort)))
+            (should (= total (car window)))
+            (should (<= (length (cdr window)) 2))
+            (setq joined (vconcat joined (cdr window)))))
+        (should (equal (cdr all) joined))))))
 
 (comment
  (ert-deftest test-sync ()
@@ -1,6 +1,7 @@
 ;;; -*- lexical-binding: t -*-
 
 (require 'omg-dyn)
+(require 'omg-core)
 (require 'tabulated-list)
 (require 'seq)
 (require 'omg-repo)
@@ -114,11 +115,41 @@ For more 2-letter codes, see https://www.w3.org/International/O-charset-lang.htm
 (defvar omg-trending--query-range omg-trending-default-range
   "Range used when query trendings repos.")
 
+(defvar-local omg-trending--refreshed nil
+  "Non-nil when the page was just refetched, so a stale one isn't refetched again.")
+
+(defun omg-trending--refresh ()
+  "Fetch current trending page in background, then reprint buffer."
+  (let* ((buf (current-buffer))
+         (spoken-language omg-trending--query-spoken-language)
+         (language omg-trending--query-language)
+         (range omg-trending--query-range)
+         (proc (make-pipe-process :name "omg-trending"
+                                  :coding 'utf-8-emacs-unix
+                                  :filter (lambda (proc output)
+                                            (omg--log "[omg-trending] %s\n" output)
+                                            (when (string-match-p omg--pipe-eof output)
+                                              (delete-process proc)
+                                              (when (buffer-live-p buf)
+                                                (with-current-buffer buf
+                                                  (let ((omg-trending--query-spoken-language spoken-language)
+                                                        (omg-trending--query-language language)
+                                                        (omg-trending--query-range range))
+                                                    (setq omg-trending--refreshed t)
+                                                    (tabulated-list-print t)))))))))
+    (unless (omg-dyn-refresh-trendings proc spoken-language language range)
+      ;; skipped while another job is running, cached page is shown as is
+      (delete-process proc))))
+
 (defun omg-trending--query ()
-  (seq-into (omg-dyn-query-trendings omg-trending--query-spoken-language
-                                     omg-trending--query-language
-                                     omg-trending--query-range)
-            'list))
+  "Show cached page instantly, refetch it in background when stale."
+  (let ((cached (omg-dyn-query-cached-trendings omg-trending--query-spoken-language
+                                                omg-trending--query-language
+                                                omg-trending--query-range)))
+    (unless (or (car cached) omg-trending--refreshed)
+      (omg-trending--refresh))
+    (setq omg-trending--refreshed nil)
+    (seq-into (cdr cached) 'list)))
 
 (defun omg-trending--get-buf-name ()
   (format "*omg-trending [%s]-[%s]-[%s] trendings repos*"
@@ -150,11 +181,14 @@ For more 2-letter codes, see https://www.w3.org/International/O-charset-lang.htm
   (let ((map (make-sparse-keymap)))
     (set-keymap-parent map omg-repo-mode-map)
     (define-key map (kbd "s") 'omg-trending-query)
+    (define-key map (kbd "h") 'omg-trending-history)
     map)
   "Local keymap for omg-trending-stars mode buffers.")
 
 (define-derived-mode omg-trending-mode omg-repo-mode "omg-trending" "Display trending repository"
   (setq tabulated-list-format [("Repository" 25)
+                               ("Language" 8)
+                               ("Stars" 8 t)
                                ("Recent Stars" 12 t)
                                ("Description" 5)]
         tabulated-list-padding 2
@@ -172,6 +206,112 @@ For more 2-letter codes, see https://www.w3.org/International/O-charset-lang.htm
     (tabulated-list-print t)
     (switch-to-buffer (current-buffer))))
 
+;;; History
+
+(defcustom omg-trending-history-days 30
+  "Days of trending history shown by `omg-trending-history'."
+  :group 'omg
+  :type 'integer)
+
+(defvar-local omg-trending--history-query nil
+  "(SPOKEN-LANGUAGE LANGUAGE RANGE DAYS) of current history buffer.")
+
+(defun omg-trending--history-query ()
+  (seq-into (apply #'omg-dyn-query-trending-streaks omg-trending--history-query)
+            'list))
+
+(define-derived-mode omg-trending-history-mode omg-repo-mode "omg-trending-history"
+  "Display how long repositories stay on a trending page"
+  (setq tabulated-list-format [("Repository" 25)
+                               ("Days" 5 nil)
+                               ("Streak" 7 nil)
+                               ("Longest" 8 nil)
+                               ("Best Rank" 10 nil)
+                               ("Stars Gained" 13 nil)
+                               ("First Seen" 11 t)
+                               ("Last Seen" 11 t)]
+        tabulated-list-padding 2
+        tabulated-list-sort-key nil
+        tabulated-list-entries 'omg-trending--history-query)
+  (tabulated-list-init-header))
+
+;;;###autoload
+(defun omg-trending-history (&optional days)
+  "List repositories on current trending page during last DAYS days.
+DAYS defaults to `omg-trending-history-days', history is recorded whenever
+a trending page is fetched."
+  (interactive "P")
+  (let ((query (list omg-trending--query-spoken-language
+                     omg-trending--query-language
+                     omg-trending--query-range
+                     (if days (prefix-numeric-value days) omg-trending-history-days))))
+    (with-current-buffer (get-buffer-create
+                          (format "*omg-trending history [%s]-[%s] %s days*"
+                                  (capitalize (or (nth 1 query) "any"))
+                                  (capitalize (nth 2 query))
+                                  (nth 3 query)))
+      (omg-trending-history-mode)
+      (setq omg-trending--history-query query)
+      (tabulated-list-print t)
+      (switch-to-buffer (current-buffer)))))
+
+;;; Several languages at once
+
+(defcustom omg-trending-batch-sources '(("c" . "daily") ("go" . "daily") ("rust" . "daily"))
+  "(LANGUAGE . RANGE) pairs listed together by `omg-trending-list-batch'.
+LANGUAGE is a value of `omg-trending--languages', nil means any language."
+  :group 'omg
+  :type '(repeat (cons (choice (string :tag "Programming Language")
+                               (const :tag "Any" nil))
+                       (string :tag "Range"))))
+
+(defvar-local omg-trending--batch-entries nil
+  "Rows of last fetch of `omg-trending-batch-sources'.")
+
+(defun omg-trending--batch-query ()
+  omg-trending--batch-entries)
+
+(defun omg-trending--batch-refresh (&optional _revert)
+  "Fetch pages of `omg-trending-batch-sources' at once in background, merged by rank."
+  (let ((buf (current-buffer)))
+    (omg--async "omg-trending-batch"
+                (lambda (rows)
+                  (when (buffer-live-p buf)
+                    (with-current-buffer buf
+                      (setq omg-trending--batch-entries (seq-into rows 'list))
+                      (tabulated-list-print t))))
+                #'omg-dyn-query-trendings-batch-async
+                omg-trending--query-spoken-language
+                omg-trending-batch-sources)
+    (message "Fetching trending pages...")))
+
+(define-derived-mode omg-trending-batch-mode omg-repo-mode "omg-trending-batch"
+  "Display trending repositories of several languages"
+  (setq tabulated-list-format `[("Repository" 25)
+                                ("Language" 8)
+                                ("Stars" 8 t)
+                                ("Recent Stars" 12 t)
+                                (,(format "Ranks(%s)"
+                                          (mapconcat (lambda (source) (or (car source) "any"))
+                                                     omg-trending-batch-sources " "))
+                                 12)
+                                ("Description" 5)]
+        tabulated-list-padding 2
+        tabulated-list-sort-key nil
+        tabulated-list-entries 'omg-trending--batch-query)
+  (add-hook 'tabulated-list-revert-hook 'omg-trending--batch-refresh nil t)
+  (tabulated-list-init-header))
+
+;;;###autoload
+(defun omg-trending-list-batch ()
+  "List trending repositories of `omg-trending-batch-sources' in one buffer."
+  (interactive)
+  (with-current-buffer (get-buffer-create "*omg-trending batch*")
+    (omg-trending-batch-mode)
+    (tabulated-list-print t)
+    (omg-trending--batch-refresh)
+    (switch-to-buffer (current-buffer))))
+
 (provide 'omg-trending)
 
 ;; Local Variables:
@@ -1,5 +1,8 @@
 ;;; -*- lexical-binding: t -*-
 
+(require 'omg-dyn)
+(require 'omg-core)
+
 (defconst omg-whoami--col-sep ",,,")
 (defconst omg-whoami--row-sep "\n")
 
@@ -16,8 +19,11 @@
   "Display `username' information, or current user represented by GitHub personal access token(PAT)."
   (interactive (list (when current-prefix-arg
                        (read-string "GitHub username: "))))
-  (let ((buf (get-buffer-create "*omg-whoami*"))
-        (who (omg-dyn-whoami username)))
+  (omg--async "omg-whoami" #'omg-whoami--display #'omg-dyn-whoami-async username)
+  (message "Fetching user information..."))
+
+(defun omg-whoami--display (who)
+  (let ((buf (get-buffer-create "*omg-whoami*")))
     (with-current-buffer buf
 	  (read-only-mode -1)
 	  (erase-buffer)
@@ -69,7 +69,15 @@
         (error "Personal access token not set.")
       (omg-dyn-setup (expand-file-name omg-db-file)
                      token
-                     omg-http-timeout)
+                     omg-http-timeout
+                     omg-db-page-size
+                     omg-db-cache-size
+                     omg-db-mmap-size
+                     omg-db-temp-store
+                     omg-db-journal-mode
+                     omg-db-synchronous
+                     omg-db-optimize-interval
+                     omg-trending-cache-ttl)
       (setq omg--already-setup t))))
 
 ;;;###autoload
@@ -86,13 +94,40 @@
                                        :coding 'utf-8-emacs-unix
                                        :filter (lambda (proc output)
                                                  (omg--log "[omg-sync] %s\n" output)
-                                                 (when (string-match-p omg--pipe-eof output)
-                                                   (delete-process proc)))
+                                                 (if (string-match-p omg--pipe-eof output)
+                                                     (delete-process proc)
+                                                   ;; page progress with rate and ETA
+                                                   (let ((message-log-max nil))
+                                                     (message "[omg-sync] %s" output))))
                                        :buffer buf)))
     (omg-dyn-sync sync-proc)
     (message (format "Start syncing repositories/gists in background. Check %s buffer for progress."
                      omg--log-buf-name))))
 
+;;;###autoload
+(defun omg-sync-readmes ()
+  "Fetch READMEs of starred repositories pushed since last fetch.
+They are used by `omg-repo-search-readme'."
+  (interactive)
+  (let* ((buf (get-buffer-create omg--log-buf-name))
+         (sync-proc (make-pipe-process :name "omg-sync-readmes"
+                                       :coding 'utf-8-emacs-unix
+                                       :filter (lambda (proc output)
+                                                 (omg--log "[omg-sync-readmes] %s\n" output)
+                                                 (when (string-match-p omg--pipe-eof output)
+                                                   (delete-process proc)))
+                                       :buffer buf)))
+    (omg-dyn-sync-readmes sync-proc)
+    (message (format "Start fetching READMEs in background. Check %s buffer for progress."
+                     omg--log-buf-name))))
+
+;;;###autoload
+(defun omg-vacuum ()
+  "Reclaim free pages of local database."
+  (interactive)
+  (omg-dyn-vacuum)
+  (message "Local database vacuumed."))
+
 (provide 'omg)
 
 ;; Local Variables:
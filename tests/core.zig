@@ -1,5 +1,6 @@
 const clib = @cImport({
     @cInclude("omg.h");
+    @cInclude("sqlite3.h");
 });
 const util = @import("util.zig");
 const std = @import("std");
@@ -34,8 +35,20 @@ fn test_download(ctx: ?*clib.struct_omg_context) anyerror!void {
     try testing.expectEqualStrings(url[0..], actual_url);
 }
 
+fn record_progress(progress: [*c]const clib.omg_sync_progress, userdata: ?*anyopaque) callconv(.C) void {
+    const last: *clib.omg_sync_progress = @ptrCast(@alignCast(userdata));
+    last.* = progress.*;
+}
+
 fn test_created_repos(ctx: ?*clib.struct_omg_context) anyerror!void {
+    var progress = mem.zeroes(clib.omg_sync_progress);
+    clib.omg_set_sync_progress(ctx, record_progress, &progress);
     try check_error(clib.omg_sync_created_repos(ctx));
+    clib.omg_set_sync_progress(ctx, null, null);
+    try testing.expect(progress.page > 0);
+    try testing.expect(progress.rows > 0);
+    try testing.expect(progress.bytes > 0);
+    try testing.expectEqualStrings("created repositories", mem.span(progress.kind));
     var repo_list = clib.omg_repo_list{
         .length = 0,
         .repo_array = null,
@@ -65,6 +78,568 @@ fn test_created_repos(ctx: ?*clib.struct_omg_context) anyerror!void {
     try check_error(clib.omg_query_created_repos(ctx, "", "rust", &list3));
 }
 
+fn test_topics(ctx: ?*clib.struct_omg_context) anyerror!void {
+    var topic_list = std.mem.zeroes(clib.omg_topic_list);
+    defer clib.omg_free_topic_list(&topic_list);
+    try check_error(clib.omg_query_topics(ctx, false, &topic_list));
+    if (topic_list.length == 0) {
+        return;
+    }
+
+    // every repository tagged with the most used topic
+    const top = topic_list.topic_array[0];
+    const topics = [_][*c]const u8{ top.name, null };
+    var filter = std.mem.zeroes(clib.omg_repo_filter);
+    filter.topics = &topics;
+    var hits = std.mem.zeroes(clib.omg_snapshot_hits);
+    defer clib.omg_free_snapshot_hits(&hits);
+    try check_error(clib.omg_filter_repo_snapshot(ctx, false, &filter, &hits));
+    try testing.expectEqual(@as(usize, @intCast(top.count)), hits.length);
+
+    // and none once it's excluded too
+    filter.excluded_topics = &topics;
+    var none = std.mem.zeroes(clib.omg_snapshot_hits);
+    defer clib.omg_free_snapshot_hits(&none);
+    try check_error(clib.omg_filter_repo_snapshot(ctx, false, &filter, &none));
+    try testing.expectEqual(@as(usize, 0), none.length);
+}
+
+fn test_facets(ctx: ?*clib.struct_omg_context) anyerror!void {
+    var facet_list = std.mem.zeroes(clib.omg_facet_list);
+    defer clib.omg_free_facet_list(&facet_list);
+    try check_error(clib.omg_query_facets(ctx, false, null, &facet_list));
+
+    // every repository is counted once per kind
+    var totals = [_]c_int{ 0, 0, 0 };
+    var i: usize = 0;
+    while (i < facet_list.length) : (i += 1) {
+        const facet = facet_list.facet_array[i];
+        totals[@intCast(facet.kind)] += facet.count;
+    }
+    try testing.expectEqual(totals[0], totals[1]);
+    try testing.expectEqual(totals[0], totals[2]);
+}
+
+fn test_star_history(ctx: ?*clib.struct_omg_context) anyerror!void {
+    var repo_list = clib.omg_repo_list{
+        .length = 0,
+        .repo_array = null,
+    };
+    defer clib.omg_free_repo_list(&repo_list);
+    try check_error(clib.omg_query_created_repos(ctx, "", "", &repo_list));
+    try testing.expect(repo_list.length > 0);
+
+    const repo = repo_list.repo_array[0];
+    var growth = clib.omg_repo_growth{
+        .repo_id = 0,
+        .full_name = null,
+        .stargazers_count = 0,
+        .star_delta = 0,
+        .fork_delta = 0,
+    };
+    defer clib.omg_free_repo_growth(&growth);
+    try check_error(clib.omg_query_repo_growth(ctx, repo.id, 7, &growth));
+    try testing.expectEqual(repo.id, growth.repo_id);
+    try testing.expectEqual(repo.stargazers_count, growth.stargazers_count);
+    // history starts with this sync
+    try testing.expectEqual(@as(c_int, 0), growth.star_delta);
+
+    var risers = clib.omg_repo_growth_list{
+        .length = 0,
+        .growth_array = null,
+    };
+    defer clib.omg_free_repo_growth_list(&risers);
+    try check_error(clib.omg_query_top_risers(ctx, 7, 10, &risers));
+    try testing.expectEqual(@as(usize, 0), risers.length);
+}
+
+// Counts of one repository change twice within a day, the second change
+// overwrites the history row of today.
+fn test_star_history_same_day() anyerror!void {
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+
+    var repo = std.mem.zeroes(clib.omg_repo);
+    repo.id = 42;
+    repo.full_name = "omg/history";
+    repo.created_at = "2024-01-01T00:00:00Z";
+    repo.pushed_at = "2024-01-01T00:00:00Z";
+    for ([_]c_int{ 1, 5, 9 }) |stars| {
+        repo.stargazers_count = stars;
+        try check_error(clib.omg__save_repos(ctx, .{ .repo_array = &repo, .length = 1 }));
+    }
+
+    var growth = std.mem.zeroes(clib.omg_repo_growth);
+    defer clib.omg_free_repo_growth(&growth);
+    try check_error(clib.omg_query_repo_growth(ctx, repo.id, 7, &growth));
+    try testing.expectEqual(@as(c_int, 9), growth.stargazers_count);
+    try testing.expectEqual(@as(c_int, 0), growth.star_delta);
+}
+
+fn count_starred(ctx: ?*clib.struct_omg_context) !usize {
+    var lst = clib.omg_starred_repo_list{ .length = 0, .star_array = null };
+    defer clib.omg_free_starred_repo_list(&lst);
+    try check_error(clib.omg_query_starred_repos(ctx, "", "", &lst));
+    return lst.length;
+}
+
+fn fake_stars() [3]clib.omg_starred_repo {
+    var stars = std.mem.zeroes([3]clib.omg_starred_repo);
+    const names = [_][*c]const u8{ "omg/a", "omg/b", "omg/c" };
+    for (&stars, names, 0..) |*star, name, i| {
+        star.starred_at = @constCast("2024-01-01T00:00:00Z");
+        star.repo.id = @intCast(i + 1);
+        star.repo.full_name = name;
+        star.repo.created_at = "2024-01-01T00:00:00Z";
+        star.repo.pushed_at = "2024-01-01T00:00:00Z";
+    }
+    return stars;
+}
+
+// Rows missing from a complete sync are swept, an aborted sync or one whose
+// rows fail to save keeps them.
+fn test_sync_sweep() anyerror!void {
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+
+    var stars = fake_stars();
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 3 }, true));
+    try testing.expectEqual(@as(usize, 3), try count_starred(ctx));
+
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 1 }, false));
+    try testing.expectEqual(@as(usize, 3), try count_starred(ctx));
+
+    var bad = stars;
+    bad[1].starred_at = null;
+    const err = clib.omg__sync_starred_page(ctx, .{ .star_array = &bad, .length = 2 }, true);
+    try testing.expect(!clib.is_ok(err));
+    try testing.expectEqual(@as(usize, 3), try count_starred(ctx));
+
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 1 }, true));
+    try testing.expectEqual(@as(usize, 1), try count_starred(ctx));
+}
+
+fn count_snapshot(ctx: ?*clib.struct_omg_context) !usize {
+    const filter = std.mem.zeroes(clib.omg_repo_filter);
+    var hits = std.mem.zeroes(clib.omg_snapshot_hits);
+    defer clib.omg_free_snapshot_hits(&hits);
+    try check_error(clib.omg_filter_repo_snapshot(ctx, true, &filter, &hits));
+    return hits.length;
+}
+
+fn snapshot_inode(path: []const u8) !fs.File.INode {
+    const f = try fs.openFileAbsolute(path, .{});
+    defer f.close();
+    return (try f.stat()).inode;
+}
+
+// The snapshot file is loaded as is by next start, and rebuilt when it's
+// older than the database or truncated.
+fn test_snapshot_file() anyerror!void {
+    const db_path = "/tmp/omg-snapshot-test.db";
+    const snap_path = db_path ++ "-starred.snap";
+    const kept_path = db_path ++ "-kept.snap";
+    defer {
+        const paths = [_][]const u8{ db_path, snap_path, db_path ++ "-created.snap", kept_path };
+        for (paths) |path| {
+            fs.deleteFileAbsolute(path) catch {};
+        }
+    }
+
+    var stars = fake_stars();
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(db_path, "dummy", 10, &ctx));
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 2 }, true));
+    try testing.expectEqual(@as(usize, 2), try count_snapshot(ctx));
+    clib.omg_free_context(&ctx);
+    const written = try snapshot_inode(snap_path);
+
+    // loaded, not rebuilt
+    try check_error(clib.omg_setup_context(db_path, "dummy", 10, &ctx));
+    try testing.expectEqual(@as(usize, 2), try count_snapshot(ctx));
+    try testing.expectEqual(written, try snapshot_inode(snap_path));
+    try fs.copyFileAbsolute(snap_path, kept_path, .{});
+
+    // changed by another context, both the in-memory copy and the file left
+    // behind are stale
+    var other: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(db_path, "dummy", 10, &other));
+    try check_error(clib.omg__sync_starred_page(other, .{ .star_array = &stars, .length = 3 }, true));
+    clib.omg_free_context(&other);
+    try testing.expectEqual(@as(usize, 3), try count_snapshot(ctx));
+    clib.omg_free_context(&ctx);
+
+    try fs.copyFileAbsolute(kept_path, snap_path, .{});
+    try check_error(clib.omg_setup_context(db_path, "dummy", 10, &ctx));
+    try testing.expectEqual(@as(usize, 3), try count_snapshot(ctx));
+    clib.omg_free_context(&ctx);
+
+    {
+        const f = try fs.openFileAbsolute(snap_path, .{ .mode = .read_write });
+        defer f.close();
+        try f.setEndPos(100);
+    }
+    try check_error(clib.omg_setup_context(db_path, "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+    try testing.expectEqual(@as(usize, 3), try count_snapshot(ctx));
+    const f = try fs.openFileAbsolute(snap_path, .{});
+    defer f.close();
+    try testing.expect((try f.stat()).size > 100);
+}
+
+const IdSet = std.ArrayList(c_int);
+
+fn collect_star_id(star: [*c]const clib.omg_starred_repo, userdata: ?*anyopaque) callconv(.C) bool {
+    const ids: *IdSet = @ptrCast(@alignCast(userdata));
+    ids.append(star.*.repo.id) catch return false;
+    return true;
+}
+
+// Starred repositories matching filter are the same from snapshot and SQL.
+fn expect_snapshot_matches_sql(ctx: ?*clib.struct_omg_context, keyword: [*c]const u8, language: [*c]const u8) !void {
+    var filter = std.mem.zeroes(clib.omg_repo_filter);
+    filter.keyword = keyword;
+    filter.language = language;
+
+    var from_sql = IdSet.init(std.heap.page_allocator);
+    defer from_sql.deinit();
+    try check_error(clib.omg_query_starred_repos_each(ctx, &filter, collect_star_id, &from_sql));
+    var from_snapshot = IdSet.init(std.heap.page_allocator);
+    defer from_snapshot.deinit();
+    var hits = std.mem.zeroes(clib.omg_snapshot_hits);
+    defer clib.omg_free_snapshot_hits(&hits);
+    try check_error(clib.omg_filter_repo_snapshot(ctx, true, &filter, &hits));
+    for (hits.row_array[0..hits.length]) |row| {
+        var repo = std.mem.zeroes(clib.omg_snapshot_repo);
+        try check_error(clib.omg_get_snapshot_repo(ctx, true, row, &repo));
+        try from_snapshot.append(repo.id);
+    }
+
+    mem.sort(c_int, from_sql.items, {}, std.sort.asc(c_int));
+    mem.sort(c_int, from_snapshot.items, {}, std.sort.asc(c_int));
+    try testing.expectEqualSlices(c_int, from_sql.items, from_snapshot.items);
+}
+
+fn expect_snapshots_match_sql(ctx: ?*clib.struct_omg_context) !void {
+    try expect_snapshot_matches_sql(ctx, null, null);
+    try expect_snapshot_matches_sql(ctx, "fast", null);
+    try expect_snapshot_matches_sql(ctx, null, "Zig");
+}
+
+// Snapshot follows each kind of write to repositories.
+fn test_snapshot_writes() anyerror!void {
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+
+    var stars = fake_stars();
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 3 }, true));
+    try expect_snapshots_match_sql(ctx);
+
+    var repo = stars[1].repo;
+    repo.lang = "Zig";
+    repo.description = "fast";
+    try check_error(clib.omg__save_repos(ctx, .{ .repo_array = &repo, .length = 1 }));
+    try expect_snapshots_match_sql(ctx);
+
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 2 }, true));
+    try expect_snapshots_match_sql(ctx);
+
+    var other: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &other));
+    defer clib.omg_free_context(&other);
+    stars[2].repo.lang = "Zig";
+    try check_error(clib.omg__sync_starred_page(other, .{ .star_array = &stars, .length = 3 }, true));
+
+    const path = "/tmp/omg-snapshot-changeset.jsonl";
+    defer fs.deleteFileAbsolute(path) catch {};
+    const f = try fs.createFileAbsolute(path, .{ .read = true });
+    defer f.close();
+    try check_error(clib.omg_export_changeset(other, 0, f.handle, null));
+    try f.seekTo(0);
+    try check_error(clib.omg_import_changeset(ctx, f.handle, null));
+    try expect_snapshots_match_sql(ctx);
+}
+
+// Equal strings share one copy owned by the context, which stays put as the
+// table grows, and repositories read back point to it.
+fn test_intern() anyerror!void {
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+
+    var buf: [32]u8 = undefined;
+    const zig = clib.omg_intern(ctx, "Zig");
+    try testing.expectEqualStrings("Zig", mem.span(zig));
+    try testing.expectEqual(zig, clib.omg_intern(ctx, (try std.fmt.bufPrintZ(&buf, "Zig", .{})).ptr));
+    try testing.expect(zig != clib.omg_intern(ctx, "zig"));
+    try testing.expect(clib.omg_intern(ctx, null) == null);
+
+    for (0..1000) |i| {
+        const lang = try std.fmt.bufPrintZ(&buf, "lang-{d}", .{i});
+        try testing.expectEqualStrings(lang, mem.span(clib.omg_intern(ctx, lang.ptr)));
+    }
+    try testing.expectEqual(zig, clib.omg_intern(ctx, "Zig"));
+    try testing.expectEqualStrings("lang-7", mem.span(clib.omg_intern(ctx, "lang-7")));
+
+    var stars = fake_stars();
+    for (&stars) |*star| {
+        star.repo.lang = "Zig";
+    }
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 3 }, true));
+    var lst = clib.omg_starred_repo_list{ .length = 0, .star_array = null };
+    defer clib.omg_free_starred_repo_list(&lst);
+    try check_error(clib.omg_query_starred_repos(ctx, "", "", &lst));
+    try testing.expectEqual(@as(usize, 3), lst.length);
+    for (lst.star_array[0..lst.length]) |star| {
+        try testing.expectEqual(zig, star.repo.lang);
+    }
+}
+
+// A list outgrows the 64 rows its element array starts with, and its
+// strings outgrow the first block, all released by one free call.
+fn test_arena_lists() anyerror!void {
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+    const allocator = arena.allocator();
+
+    const count = 300;
+    const description = try allocator.allocSentinel(u8, 1024, 0);
+    @memset(description, 'x');
+    const stars = try allocator.alloc(clib.omg_starred_repo, count);
+    for (stars, 0..) |*star, i| {
+        star.* = std.mem.zeroes(clib.omg_starred_repo);
+        star.starred_at = @constCast("2024-01-01T00:00:00Z");
+        star.repo.id = @intCast(i + 1);
+        star.repo.full_name = (try std.fmt.allocPrintZ(allocator, "omg/{d}", .{i + 1})).ptr;
+        star.repo.description = description.ptr;
+        star.repo.created_at = "2024-01-01T00:00:00Z";
+        star.repo.pushed_at = "2024-01-01T00:00:00Z";
+    }
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = stars.ptr, .length = count }, true));
+
+    var lst = clib.omg_starred_repo_list{ .length = 0, .star_array = null };
+    defer clib.omg_free_starred_repo_list(&lst);
+    try check_error(clib.omg_query_starred_repos(ctx, "", "", &lst));
+    try testing.expectEqual(@as(usize, count), lst.length);
+    var seen = [_]bool{false} ** (count + 1);
+    var buf: [16]u8 = undefined;
+    for (lst.star_array[0..lst.length]) |star| {
+        const id: usize = @intCast(star.repo.id);
+        try testing.expect(!seen[id]);
+        seen[id] = true;
+        try testing.expectEqualStrings(try std.fmt.bufPrint(&buf, "omg/{d}", .{id}), mem.span(star.repo.full_name));
+        try testing.expectEqualStrings(description, mem.span(star.repo.description));
+    }
+
+    var empty = clib.omg_starred_repo_list{ .length = 0, .star_array = null };
+    defer clib.omg_free_starred_repo_list(&empty);
+    try check_error(clib.omg_query_starred_repos(ctx, "nothing matches", "", &empty));
+    try testing.expectEqual(@as(usize, 0), empty.length);
+}
+
+const Counter = struct {
+    visited: usize = 0,
+    // stop once `limit` rows are visited
+    limit: usize = std.math.maxInt(usize),
+
+    fn visit(self: *Counter) bool {
+        self.visited += 1;
+        return self.visited < self.limit;
+    }
+};
+
+fn count_repo(repo: [*c]const clib.omg_repo, userdata: ?*anyopaque) callconv(.C) bool {
+    _ = repo;
+    const counter: *Counter = @ptrCast(@alignCast(userdata));
+    return counter.visit();
+}
+
+fn count_star(star: [*c]const clib.omg_starred_repo, userdata: ?*anyopaque) callconv(.C) bool {
+    _ = star;
+    const counter: *Counter = @ptrCast(@alignCast(userdata));
+    return counter.visit();
+}
+
+fn count_gist(gist: [*c]const clib.omg_gist, userdata: ?*anyopaque) callconv(.C) bool {
+    _ = gist;
+    const counter: *Counter = @ptrCast(@alignCast(userdata));
+    return counter.visit();
+}
+
+// Visitors see the same rows as list queries, filtered, and stop when asked.
+fn test_visitors() anyerror!void {
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer clib.omg_free_context(&ctx);
+
+    var stars = fake_stars();
+    stars[0].repo.lang = "Zig";
+    try check_error(clib.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = 3 }, true));
+
+    var ids = IdSet.init(std.heap.page_allocator);
+    defer ids.deinit();
+    try check_error(clib.omg_query_starred_repos_each(ctx, null, collect_star_id, &ids));
+    var lst = clib.omg_starred_repo_list{ .length = 0, .star_array = null };
+    defer clib.omg_free_starred_repo_list(&lst);
+    try check_error(clib.omg_query_starred_repos(ctx, "", "", &lst));
+    var listed = IdSet.init(std.heap.page_allocator);
+    defer listed.deinit();
+    for (lst.star_array[0..lst.length]) |star| {
+        try listed.append(star.repo.id);
+    }
+    mem.sort(c_int, ids.items, {}, std.sort.asc(c_int));
+    mem.sort(c_int, listed.items, {}, std.sort.asc(c_int));
+    try testing.expectEqualSlices(c_int, listed.items, ids.items);
+
+    var filter = std.mem.zeroes(clib.omg_repo_filter);
+    filter.language = "zig";
+    ids.clearRetainingCapacity();
+    try check_error(clib.omg_query_starred_repos_each(ctx, &filter, collect_star_id, &ids));
+    try testing.expectEqualSlices(c_int, &[_]c_int{1}, ids.items);
+
+    var counter = Counter{ .limit = 1 };
+    try check_error(clib.omg_query_starred_repos_each(ctx, null, count_star, &counter));
+    try testing.expectEqual(@as(usize, 1), counter.visited);
+    counter = .{};
+    try check_error(clib.omg_query_created_repos_each(ctx, null, count_repo, &counter));
+    try testing.expectEqual(@as(usize, 0), counter.visited);
+
+    var files = [_]clib.omg_gist_file{
+        .{ .filename = @constCast("a.zig"), .language = @constCast("Zig"), .raw_url = @constCast("https://gist.example/a.zig"), .size = 1 },
+        .{ .filename = @constCast("b.c"), .language = @constCast("C"), .raw_url = @constCast("https://gist.example/b.c"), .size = 2 },
+    };
+    var gist = std.mem.zeroes(clib.omg_gist);
+    gist.id = @constCast("g1");
+    gist.created_at = @constCast("2024-01-01T00:00:00Z");
+    gist._file_array = &files;
+    gist._file_length = files.len;
+    try check_error(clib.omg__save_gists(ctx, true, .{ .gist_array = &gist, .length = 1 }));
+    counter = .{};
+    try check_error(clib.omg_query_gists_each(ctx, true, null, count_gist, &counter));
+    try testing.expectEqual(@as(usize, 2), counter.visited);
+    counter = .{ .limit = 1 };
+    try check_error(clib.omg_query_gists_each(ctx, true, null, count_gist, &counter));
+    try testing.expectEqual(@as(usize, 1), counter.visited);
+}
+
+fn exec_sql(path: [*c]const u8, sql: [*c]const u8) !void {
+    var db: ?*clib.sqlite3 = null;
+    defer _ = clib.sqlite3_close(db);
+    try testing.expectEqual(clib.SQLITE_OK, clib.sqlite3_open(path, &db));
+    try testing.expectEqual(clib.SQLITE_OK, clib.sqlite3_exec(db, sql, null, null, null));
+}
+
+fn query_int(path: [*c]const u8, sql: [*c]const u8) !i64 {
+    var db: ?*clib.sqlite3 = null;
+    defer _ = clib.sqlite3_close(db);
+    try testing.expectEqual(clib.SQLITE_OK, clib.sqlite3_open(path, &db));
+    var stmt: ?*clib.sqlite3_stmt = null;
+    defer _ = clib.sqlite3_finalize(stmt);
+    try testing.expectEqual(clib.SQLITE_OK, clib.sqlite3_prepare_v2(db, sql, -1, &stmt, null));
+    try testing.expectEqual(clib.SQLITE_ROW, clib.sqlite3_step(stmt));
+    return clib.sqlite3_column_int64(stmt, 0);
+}
+
+fn query_text(path: [*c]const u8, sql: [*c]const u8, out: []u8) !void {
+    var db: ?*clib.sqlite3 = null;
+    defer _ = clib.sqlite3_close(db);
+    try testing.expectEqual(clib.SQLITE_OK, clib.sqlite3_open(path, &db));
+    var stmt: ?*clib.sqlite3_stmt = null;
+    defer _ = clib.sqlite3_finalize(stmt);
+    try testing.expectEqual(clib.SQLITE_OK, clib.sqlite3_prepare_v2(db, sql, -1, &stmt, null));
+    try testing.expectEqual(clib.SQLITE_ROW, clib.sqlite3_step(stmt));
+    const text = mem.span(clib.sqlite3_column_text(stmt, 0));
+    @memcpy(out[0..text.len], text);
+}
+
+// Files of gists saved as JSON before omg_gist_file are moved into it by
+// migration 2, leaving omg_gist.files NULL.
+fn test_gist_files_migration() anyerror!void {
+    const db_path = "/tmp/omg-gist-migration.db";
+    fs.deleteFileAbsolute(db_path) catch {};
+    defer fs.deleteFileAbsolute(db_path) catch {};
+
+    try exec_sql(db_path,
+        \CREATE TABLE omg_gist (id text PRIMARY KEY, created_at text NOT NULL,
+        \    description text, files text, `public` integer);
+        \CREATE TABLE omg_created_gist (id integer PRIMARY KEY AUTOINCREMENT,
+        \    gist_id integer, UNIQUE (gist_id));
+        \INSERT INTO omg_gist VALUES ('g1', '2024-01-01T00:00:00Z', NULL,
+        \    '{"main.zig": {"filename": "main.zig", "language": "Zig", "raw_url": "https://gist.example/main.zig", "size": 10},
+        \      "notes": {"filename": "notes", "language": null, "raw_url": "https://gist.example/notes", "size": 3}}', 1);
+        \INSERT INTO omg_created_gist (gist_id) VALUES ('g1');
+        \PRAGMA user_version = 1;
+    );
+
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context(db_path, "dummy", 10, &ctx));
+    var lst = clib.omg_gist_list{ .length = 0, .gist_array = null };
+    defer clib.omg_free_gist_list(&lst);
+    try check_error(clib.omg_query_created_gists(ctx, &lst));
+    clib.omg_free_context(&ctx);
+
+    try testing.expectEqual(@as(usize, 2), lst.length);
+    for (lst.gist_array[0..lst.length]) |gist| {
+        try testing.expectEqualStrings("g1", mem.span(gist.id));
+        const file = gist.file;
+        if (mem.eql(u8, mem.span(file.filename), "main.zig")) {
+            try testing.expectEqualStrings("Zig", mem.span(file.language));
+            try testing.expectEqual(@as(usize, 10), file.size);
+        } else {
+            try testing.expectEqualStrings("notes", mem.span(file.filename));
+            try testing.expect(file.language == null);
+            try testing.expectEqualStrings("https://gist.example/notes", mem.span(file.raw_url));
+        }
+    }
+
+    try testing.expectEqual(@as(i64, 0), try query_int(db_path, "SELECT count(*) FROM omg_gist WHERE files IS NOT NULL"));
+}
+
+// PRAGMA words are spliced into SQL, anything but a plain word is rejected
+// before the database is touched.
+fn test_db_options() anyerror!void {
+    const rejected = [_][*c]const u8{
+        "wal; drop table omg_repo",
+        "memory'",
+        "off -- comment",
+        "a" ** 40,
+    };
+    for (rejected) |journal_mode| {
+        var opts = std.mem.zeroes(clib.omg_setup_options);
+        opts.github_token = "dummy";
+        opts.timeout = 10;
+        opts.journal_mode = journal_mode;
+        var ctx: ?*clib.struct_omg_context = null;
+        const err = clib.omg_setup_context_with_options(":memory:", &opts, &ctx);
+        try testing.expectEqual(@as(c_int, clib.OMG_CODE_INTERNAL), err.code);
+        try testing.expect(mem.startsWith(u8, mem.sliceTo(&err.message, 0), "invalid journal_mode"));
+        try testing.expect(ctx == null);
+    }
+
+    const db_path = "/tmp/omg-options-test.db";
+    fs.deleteFileAbsolute(db_path) catch {};
+    defer fs.deleteFileAbsolute(db_path) catch {};
+    var opts = std.mem.zeroes(clib.omg_setup_options);
+    opts.github_token = "dummy";
+    opts.timeout = 10;
+    opts.journal_mode = "wal";
+    opts.synchronous = "off";
+    opts.temp_store = "memory";
+    var ctx: ?*clib.struct_omg_context = null;
+    try check_error(clib.omg_setup_context_with_options(db_path, &opts, &ctx));
+    clib.omg_free_context(&ctx);
+    var journal_mode = [_]u8{0} ** 16;
+    try query_text(db_path, "PRAGMA journal_mode", &journal_mode);
+    try testing.expectEqualStrings("wal", mem.sliceTo(&journal_mode, 0));
+}
+
 fn test_created_gists(ctx: ?*clib.struct_omg_context) anyerror!void {
     try check_error(clib.omg_sync_created_gists(ctx));
     var gist_list = clib.omg_gist_list{
@@ -107,6 +682,103 @@ fn test_create_pull(ctx: ?*clib.struct_omg_context) anyerror!void {
 
 fn test_star_repo(ctx: ?*clib.struct_omg_context) anyerror!void {
     try check_error(clib.omg_star_repo(ctx, "xigua2023/xigua2023"));
+    try expect_snapshot_matches_sql(ctx, null, null);
+}
+
+fn count_readme(star: [*c]const clib.omg_starred_repo, snippet: [*c]const u8, userdata: ?*anyopaque) callconv(.C) bool {
+    _ = star;
+    _ = snippet;
+    const rows: *usize = @ptrCast(@alignCast(userdata));
+    rows.* += 1;
+    return true;
+}
+
+fn test_readme(ctx: ?*clib.struct_omg_context) anyerror!void {
+    try check_error(clib.omg_sync_starred_repos(ctx));
+    var stats = std.mem.zeroes(clib.omg_readme_sync_stats);
+    try check_error(clib.omg_sync_readmes(ctx, 4, &stats));
+    try testing.expect(stats.checked > 0);
+    try testing.expectEqual(@as(i32, 0), stats.failed);
+    try testing.expectEqual(stats.checked, stats.updated + stats.missing);
+
+    // nothing pushed since last fetch
+    try check_error(clib.omg_sync_readmes(ctx, 4, &stats));
+    try testing.expectEqual(@as(i32, 0), stats.checked);
+
+    // quotes are escaped rather than parsed as FTS5 syntax
+    var rows: usize = 0;
+    try check_error(clib.omg_search_readmes_each(ctx, "\"", null, count_readme, &rows));
+    try check_error(clib.omg_search_readmes_each(ctx, "\" \"\" \"*", null, count_readme, &rows));
+}
+
+fn test_commits(ctx: ?*clib.struct_omg_context) anyerror!void {
+    const full_name = "jiacai2050/oh-my-github";
+    var commit_list = std.mem.zeroes(clib.omg_commit_list);
+    // newest borrows from the list
+    defer clib.omg_free_commit_list(&commit_list);
+    try check_error(clib.omg_query_commits(ctx, full_name, 150, &commit_list));
+    try testing.expect(commit_list.length > 100);
+    const newest = std.mem.span(commit_list.commit_array[0].sha);
+
+    // served from cache, without any request
+    var cached_list = std.mem.zeroes(clib.omg_commit_list);
+    defer clib.omg_free_commit_list(&cached_list);
+    try check_error(clib.omg_query_cached_commits(ctx, full_name, 150, &cached_list));
+    try testing.expectEqual(@as(usize, 150), cached_list.length);
+    try testing.expectEqualStrings(newest, std.mem.span(cached_list.commit_array[0].sha));
+}
+
+fn test_releases(ctx: ?*clib.struct_omg_context) anyerror!void {
+    const full_name = "jiacai2050/oh-my-github";
+    var release_list = std.mem.zeroes(clib.omg_release_list);
+    defer clib.omg_free_release_list(&release_list);
+    try check_error(clib.omg_query_releases(ctx, full_name, 10, &release_list));
+    try testing.expect(release_list.length > 0);
+
+    // revalidated with ETag, cache is unchanged
+    var names = [_][*c]const u8{full_name};
+    try check_error(clib.omg_refresh_releases(ctx, &names, names.len, 10));
+    var cached_list = std.mem.zeroes(clib.omg_release_list);
+    defer clib.omg_free_release_list(&cached_list);
+    try check_error(clib.omg_query_cached_releases(ctx, full_name, 10, &cached_list));
+    try testing.expectEqual(release_list.length, cached_list.length);
+
+    var since_list = std.mem.zeroes(clib.omg_release_list);
+    defer clib.omg_free_release_list(&since_list);
+    try check_error(clib.omg_query_releases_since(ctx, "2000-01-01T00:00:00Z", 0, &since_list));
+    try testing.expect(since_list.length >= release_list.length);
+}
+
+fn test_trending(ctx: ?*clib.struct_omg_context) anyerror!void {
+    var repo_list = std.mem.zeroes(clib.omg_repo_list);
+    defer clib.omg_free_repo_list(&repo_list);
+    try check_error(clib.omg_query_trending(ctx, null, "zig", "weekly", &repo_list));
+
+    // repeat views are served from cache
+    var cached_list = std.mem.zeroes(clib.omg_repo_list);
+    defer clib.omg_free_repo_list(&cached_list);
+    var fresh = false;
+    try check_error(clib.omg_query_cached_trending(ctx, null, "zig", "weekly", &cached_list, &fresh));
+    try testing.expect(fresh);
+    try testing.expectEqual(repo_list.length, cached_list.length);
+
+    // several pages at once, cached zig page is merged with a fetched one
+    const sources = [_]clib.omg_trending_source{
+        .{ .spoken_lang = null, .lang = "zig", .since = "weekly" },
+        .{ .spoken_lang = null, .lang = "c", .since = "weekly" },
+    };
+    var merged = std.mem.zeroes(clib.omg_trending_list);
+    defer clib.omg_free_trending_list(&merged);
+    try check_error(clib.omg_query_trendings(ctx, &sources, sources.len, &merged));
+    try testing.expect(merged.length >= repo_list.length);
+    try testing.expectEqual(@as(c_int, 1), merged.repo_array[0].ranks[0]);
+
+    // fetched pages are recorded as today's history
+    var streaks = std.mem.zeroes(clib.omg_trending_streak_list);
+    defer clib.omg_free_trending_streak_list(&streaks);
+    try check_error(clib.omg_query_trending_streaks(ctx, null, "zig", "weekly", 1, 0, &streaks));
+    try testing.expectEqual(repo_list.length, streaks.length);
+    try testing.expectEqual(@as(c_int, 1), streaks.streak_array[0].current_streak);
 }
 
 pub fn main() anyerror!void {
@@ -126,7 +798,23 @@ pub fn main() anyerror!void {
 
     try test_download(ctx);
     try test_created_repos(ctx);
+    try test_topics(ctx);
+    try test_facets(ctx);
+    try test_star_history(ctx);
+    try test_star_history_same_day();
+    try test_sync_sweep();
+    try test_snapshot_file();
+    try test_snapshot_writes();
+    try test_intern();
+    try test_arena_lists();
+    try test_visitors();
+    try test_gist_files_migration();
+    try test_db_options();
     try test_created_gists(ctx);
     try test_create_pull(ctx);
     try test_star_repo(ctx);
+    try test_readme(ctx);
+    try test_commits(ctx);
+    try test_releases(ctx);
+    try test_trending(ctx);
 }
@@ -0,0 +1,216 @@
+const std = @import("std");
+const util = @import("util.zig");
+const c = @cImport({
+    @cInclude("omg.h");
+});
+
+const testing = std.testing;
+const fs = std.fs;
+const mem = std.mem;
+const json = std.json;
+
+pub fn main() !void {
+    // No network is needed, rows are saved as a sync does.
+    var ctx: ?*c.struct_omg_context = null;
+    try util.check_error(c.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer c.omg_free_context(&ctx);
+
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+    const allocator = arena.allocator();
+
+    try save_rows(ctx);
+    try export_repos(ctx, allocator);
+    try export_gists(ctx, allocator);
+    try changesets(ctx, allocator);
+}
+
+fn save_rows(ctx: c.omg_context) !void {
+    var topics = [_][*c]const u8{ "zig", "cli" };
+    var stars = mem.zeroes([2]c.omg_starred_repo);
+    stars[0].starred_at = @constCast("2024-01-02T00:00:00Z");
+    stars[0].repo.id = 1;
+    stars[0].repo.full_name = "omg/quoted";
+    stars[0].repo.description = "say \"hi\", then\nleave";
+    stars[0].repo.lang = "Zig";
+    stars[0].repo.stargazers_count = 7;
+    stars[0].repo.topics = &topics;
+    stars[0].repo.topic_length = topics.len;
+    // no description, language nor topics
+    stars[1].starred_at = @constCast("2024-01-01T00:00:00Z");
+    stars[1].repo.id = 2;
+    stars[1].repo.full_name = "omg/bare";
+    for (&stars) |*star| {
+        star.repo.created_at = "2024-01-01T00:00:00Z";
+        star.repo.pushed_at = "2024-01-01T00:00:00Z";
+    }
+    try util.check_error(c.omg__sync_starred_page(ctx, .{ .star_array = &stars, .length = stars.len }, true));
+
+    var files = [_]c.omg_gist_file{
+        .{ .filename = @constCast("main.zig"), .language = @constCast("Zig"), .raw_url = @constCast("https://gist.example/main.zig"), .size = 10 },
+        .{ .filename = @constCast("notes"), .language = null, .raw_url = @constCast("https://gist.example/notes"), .size = 3 },
+    };
+    var gist = mem.zeroes(c.omg_gist);
+    gist.id = @constCast("g1");
+    gist.created_at = @constCast("2024-01-01T00:00:00Z");
+    gist.public = true;
+    gist._file_array = &files;
+    gist._file_length = files.len;
+    try util.check_error(c.omg__save_gists(ctx, false, .{ .gist_array = &gist, .length = 1 }));
+}
+
+fn export_to_string(ctx: c.omg_context, kind: c.omg_export_kind, format: c.omg_export_format, allocator: mem.Allocator) ![]const u8 {
+    const path = "/tmp/omg-export-test";
+    const f = try fs.createFileAbsolute(path, .{ .read = true });
+    defer {
+        f.close();
+        fs.deleteFileAbsolute(path) catch {};
+    }
+    try util.check_error(c.omg_export(ctx, kind, format, f.handle));
+    try f.seekTo(0);
+    return try f.readToEndAlloc(allocator, 1 << 20);
+}
+
+fn parse_lines(text: []const u8, allocator: mem.Allocator) ![]json.ObjectMap {
+    var rows = std.ArrayList(json.ObjectMap).init(allocator);
+    var lines = mem.splitScalar(u8, mem.trimRight(u8, text, "\n"), '\n');
+    while (lines.next()) |line| {
+        const parsed = try json.parseFromSliceLeaky(json.Value, allocator, line, .{});
+        try rows.append(parsed.object);
+    }
+    return rows.items;
+}
+
+fn export_repos(ctx: c.omg_context, allocator: mem.Allocator) !void {
+    const text = try export_to_string(ctx, c.OMG_EXPORT_STARRED_REPOS, c.OMG_FORMAT_JSONL, allocator);
+    const rows = try parse_lines(text, allocator);
+    try testing.expectEqual(@as(usize, 2), rows.len);
+
+    // newest star first
+    const quoted = rows[0];
+    try testing.expectEqual(@as(i64, 1), quoted.get("id").?.integer);
+    try testing.expectEqualStrings("omg/quoted", quoted.get("full_name").?.string);
+    try testing.expectEqualStrings("say \"hi\", then\nleave", quoted.get("description").?.string);
+    try testing.expectEqualStrings("Zig", quoted.get("lang").?.string);
+    try testing.expectEqual(@as(i64, 7), quoted.get("stargazers_count").?.integer);
+    try testing.expectEqualStrings("2024-01-02T00:00:00Z", quoted.get("starred_at").?.string);
+    const topics = quoted.get("topics").?.array.items;
+    try testing.expectEqual(@as(usize, 2), topics.len);
+    try testing.expectEqualStrings("cli", topics[0].string);
+    try testing.expectEqualStrings("zig", topics[1].string);
+
+    const bare = rows[1];
+    try testing.expectEqualStrings("omg/bare", bare.get("full_name").?.string);
+    try testing.expect(bare.get("description").? == .null);
+    try testing.expect(bare.get("lang").? == .null);
+    try testing.expect(bare.get("license").? == .null);
+    try testing.expectEqual(@as(usize, 0), bare.get("topics").?.array.items.len);
+
+    // NULL is an empty field, quotes are doubled and newlines kept quoted
+    const csv = try export_to_string(ctx, c.OMG_EXPORT_STARRED_REPOS, c.OMG_FORMAT_CSV, allocator);
+    try testing.expectEqualStrings(
+        \\starred_at,id,full_name,description,private,created_at,license,pushed_at,stargazers_count,watchers_count,forks_count,lang,homepage,size,topics
+        \\2024-01-02T00:00:00Z,1,omg/quoted,"say ""hi"", then
+        \\leave",0,2024-01-01T00:00:00Z,,2024-01-01T00:00:00Z,7,0,0,Zig,,0,"[""cli"",""zig""]"
+        \\2024-01-01T00:00:00Z,2,omg/bare,,0,2024-01-01T00:00:00Z,,2024-01-01T00:00:00Z,0,0,0,,,0,[]
+        \\
+    , csv);
+
+    // created repositories are exported separately
+    const created = try export_to_string(ctx, c.OMG_EXPORT_CREATED_REPOS, c.OMG_FORMAT_JSONL, allocator);
+    try testing.expectEqualStrings("", created);
+}
+
+fn export_gists(ctx: c.omg_context, allocator: mem.Allocator) !void {
+    const text = try export_to_string(ctx, c.OMG_EXPORT_CREATED_GISTS, c.OMG_FORMAT_JSONL, allocator);
+    const rows = try parse_lines(text, allocator);
+    // one row per file
+    try testing.expectEqual(@as(usize, 2), rows.len);
+    for (rows) |row| {
+        try testing.expectEqualStrings("g1", row.get("id").?.string);
+        try testing.expect(row.get("description").? == .null);
+        try testing.expectEqual(@as(i64, 1), row.get("public").?.integer);
+        const filename = row.get("filename").?.string;
+        if (mem.eql(u8, filename, "main.zig")) {
+            try testing.expectEqualStrings("Zig", row.get("language").?.string);
+            try testing.expectEqual(@as(i64, 10), row.get("size").?.integer);
+        } else {
+            try testing.expectEqualStrings("notes", filename);
+            try testing.expect(row.get("language").? == .null);
+            try testing.expectEqualStrings("https://gist.example/notes", row.get("raw_url").?.string);
+        }
+    }
+
+    const starred = try export_to_string(ctx, c.OMG_EXPORT_STARRED_GISTS, c.OMG_FORMAT_JSONL, allocator);
+    try testing.expectEqualStrings("", starred);
+}
+
+const changeset_path = "/tmp/omg-changeset-test";
+
+fn export_changeset(ctx: c.omg_context, since: i64, path: []const u8) !i64 {
+    const f = try fs.createFileAbsolute(path, .{});
+    defer f.close();
+    var until: i64 = 0;
+    try util.check_error(c.omg_export_changeset(ctx, since, f.handle, &until));
+    return until;
+}
+
+fn import_changeset(ctx: c.omg_context, path: []const u8) !i64 {
+    const f = try fs.openFileAbsolute(path, .{});
+    defer f.close();
+    var until: i64 = 0;
+    try util.check_error(c.omg_import_changeset(ctx, f.handle, &until));
+    return until;
+}
+
+// Every exported row of `ctx` is the same in `other`.
+fn expect_same_rows(ctx: c.omg_context, other: c.omg_context, allocator: mem.Allocator) !void {
+    const kinds = [_]c.omg_export_kind{
+        c.OMG_EXPORT_CREATED_REPOS, c.OMG_EXPORT_STARRED_REPOS,
+        c.OMG_EXPORT_CREATED_GISTS, c.OMG_EXPORT_STARRED_GISTS,
+    };
+    for (kinds) |kind| {
+        const expected = try export_to_string(ctx, kind, c.OMG_FORMAT_JSONL, allocator);
+        const actual = try export_to_string(other, kind, c.OMG_FORMAT_JSONL, allocator);
+        try testing.expectEqualStrings(expected, actual);
+    }
+}
+
+fn changesets(ctx: c.omg_context, allocator: mem.Allocator) !void {
+    const old_path = changeset_path ++ "-old";
+    defer {
+        fs.deleteFileAbsolute(changeset_path) catch {};
+        fs.deleteFileAbsolute(old_path) catch {};
+    }
+
+    // round trip into a fresh database
+    var other: ?*c.struct_omg_context = null;
+    try util.check_error(c.omg_setup_context(":memory:", "dummy", 10, &other));
+    defer c.omg_free_context(&other);
+    const first = try export_changeset(ctx, 0, old_path);
+    try testing.expectEqual(first, try import_changeset(other, old_path));
+    try expect_same_rows(ctx, other, allocator);
+
+    // rows changed after `first` form the next changeset
+    var star = mem.zeroes(c.omg_starred_repo);
+    star.starred_at = @constCast("2024-01-03T00:00:00Z");
+    star.repo.id = 2;
+    star.repo.full_name = "omg/bare";
+    star.repo.description = "described later";
+    star.repo.created_at = "2024-01-01T00:00:00Z";
+    star.repo.pushed_at = "2024-01-01T00:00:00Z";
+    try util.check_error(c.omg__sync_starred_page(ctx, .{ .star_array = &star, .length = 1 }, true));
+    const next = try export_changeset(ctx, first, changeset_path);
+    try testing.expect(next > first);
+    try testing.expectEqual(next, try import_changeset(other, changeset_path));
+    try expect_same_rows(ctx, other, allocator);
+
+    // importing the same changeset again changes nothing
+    try testing.expectEqual(next, try import_changeset(other, changeset_path));
+    try expect_same_rows(ctx, other, allocator);
+
+    // nor does one older than the last imported, which would bring back
+    // omg/quoted swept above
+    try testing.expectEqual(first, try import_changeset(other, old_path));
+    try expect_same_rows(ctx, other, allocator);
+}
@@ -0,0 +1,119 @@
+const std = @import("std");
+const util = @import("util.zig");
+const c = @cImport({
+    @cInclude("omg.h");
+});
+
+const testing = std.testing;
+const log = std.log;
+const mem = std.mem;
+
+// Follows markup of https://github.com/trending, with a few edge cases:
+// no description, no language, html entities and emoji.
+const page = @embedFile("fixtures/trending.html");
+const bench_rounds = 200;
+
+pub fn main() !void {
+    // No network is needed, parsing works on the saved page.
+    var ctx: ?*c.struct_omg_context = null;
+    try util.check_error(c.omg_setup_context(":memory:", "dummy", 10, &ctx));
+    defer c.omg_free_context(&ctx);
+
+    try parse(ctx);
+    try fallback(ctx);
+    try fallback_one_article(ctx);
+    try bench(ctx);
+}
+
+fn parse(ctx: c.omg_context) !void {
+    var lst = mem.zeroes(c.omg_repo_list);
+    defer c.omg_free_repo_list(&lst);
+    try util.check_error(c.omg__parse_trending(ctx, page, page.len, false, &lst));
+    try testing.expectEqual(@as(usize, 25), lst.length);
+
+    const first = lst.repo_array[0];
+    try testing.expectEqualStrings("ollama/ollama", mem.span(first.full_name));
+    try testing.expectEqualStrings("Go", mem.span(first.lang));
+    try testing.expectEqual(@as(c_int, 117346), first.stargazers_count);
+    try testing.expectEqual(@as(c_int, 9541), first.forks_count);
+    try testing.expectEqual(@as(c_int, 1118), first.recent_stars);
+
+    const entity = lst.repo_array[3];
+    try testing.expectEqualStrings(
+        "Oh My GitHub is a delightful, easy-to-use CLI & Emacs client for GitHub.",
+        mem.span(entity.description),
+    );
+
+    const bare = lst.repo_array[5];
+    try testing.expectEqualStrings("awesome-lists/awesome-lists", mem.span(bare.full_name));
+    try testing.expect(bare.description == null);
+    try testing.expect(bare.lang == null);
+    try testing.expectEqual(@as(c_int, 57), bare.recent_stars);
+}
+
+fn fallback(ctx: c.omg_context) !void {
+    // Unknown markup goes through the regex, which only knows name,
+    // description and recent stars.
+    const allocator = std.heap.page_allocator;
+    const changed = try mem.replaceOwned(u8, allocator, page, "<article", "<section");
+    defer allocator.free(changed);
+    const html = try allocator.dupeZ(u8, changed);
+    defer allocator.free(html);
+
+    var lst = mem.zeroes(c.omg_repo_list);
+    defer c.omg_free_repo_list(&lst);
+    try util.check_error(c.omg__parse_trending(ctx, html, html.len, false, &lst));
+    try testing.expectEqual(@as(usize, 25), lst.length);
+    try testing.expectEqualStrings("ollama/ollama", mem.span(lst.repo_array[0].full_name));
+    try testing.expectEqual(@as(c_int, 1118), lst.repo_array[0].recent_stars);
+
+    // a repository without description is kept, and doesn't take the
+    // description of the next one
+    const bare = lst.repo_array[5];
+    try testing.expectEqualStrings("awesome-lists/awesome-lists", mem.span(bare.full_name));
+    try testing.expect(bare.description == null);
+    try testing.expectEqual(@as(c_int, 57), bare.recent_stars);
+    try testing.expectEqualStrings("tldraw/tldraw", mem.span(lst.repo_array[6].full_name));
+    try testing.expect(lst.repo_array[6].description != null);
+}
+
+fn fallback_one_article(ctx: c.omg_context) !void {
+    // Only the article the scanner doesn't understand goes through the
+    // regex, others keep language and counts.
+    const allocator = std.heap.page_allocator;
+    const html = try allocator.dupeZ(u8, page);
+    defer allocator.free(html);
+    const second = mem.indexOfPos(u8, html, mem.indexOf(u8, html, "<article").? + 1, "<article").?;
+    const heading = mem.indexOfPos(u8, html, second, "<h2").?;
+    html[heading + 2] = '3';
+
+    var lst = mem.zeroes(c.omg_repo_list);
+    defer c.omg_free_repo_list(&lst);
+    try util.check_error(c.omg__parse_trending(ctx, html, html.len, false, &lst));
+    try testing.expectEqual(@as(usize, 25), lst.length);
+    try testing.expectEqualStrings("Go", mem.span(lst.repo_array[0].lang));
+
+    const broken = lst.repo_array[1];
+    try testing.expectEqualStrings("microsoft/markitdown", mem.span(broken.full_name));
+    try testing.expect(broken.lang == null);
+    try testing.expectEqual(@as(c_int, 3702), broken.recent_stars);
+
+    try testing.expectEqualStrings("Zig", mem.span(lst.repo_array[2].lang));
+    try testing.expectEqual(@as(c_int, 35962), lst.repo_array[2].stargazers_count);
+}
+
+fn bench(ctx: c.omg_context) !void {
+    for ([_]bool{ false, true }) |regex| {
+        var timer = try std.time.Timer.start();
+        for (0..bench_rounds) |_| {
+            var lst = mem.zeroes(c.omg_repo_list);
+            try util.check_error(c.omg__parse_trending(ctx, page, page.len, regex, &lst));
+            c.omg_free_repo_list(&lst);
+        }
+        const per_page = timer.read() / bench_rounds;
+        log.info("{s}: {d}us per page", .{
+            if (regex) "regex" else "scanner",
+            per_page / std.time.ns_per_us,
+        });
+    }
+}